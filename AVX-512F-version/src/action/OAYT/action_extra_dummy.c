@@ -167,7 +167,7 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
   uint8_t fnsh[N] = { 0 }, mask, isocnt[N] = { 0 };
   __m512i ec = VZERO, inf, bc, vone = VSET1(1), t;  
   htpoint A0, A1, T0, T1, T2, T3, G0, G1, K[HLMAX], Z;
-  int count = 0, total = 0, si, i, j, m = 0, numba = NUMBA;
+  int count = 0, total = 0, si, i, j, m = 0, numba = NUMBA, base;
 
   // Initialize SIMBA variables. 
   memcpy(ba, BATCHES, N);
@@ -178,6 +178,7 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
 
   // Initialize variables for computing CSIDH class group action.
   point_copy_8x1w(&A0, A);
+  base = curve_iseql_8x1w(A, E[0], E[1]);
   memcpy(isocnt, B, N);
 
   while (total < NUMISO) {
@@ -202,15 +203,25 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
       }
     }
 
-    elligator_8x1w(&T1, &T0, &A0);
-    yDBL_8x1w(&T0, &T0, &A0); 
-    yDBL_8x1w(&T0, &T0, &A0);
-    yDBL_8x1w(&T1, &T1, &A0);
-    yDBL_8x1w(&T1, &T1, &A0); 
-
-    for (i = 0; i < sicoba[m]; i++) {
-      yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
-      yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+    if (!count && base) {
+      // the first round on the base curve starts from the precomputed points
+      for (i = 0; i < HT_NWORDS; i++) {
+        T0.y[i] = VSET1(ET[0][i]);
+        T1.y[i] = VSET1(ET[1][i]);
+        T0.z[i] = T1.z[i] = VSET1(ht_montR[i]);
+      }
+    }
+    else {
+      elligator_8x1w(&T1, &T0, &A0);
+      yDBL_8x1w(&T0, &T0, &A0); 
+      yDBL_8x1w(&T0, &T0, &A0);
+      yDBL_8x1w(&T1, &T1, &A0);
+      yDBL_8x1w(&T1, &T1, &A0); 
+
+      for (i = 0; i < sicoba[m]; i++) {
+        yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
+        yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+      }
     }
 
     for (i = 0; i < sizeba[m]; i++) {
@@ -421,3 +432,45 @@ void random_sk(uint8_t *sk)
     sk[i] = (exp << 1) ^ (1 & (1 + sgn));
   }
 }
+
+// eight random bytes, one in each 64-bit lane
+static __m512i random_u8_8x1w()
+{
+  uint64_t r;
+
+  randombytes(&r, sizeof(r));
+  return _mm512_cvtepu8_epi64(_mm_cvtsi64_si128(r));
+}
+
+// Sample nb batches of eight secret keys at once: vsk[b] is the lane-packed 
+// form (as consumed by action()) of the keys 8b, ..., 8b+7, and sk[8b+k] (if 
+// sk is not NULL) is the key 8b+k in the form of random_sk(). The exponents 
+// are sampled like in random_sk(), but by rejection from the smallest power of
+// 2 above the bound instead of from a full byte, and in all lanes at once.
+void random_sk_8x1w(__m512i (*vsk)[N], uint8_t (*sk)[N], const int nb)
+{
+  __m512i t, m, exp, sgn, bound;
+  __mmask8 rej;
+  int b, i, k;
+
+  for (b = 0; b < nb; b++) {
+    for (i = 0; i < N; i++) {
+      // exp is randomly selected from |[ 0, 2B ]|
+      bound = VSET1(B[i] << 1);
+      m = VSET1((2 << (31 - __builtin_clz(B[i] << 1))) - 1);
+      t = VAND(random_u8_8x1w(), m);
+      while ((rej = VCMPGT(t, bound))) t = VMMOV(t, rej, VAND(random_u8_8x1w(), m));
+
+      // Mapping integers from |[ 0, 2B |] into |[ -B, B ]|
+      exp = VSUB(t, VSET1(B[i]));
+      sgn = VSRA(exp, 63);              // sign of exp
+
+      // Next, to write  key[i] = e || ((1 + sgn)/2)
+      exp = VSUB(VXOR(exp, sgn), sgn);
+      vsk[b][i] = VXOR(VSHL(exp, 1), VADD(sgn, VSET1(1)));
+    }
+    if (sk)
+      for (k = 0; k < 8; k++)
+        for (i = 0; i < N; i++) sk[8*b+k][i] = (uint8_t) ((uint64_t *)&vsk[b][i])[k];
+  }
+}
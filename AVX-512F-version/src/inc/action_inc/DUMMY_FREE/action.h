@@ -78,6 +78,19 @@ static uint8_t COMPBA[NUMBA][N] = {
   60, 61, 62, 63, 65, 66, 67, 68, 70, 71, 72, 73, 74, 74, 74, 74,
   74, 74, 74, 74, 74, 74, 74, 74, 74, 74 } };
 
+// the points T- (on the twist) and T+ (on E) the first round starts from when 
+// the curve is the base curve E: the Montgomery points x = 3 and x = 4 multiplied by 4
+// and all primes of COMPBA[1], so that their order is the product of the primes 
+// of BATCHES[1]; twisted Edwards y in radix-29 Montgomery domain, z = 1
+static uint32_t ET[2][HT_NWORDS] = {
+  { 0x1120dc8b, 0x1099b86d, 0x14131973, 0x06fcbd9f, 0x02963325, 0x18634c0c,
+    0x1f907785, 0x108c446a, 0x1e4885e4, 0x060a8048, 0x193913e9, 0x1da4a8d2,
+    0x15d17995, 0x02135ea7, 0x0b046784, 0x1e0b19f0, 0x18abd5bd, 0x00016dc1, },
+  { 0x13354344, 0x1475ebbb, 0x1258df6d, 0x0b51956a, 0x020a37ae, 0x0e446d24,
+    0x08965282, 0x19ca7edc, 0x065fd7e7, 0x084c3b71, 0x18db5b1c, 0x1d501e57,
+    0x076b1ad1, 0x0c4fbf47, 0x0e64c386, 0x0e4ab38b, 0x03694c13, 0x0000b96e, },
+};
+
 // parameters for hybrid-extra-infinity 
 // HT_NUMISO + LL_NUMISO = NUMISO
 static int HT_NUMISO = 646;
@@ -90,5 +103,6 @@ static uint8_t ll_idx[LL_NUMIDX] = { 60, 61, 62, 63, 64, 65, 66, 67, 68 };
 
 void action(htpoint_t C, const __m512i *sk, const htpoint_t A);
 void random_sk(uint8_t *sk);
+void random_sk_8x1w(__m512i (*vsk)[N], uint8_t (*sk)[N], const int nb);
 
 #endif
\ No newline at end of file
@@ -65,6 +65,19 @@ static uint8_t COMPBA[NUMBA][N] = {
     57, 58, 60, 61, 63, 64, 66, 67, 69, 70, 72, 73, 74, 74, 74, 74, 74, 74, 74,
     74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74 } };
 
+// the points T- (on the twist) and T+ (on E) the first round starts from when 
+// the curve is the base curve E: the Montgomery points x = 2 and x = 4 multiplied by 4
+// and all primes of COMPBA[1], so that their order is the product of the primes 
+// of BATCHES[1]; twisted Edwards y in radix-29 Montgomery domain, z = 1
+static uint32_t ET[2][HT_NWORDS] = {
+  { 0x134b5fba, 0x08980da1, 0x10498556, 0x13316d20, 0x1dfdf3d0, 0x185a257b,
+    0x0c91a035, 0x165044ed, 0x149225e2, 0x1db3cc38, 0x1639eb19, 0x07156dc4,
+    0x113ba102, 0x178d4652, 0x108785f8, 0x179566f0, 0x1b53c414, 0x000017c0, },
+  { 0x1b5fc06d, 0x0848ceaa, 0x051334aa, 0x196cc195, 0x03ab67d4, 0x1cd5a4bc,
+    0x070c5cef, 0x0b1a2cc7, 0x01ae5faa, 0x19784f79, 0x0045e3c8, 0x0784f948,
+    0x02d4cb4f, 0x198d22e3, 0x010effd2, 0x0daba306, 0x1dfe30b2, 0x00001749, },
+};
+
 // parameters for hybrid-extra-infinity 
 // HT_NUMISO + LL_NUMISO = NUMISO
 static int HT_NUMISO = 358;
@@ -78,5 +91,6 @@ static uint8_t ll_idx[LL_NUMIDX] = { 62, 63, 64, 65, 66, 67, 68 };
 
 void action(htpoint_t C, const __m512i *sk, const htpoint_t A);
 void random_sk(uint8_t *sk);
+void random_sk_8x1w(__m512i (*vsk)[N], uint8_t (*sk)[N], const int nb);
 
 #endif
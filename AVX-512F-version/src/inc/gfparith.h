@@ -47,6 +47,17 @@ static const uint32_t ht_montR2[HT_NWORDS] = {
   0x1BF7A9C1, 0x033D3CE8, 0x03AA0C3B, 0x118D310F, 0x1CE83173, 0x1BE13007,
   0x1AD114C5, 0x188D441E, 0x10FCDC0B, 0x1D9ABEBD, 0x0BE69F94, 0x0001A7D4, };
 
+// -----------------------------------------------------------------------------
+// signed radix-29 parameters for the safegcd inversion [BY19] of HT field elements
+
+#define SG_BRADIX 29                    // limb size, also the number of divsteps per iteration
+#define SG_NWORDS 18                    // limb number
+#define SG_BMASK  0x1FFFFFFFULL         // 2^29 - 1
+#define SG_NITERS 51                    // 51*29 = 1479 >= 1477 divsteps needed for 511-bit p
+#define SG_PINV   0x1CD1D6B3            // p^(-1) mod 2^29
+#define JC_NITERS 36                    // 36*29 = 1044 >= 2*511-1 binary GCD steps needed for the
+                                        // Jacobi symbol with 511-bit p [Por20]
+
 // -----------------------------------------------------------------------------
 // radix-64 constants 
 
@@ -65,6 +76,41 @@ static const uint64_t u64_pdiv2[8] = {
   0x8dc0dc8299e3643d, 0xe1390dfa2bd6541a, 0xa8b398660f85a792, 0xd3d56362b3f9aa83,
   0x2d7dfe63499164e6, 0x5a16841d76e44621, 0xfe455868af1f2625, 0x32da4747ba07c4df, };
 
+// -----------------------------------------------------------------------------
+// fixed sliding-window (w = 5) chains of the exponents (p-2) and (p-1)/2
+// each step {s, k} means r = r^(2^s) * a^(2k+1), the first step means r = a^(2k+1)
+
+#define EXP_WINTBL 16                   // number of precomputed odd powers a^1, a^3, ..., a^31
+#define EXP_CHNLEN 85                   // number of steps in the chain
+
+static const uint8_t psub2_chain[EXP_CHNLEN][2] = {
+  { 0, 12}, { 6, 13}, { 5,  4}, { 8, 14}, { 7,  7}, { 6, 14}, {11, 15}, { 8,  9},
+  { 6, 15}, { 5, 15}, { 5, 12}, { 8, 10}, { 3,  1}, { 8,  6}, { 8, 10}, { 3,  3},
+  { 8, 15}, { 7,  9}, { 7,  4}, { 6, 10}, { 3,  2}, { 8,  5}, { 2,  0}, { 5,  0},
+  {10, 14}, { 6, 14}, { 5, 11}, { 7,  8}, { 5,  1}, { 4,  0}, { 8,  4}, { 5,  6},
+  { 6, 15}, { 6, 15}, { 3,  3}, { 4,  1}, { 7,  6}, { 7,  9}, { 7,  8}, { 6, 12},
+  { 5,  3}, { 7, 13}, { 6,  9}, { 4,  6}, { 6, 10}, { 5,  8}, { 4,  5}, { 8, 10},
+  { 5,  9}, { 5, 15}, { 6,  6}, { 6, 10}, {10, 14}, { 6,  8}, { 6, 12}, { 5, 12},
+  { 1,  0}, { 9, 12}, { 1,  0}, {10, 15}, { 8,  5}, { 6,  9}, { 5, 12}, { 7, 11},
+  { 9,  9}, { 4,  4}, { 9, 13}, { 4,  7}, { 6,  8}, { 6, 11}, { 5, 10}, { 4,  4},
+  { 4,  2}, { 9,  6}, { 6,  8}, { 5, 11}, {11, 13}, { 4,  4}, { 8,  2}, { 7, 12},
+  { 3,  3}, { 8, 13}, { 3,  0}, { 8,  7}, { 3,  0},
+};
+
+static const uint8_t pdiv2_chain[EXP_CHNLEN][2] = {
+  { 0, 12}, { 6, 13}, { 5,  4}, { 8, 14}, { 7,  7}, { 6, 14}, {11, 15}, { 8,  9},
+  { 6, 15}, { 5, 15}, { 5, 12}, { 8, 10}, { 3,  1}, { 8,  6}, { 8, 10}, { 3,  3},
+  { 8, 15}, { 7,  9}, { 7,  4}, { 6, 10}, { 3,  2}, { 8,  5}, { 2,  0}, { 5,  0},
+  {10, 14}, { 6, 14}, { 5, 11}, { 7,  8}, { 5,  1}, { 4,  0}, { 8,  4}, { 5,  6},
+  { 6, 15}, { 6, 15}, { 3,  3}, { 4,  1}, { 7,  6}, { 7,  9}, { 7,  8}, { 6, 12},
+  { 5,  3}, { 7, 13}, { 6,  9}, { 4,  6}, { 6, 10}, { 5,  8}, { 4,  5}, { 8, 10},
+  { 5,  9}, { 5, 15}, { 6,  6}, { 6, 10}, {10, 14}, { 6,  8}, { 6, 12}, { 5, 12},
+  { 1,  0}, { 9, 12}, { 1,  0}, {10, 15}, { 8,  5}, { 6,  9}, { 5, 12}, { 7, 11},
+  { 9,  9}, { 4,  4}, { 9, 13}, { 4,  7}, { 6,  8}, { 6, 11}, { 5, 10}, { 4,  4},
+  { 4,  2}, { 9,  6}, { 6,  8}, { 5, 11}, {11, 13}, { 4,  4}, { 8,  2}, { 7, 12},
+  { 3,  3}, { 8, 13}, { 3,  0}, { 8,  7}, { 2,  0},
+};
+
 // -----------------------------------------------------------------------------
 // (8x1)-way prime-field operations
 
@@ -73,7 +119,9 @@ void gfp_sub_8x1w(htfe_t r, const htfe_t a, const htfe_t b);
 void gfp_mul_8x1w(htfe_t r, const htfe_t a, const htfe_t b);
 void gfp_sqr_8x1w(htfe_t r, const htfe_t a);
 void gfp_pow_8x1w(htfe_t r, const htfe_t a, const uint64_t *e);
+void gfp_powchn_8x1w(htfe_t r, const htfe_t a, const uint8_t (*c)[2]);
 void gfp_inv_8x1w(htfe_t r, const htfe_t a);
+void gfp_sginv_8x1w(htfe_t r, const htfe_t a);
 void gfp_rdcp_8x1w(htfe_t r, const htfe_t a);
 void gfp_zero_8x1w(htfe_t r);
 void gfp_num2mont_8x1w(htfe_t r, const htfe_t a);
@@ -81,6 +129,8 @@ void gfp_mont2num_8x1w(htfe_t r, const htfe_t a);
 void gfp_copy_8x1w(htfe_t r, const htfe_t a);
 void gfp_cmove_8x1w(htfe_t r, htfe_t a, const __m512i b);
 void gfp_cswap_8x1w(htfe_t r, htfe_t a, const __m512i b);
+__m512i gfp_euler_8x1w(const htfe_t a);
+__m512i gfp_jacobi_8x1w(const htfe_t a);
 __m512i gfp_issqr_8x1w(const htfe_t a);
 __m512i gfp_iszero_8x1w(const htfe_t a);
 
@@ -19,6 +19,7 @@
 #define VSUB(X, Y)            _mm512_sub_epi64(X, Y)
 #define VMSUB(W, X, Y, Z)     _mm512_mask_sub_epi64(W, X, Y, Z)
 #define VMUL(X, Y)            _mm512_mul_epu32(X, Y)
+#define VMULS(X, Y)           _mm512_mul_epi32(X, Y)
 
 // AVX-512IFMA instructions
 #define VMACLO(X, Y, Z)       _mm512_madd52lo_epu64(X, Y, Z)
@@ -35,6 +36,10 @@
 #define VSHR(X, Y)            _mm512_srli_epi64(X, Y)
 #define VSRA(X, Y)            _mm512_srai_epi64(X, Y)
 
+// comparison operations (return a mask)
+#define VCMPGT(X, Y)          _mm512_cmpgt_epi64_mask(X, Y)
+#define VTEST(X, Y)           _mm512_test_epi64_mask(X, Y)
+
 // broadcast operations
 #define VZERO                 _mm512_setzero_si512()
 #define VSET1(X)              _mm512_set1_epi64(X)
@@ -48,6 +53,17 @@
 #define VALIGNR(X, Y, Z)      _mm512_alignr_epi64(X, Y ,Z)
 #define VZALIGNR(W, X, Y, Z)  _mm512_maskz_alignr_epi64(W, X, Y, Z)
 #define VMBLEND(X, Y, Z)      _mm512_mask_blend_epi64(X, Y, Z)
+#define VMMOV(X, Y, Z)        _mm512_mask_mov_epi64(X, Y, Z)
+#define VUNPACKLO(X, Y)       _mm512_unpacklo_epi64(X, Y)
+#define VUNPACKHI(X, Y)       _mm512_unpackhi_epi64(X, Y)
+#define VSHUF128(X, Y, Z)     _mm512_shuffle_i64x2(X, Y, Z)
+#define VLOAD(X)              _mm512_loadu_si512((const void *)(X))
+#define VSTORE(X, Y)          _mm512_storeu_si512((void *)(X), Y)
+
+// 32-bit operations (for ChaCha20)
+#define VADD32(X, Y)          _mm512_add_epi32(X, Y)
+#define VROL32(X, Y)          _mm512_rol_epi32(X, Y)
+#define VSET132(X)            _mm512_set1_epi32(X)
 
 #define VADDRDC(X) \
 ((uint64_t *)&X)[0]+((uint64_t *)&X)[1]+((uint64_t *)&X)[2]+((uint64_t *)&X)[3]+\
@@ -10,10 +10,16 @@
 #ifndef _RNG_H
 #define _RNG_H
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include "intrin.h"
 
+#define RNG_LANES 16                  // ChaCha20 blocks per refill, one per 32-bit lane
+
+void chacha20_16x1w(__m512i *r, const uint32_t *key, const uint32_t *nonce, const uint32_t ctr);
 void randombytes(void *r, size_t len);
+void rng_seed(const uint8_t *seed);
 
 #endif
\ No newline at end of file
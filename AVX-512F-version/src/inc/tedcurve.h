@@ -73,6 +73,7 @@ void point_copy_8x1w(htpoint_t R, const htpoint_t P);
 void point_cmove_8x1w(htpoint_t R, htpoint_t P, const __m512i b);
 void point_cswap_8x1w(htpoint_t R, htpoint_t P, const __m512i b);
 __m512i point_isinf_8x1w(const htpoint_t P);
+int curve_iseql_8x1w(const htpoint_t A, const uint32_t *y, const uint32_t *z);
 void yDBL_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A);
 void yADD_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t Q, const htpoint_t PQ);
 void yMUL_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A, const uint8_t k);
@@ -24,4 +24,8 @@ __m512i set_vector(const uint32_t a7, const uint32_t a6, const uint32_t a5, cons
                    const uint32_t a3, const uint32_t a2, const uint32_t a1, const uint32_t a0);
 void get_channel_8x1w(uint32_t *r, const htfe_t a, const int ch);
 
+void vec_transpose_8x8(__m512i *r, const __m512i *a);
+void mpi_load_8x1w(htfe_t r, const uint64_t (*a)[8]);
+void mpi_store_8x1w(uint64_t (*r)[8], const htfe_t a);
+
 #endif
\ No newline at end of file
@@ -1078,11 +1078,31 @@ void gfp_pow_8x1w(htfe_t r, const htfe_t a, const uint64_t *e)
   }
 }
 
+// field exponentiation r = a^e mod 2p with a fixed sliding-window chain of e
+// the chain c is a *public* parameter and is the *same* for all 8 instances
+// -> r in [0, 2p)
+void gfp_powchn_8x1w(htfe_t r, const htfe_t a, const uint8_t (*c)[2])
+{
+  htfe_t t[EXP_WINTBL], a2;
+  int i, j;
+
+  // precompute t[k] = a^(2k+1)
+  gfp_copy_8x1w(t[0], a);
+  gfp_sqr_8x1w(a2, a);
+  for (i = 1; i < EXP_WINTBL; i++) gfp_mul_8x1w(t[i], t[i-1], a2);
+
+  gfp_copy_8x1w(r, t[c[0][1]]);
+  for (i = 1; i < EXP_CHNLEN; i++) {
+    for (j = 0; j < c[i][0]; j++) gfp_sqr_8x1w(r, r);
+    gfp_mul_8x1w(r, r, t[c[i][1]]);
+  }
+}
+
 // field multiplicative inversion r = a^(-1) = a^(p-2) mod 2p
 // -> r in [0, 2p)
 void gfp_inv_8x1w(htfe_t r, const htfe_t a)
 {
-  gfp_pow_8x1w(r, a, u64_psub2);
+  gfp_powchn_8x1w(r, a, psub2_chain);
 }
 
 // reduce the field element from [0, 2p) to [0, p)
@@ -1309,10 +1329,10 @@ void gfp_cswap_8x1w(htfe_t r, htfe_t a, const __m512i b)
   a[12] = a12; a[13] = a13; a[14] = a14; a[15] = a15; a[16] = a16; a[17] = a17;
 }
 
-// check whether the field element is a square in the field  
+// check whether the field element is a square in the field with Euler's criterion
 // if a is     a square in the field, return 1; 
 // if a is not a square in the field, return 0.
-__m512i gfp_issqr_8x1w(const htfe_t a)
+__m512i gfp_euler_8x1w(const htfe_t a)
 {  
   htfe_t t0, t1;
   __m512i r = VZERO;
@@ -1321,7 +1341,7 @@ __m512i gfp_issqr_8x1w(const htfe_t a)
   // compute r = a^((p-1)/2) - 1 
   // r is 0 if a is a square; r is non-0 if a is not a square
   gfp_copy_8x1w(t0, a);                 // t0 = a
-  gfp_pow_8x1w(t1, t0, u64_pdiv2);      // t1 = a^((p-1)/2)
+  gfp_powchn_8x1w(t1, t0, pdiv2_chain); // t1 = a^((p-1)/2)
   gfp_rdcp_8x1w(t1, t1);                // t1 in [0, p) and strictly radix-29 now 
   for(i = 0; i < HT_NWORDS; i++)        // r = t1 - 1
     r = VOR(r, VSUB(t1[i], VSET1(ht_montR[i])));
@@ -1364,6 +1384,288 @@ __m512i gfp_iszero_8x1w(const htfe_t a)
   return t;
 }
 
+// -----------------------------------------------------------------------------
+// (8x1)-way constant-time safegcd inversion [BY19] 
+// f, g, d, e are *signed* radix-SG_BRADIX integers with SG_NWORDS limbs, the 
+// lower limbs are in [0, 2^SG_BRADIX) and the top limb carries the sign
+
+// SG_BRADIX divsteps on the lowest limbs of f and g 
+// -> the transition matrix t = (u, v, q, r) scaled by 2^SG_BRADIX, and new delta
+static __m512i gfp_divsteps_8x1w(__m512i *t, __m512i delta, __m512i f, __m512i g)
+{
+  __m512i u = VSET1(1), v = VZERO, q = VZERO, r = VSET1(1), x;
+  const __m512i one = VSET1(1);
+  __mmask8 c;
+  int i;
+
+  for (i = 0; i < SG_BRADIX; i++) {
+    // if delta > 0 and g is odd: (delta, f, g, u, v, q, r) = (-delta, g, -f, q, r, -u, -v) 
+    c = VCMPGT(delta, VZERO) & VTEST(g, one);
+    delta = VMSUB(delta, c, VZERO, delta);
+    x = f; f = VMMOV(f, c, g); g = VMSUB(g, c, VZERO, x);
+    x = u; u = VMMOV(u, c, q); q = VMSUB(q, c, VZERO, x);
+    x = v; v = VMMOV(v, c, r); r = VMSUB(r, c, VZERO, x);
+    // if g is odd: (g, q, r) = (g + f, q + u, r + v)
+    c = VTEST(g, one);
+    g = VMADD(g, c, g, f); q = VMADD(q, c, q, u); r = VMADD(r, c, r, v);
+    // (delta, g, u, v) = (delta + 1, g/2, 2u, 2v)
+    delta = VADD(delta, one); g = VSRA(g, 1); u = VSHL(u, 1); v = VSHL(v, 1);
+  }
+
+  t[0] = u; t[1] = v; t[2] = q; t[3] = r;
+
+  return delta;
+}
+
+// (f, g) = (u*f + v*g, q*f + r*g) / 2^SG_BRADIX
+// |u| + |v| <= 2^SG_BRADIX and |q| + |r| <= 2^SG_BRADIX, the division is exact
+static void gfp_updatefg_8x1w(__m512i *f, __m512i *g, const __m512i *t)
+{
+  const __m512i u = t[0], v = t[1], q = t[2], r = t[3];
+  const __m512i vbmask = VSET1(SG_BMASK);
+  __m512i cf, cg;
+  int i;
+
+  cf = VADD(VMULS(u, f[0]), VMULS(v, g[0]));
+  cg = VADD(VMULS(q, f[0]), VMULS(r, g[0]));
+  cf = VSRA(cf, SG_BRADIX); cg = VSRA(cg, SG_BRADIX);
+
+  for (i = 1; i < SG_NWORDS; i++) {
+    cf = VADD(cf, VADD(VMULS(u, f[i]), VMULS(v, g[i])));
+    cg = VADD(cg, VADD(VMULS(q, f[i]), VMULS(r, g[i])));
+    f[i-1] = VAND(cf, vbmask); cf = VSRA(cf, SG_BRADIX);
+    g[i-1] = VAND(cg, vbmask); cg = VSRA(cg, SG_BRADIX);
+  }
+
+  f[SG_NWORDS-1] = cf; g[SG_NWORDS-1] = cg;
+}
+
+// (d, e) = (u*d + v*e, q*d + r*e) / 2^SG_BRADIX mod p
+// d, e in (-2p, p) -> d, e in (-2p, p)
+static void gfp_updatede_8x1w(__m512i *d, __m512i *e, const __m512i *t, const __m512i *vp)
+{
+  const __m512i u = t[0], v = t[1], q = t[2], r = t[3];
+  const __m512i vbmask = VSET1(SG_BMASK), vpinv = VSET1(SG_PINV);
+  __m512i cd, ce, md, me, sd, se;
+  int i;
+
+  // md, me are chosen such that (u*d + v*e + md*p) and (q*d + r*e + me*p) are
+  // divisible by 2^SG_BRADIX, and the results remain in (-2p, p) 
+  sd = VSRA(d[SG_NWORDS-1], 63); se = VSRA(e[SG_NWORDS-1], 63);
+  md = VADD(VAND(u, sd), VAND(v, se));
+  me = VADD(VAND(q, sd), VAND(r, se));
+
+  cd = VADD(VMULS(u, d[0]), VMULS(v, e[0]));
+  ce = VADD(VMULS(q, d[0]), VMULS(r, e[0]));
+  md = VSUB(md, VAND(VADD(VMUL(vpinv, cd), md), vbmask));
+  me = VSUB(me, VAND(VADD(VMUL(vpinv, ce), me), vbmask));
+  cd = VADD(cd, VMULS(vp[0], md)); 
+  ce = VADD(ce, VMULS(vp[0], me));
+  cd = VSRA(cd, SG_BRADIX); ce = VSRA(ce, SG_BRADIX);
+
+  for (i = 1; i < SG_NWORDS; i++) {
+    cd = VADD(cd, VADD(VADD(VMULS(u, d[i]), VMULS(v, e[i])), VMULS(vp[i], md)));
+    ce = VADD(ce, VADD(VADD(VMULS(q, d[i]), VMULS(r, e[i])), VMULS(vp[i], me)));
+    d[i-1] = VAND(cd, vbmask); cd = VSRA(cd, SG_BRADIX);
+    e[i-1] = VAND(ce, vbmask); ce = VSRA(ce, SG_BRADIX);
+  }
+
+  d[SG_NWORDS-1] = cd; e[SG_NWORDS-1] = ce;
+}
+
+// signed carry propagation, the top limb carries the sign
+static void gfp_carrysg_8x1w(__m512i *a)
+{
+  const __m512i vbmask = VSET1(SG_BMASK);
+  int i;
+
+  for (i = 0; i < SG_NWORDS-1; i++) {
+    a[i+1] = VADD(a[i+1], VSRA(a[i], SG_BRADIX));
+    a[i] = VAND(a[i], vbmask);
+  }
+}
+
+// field multiplicative inversion r = a^(-1) mod p with safegcd [BY19]
+// a is in Montgomery domain, e starts from R^2 so that r = (a*R^(-1))^(-1)*R 
+// a in [0, 2p) -> r in [0, p)
+void gfp_sginv_8x1w(htfe_t r, const htfe_t a)
+{
+  __m512i f[SG_NWORDS], g[SG_NWORDS], d[SG_NWORDS], e[SG_NWORDS];
+  __m512i vp[SG_NWORDS], t[4], delta = VSET1(1), s;
+  htfe_t b;
+  int i;
+
+  gfp_rdcp_8x1w(b, a);                  // g < f = p is required by the bound
+
+  // f = p, g = a, d = 0, e = R^2
+  for (i = 0; i < SG_NWORDS; i++) {
+    vp[i] = VSET1(ht_p[i]);
+    e[i]  = VSET1(ht_montR2[i]);
+    g[i]  = b[i];
+    f[i]  = vp[i];
+    d[i]  = VZERO;
+  }
+
+  // SG_NITERS*SG_BRADIX divsteps are enough for 511-bit f and g 
+  for (i = 0; i < SG_NITERS; i++) {
+    delta = gfp_divsteps_8x1w(t, delta, f[0], g[0]);
+    gfp_updatefg_8x1w(f, g, t);
+    gfp_updatede_8x1w(d, e, t, vp);
+  }
+
+  // now g = 0, f = +/-1 and d = +/-a^(-1) in (-2p, p)
+  s = VSRA(d[SG_NWORDS-1], 63);         // d = d + p if d < 0 
+  for (i = 0; i < SG_NWORDS; i++) d[i] = VADD(d[i], VAND(vp[i], s));
+  gfp_carrysg_8x1w(d);
+  s = VSRA(f[SG_NWORDS-1], 63);         // d = -d if f = -1 
+  for (i = 0; i < SG_NWORDS; i++) d[i] = VSUB(VXOR(d[i], s), s);
+  gfp_carrysg_8x1w(d);
+  s = VSRA(d[SG_NWORDS-1], 63);         // d = d + p if d < 0
+  for (i = 0; i < SG_NWORDS; i++) d[i] = VADD(d[i], VAND(vp[i], s));
+  gfp_carrysg_8x1w(d);
+  for (i = 0; i < HT_NWORDS; i++) r[i] = d[i];
+}
+
+// (8x1)-way constant-time Jacobi symbol with the optimized binary GCD [Por20]
+// a and b are non-negative radix-SG_BRADIX integers with SG_NWORDS limbs, b is
+// odd; each inner step is "if a is odd: if a < b: swap a and b; a = a - b", 
+// then "a = a/2", and 2*len(p)-1 steps bring (a, b) to (0, gcd(a, b))
+
+// approximations xa, xb of a, b for SG_BRADIX inner steps: with n = max(len(a),
+// len(b), 2*SG_BRADIX+2), the low SG_BRADIX bits are exact and the top 
+// SG_BRADIX+2 bits are the bits [n-SG_BRADIX-2, n) of a and b
+static void gfp_bgcdapprox_8x1w(__m512i *xa, __m512i *xb, const __m512i *a, const __m512i *b)
+{
+  const __m512i vbmask = VSET1(SG_BMASK);
+  __m512i wa, wb, m, x;
+  __mmask8 c;
+  int i, k;
+
+  // 64-bit windows of a and b whose top limb is the highest non-zero limb of 
+  // a|b, the sentinel bit 2*SG_BRADIX+1 stands for n >= 2*SG_BRADIX+2
+  wa = VOR(VOR(VSHL(a[2], 64-SG_BRADIX), VSHL(a[1], 64-2*SG_BRADIX)), VSHR(a[0], 3*SG_BRADIX-64));
+  wb = VOR(VOR(VSHL(b[2], 64-SG_BRADIX), VSHL(b[1], 64-2*SG_BRADIX)), VSHR(b[0], 3*SG_BRADIX-64));
+  m  = VSET1(1ULL<<(65-SG_BRADIX));
+  for (i = 3; i < SG_NWORDS; i++) {
+    x = VOR(a[i], b[i]); c = VTEST(x, x);
+    x = VOR(VOR(VSHL(a[i], 64-SG_BRADIX), VSHL(a[i-1], 64-2*SG_BRADIX)), VSHR(a[i-2], 3*SG_BRADIX-64));
+    wa = VMMOV(wa, c, x);
+    x = VOR(VOR(VSHL(b[i], 64-SG_BRADIX), VSHL(b[i-1], 64-2*SG_BRADIX)), VSHR(b[i-2], 3*SG_BRADIX-64));
+    wb = VMMOV(wb, c, x);
+    m  = VMMOV(m, c, VZERO);
+  }
+
+  // shift the windows left by the leading zeros of wa|wb|m (at most SG_BRADIX-1)
+  m = VOR(m, VOR(wa, wb));
+  for (k = 16; k > 0; k >>= 1) {
+    c = ~VTEST(m, VSET1(~0ULL<<(64-k)));
+    m = VMMOV(m, c, VSHL(m, k)); wa = VMMOV(wa, c, VSHL(wa, k)); wb = VMMOV(wb, c, VSHL(wb, k));
+  }
+
+  *xa = VOR(VAND(a[0], vbmask), VSHL(VSHR(wa, 62-SG_BRADIX), SG_BRADIX));
+  *xb = VOR(VAND(b[0], vbmask), VSHL(VSHR(wb, 62-SG_BRADIX), SG_BRADIX));
+}
+
+// SG_BRADIX inner steps on the approximations xa, xb and on the exact low 64 
+// bits la, lb of a, b 
+// -> the update matrix t = (f0, g0, f1, g1) scaled by 2^SG_BRADIX, and the sign
+//    flips of the Jacobi symbol (a/|b|) accumulated in bit 1 of *j
+static void gfp_bgcdsteps_8x1w(__m512i *t, __m512i *j, __m512i xa, __m512i xb, __m512i la, __m512i lb)
+{
+  __m512i f0 = VSET1(1), g0 = VZERO, f1 = VZERO, g1 = VSET1(1), x, jac = *j;
+  const __m512i one = VSET1(1);
+  __mmask8 c, o;
+  int i;
+
+  for (i = 0; i < SG_BRADIX; i++) {
+    // if a is odd and xa < xb: (a, b, f0, g0, f1, g1) = (b, a, f1, g1, f0, g0)
+    // (b/|a|) = -(a/|b|) if a = b = 3 mod 4 (a and b are never both negative)
+    o = VTEST(la, one);
+    c = o & VCMPGT(xb, xa);
+    x = xa; xa = VMMOV(xa, c, xb); xb = VMMOV(xb, c, x);
+    x = la; la = VMMOV(la, c, lb); lb = VMMOV(lb, c, x);
+    x = f0; f0 = VMMOV(f0, c, f1); f1 = VMMOV(f1, c, x);
+    x = g0; g0 = VMMOV(g0, c, g1); g1 = VMMOV(g1, c, x);
+    jac = VMXOR(jac, c, jac, VAND(la, lb));
+    // if a is odd: (a, f0, g0) = (a - b, f0 - f1, g0 - g1)
+    xa = VMSUB(xa, o, xa, xb); la = VMSUB(la, o, la, lb);
+    f0 = VMSUB(f0, o, f0, f1); g0 = VMSUB(g0, o, g0, g1);
+    // (a, f1, g1) = (a/2, 2f1, 2g1)
+    // (a/2 / |b|) = -(a/|b|) if b = 3, 5 mod 8
+    xa = VSHR(xa, 1); la = VSHR(la, 1); f1 = VSHL(f1, 1); g1 = VSHL(g1, 1);
+    jac = VXOR(jac, VXOR(lb, VSHR(lb, 1)));
+  }
+
+  t[0] = f0; t[1] = g0; t[2] = f1; t[3] = g1; *j = jac;
+}
+
+// Jacobi symbol (a/b) of the non-negative radix-SG_BRADIX integers a and b (odd)
+// with gcd(a, b) = 1, a and b are destroyed and end as (0, 1) after JC_NITERS 
+// iterations, the bound is proven in [Por20]
+// if (a/b) = 1, return 1; if (a/b) = -1, return 0.
+static __m512i gfp_jacobisg_8x1w(__m512i *a, __m512i *b)
+{
+  __m512i t[4], j = VZERO, xa, xb, la, lb, s;
+  int i, k;
+
+  for (i = 0; i < JC_NITERS; i++) {
+    gfp_bgcdapprox_8x1w(&xa, &xb, a, b);
+    la = VOR(VOR(a[0], VSHL(a[1], SG_BRADIX)), VSHL(a[2], 2*SG_BRADIX));
+    lb = VOR(VOR(b[0], VSHL(b[1], SG_BRADIX)), VSHL(b[2], 2*SG_BRADIX));
+    gfp_bgcdsteps_8x1w(t, &j, xa, xb, la, lb);
+    gfp_updatefg_8x1w(a, b, t);
+    // (a, b) = (|a|, |b|), (-a/|b|) = -(a/|b|) if |b| = 3 mod 4
+    s = VSRA(b[SG_NWORDS-1], 63);
+    for (k = 0; k < SG_NWORDS; k++) b[k] = VSUB(VXOR(b[k], s), s);
+    gfp_carrysg_8x1w(b);
+    s = VSRA(a[SG_NWORDS-1], 63);
+    for (k = 0; k < SG_NWORDS; k++) a[k] = VSUB(VXOR(a[k], s), s);
+    gfp_carrysg_8x1w(a);
+    j = VXOR(j, VAND(s, b[0]));
+  }
+
+  // now b = 1, so the symbol is given by bit 1 of j
+  j = VSHR(VAND(j, VSET1(2)), 1);       // j is 0 (symbol 1) or 1 (symbol -1)
+
+  return VXOR(j, VSET1(1));
+}
+
+// check whether the field element is a square in the field with the Jacobi
+// symbol computed by the optimized binary GCD, zero is not a square as in 
+// Euler's criterion
+// if a is     a square in the field, return 1; 
+// if a is not a square in the field, return 0.
+__m512i gfp_jacobi_8x1w(const htfe_t a)
+{
+  __m512i x[SG_NWORDS], y[SG_NWORDS], r;
+  htfe_t b;
+  int i;
+
+  gfp_rdcp_8x1w(b, a);                  // R = 2^k with even k, so (aR/p) = (a/p) 
+
+  // x = a, y = p
+  for (i = 0; i < SG_NWORDS; i++) {
+    x[i] = b[i];
+    y[i] = VSET1(ht_p[i]);
+  }
+
+  r = gfp_jacobisg_8x1w(x, y);
+
+  return VAND(r, VXOR(gfp_iszero_8x1w(b), VSET1(1)));
+}
+
+// check whether the field element is a square in the field  
+// if a is     a square in the field, return 1; 
+// if a is not a square in the field, return 0.
+__m512i gfp_issqr_8x1w(const htfe_t a)
+{
+#ifdef ISSQR_JACOBI
+  return gfp_jacobi_8x1w(a);
+#else
+  return gfp_euler_8x1w(a);
+#endif
+}
+
 // -----------------------------------------------------------------------------
 // other prime-field operations 
 
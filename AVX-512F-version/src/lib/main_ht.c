@@ -20,6 +20,10 @@ extern uint64_t read_tsc();
 #define ITER_M 10000
 #define ITER_S 1000
 
+#ifdef RNG_FIXED
+static const uint8_t rng_fixed[32] = { 0 };
+#endif
+
 #define LOAD_CACHE(X, ITER) for (i = 0; i < (ITER); i++) (X)
 
 #define MEASURE_TIME(X, ITER)                         \
@@ -124,7 +128,7 @@ void test_action()
   puts("\n* Public Keys:");  
   action(&vPK, vsk, &vE);
 
-  gfp_inv_8x1w(t0, vPK.z);
+  gfp_sginv_8x1w(t0, vPK.z);
   gfp_mul_8x1w(t1, vPK.y, t0);
   gfp_mont2num_8x1w(t0, t1);
 
@@ -166,7 +170,7 @@ void test_action()
   puts("\n* Shared Secrets:");  
   action(&vSS, vsk, &vPK);
 
-  gfp_inv_8x1w(t0, vSS.z);
+  gfp_sginv_8x1w(t0, vSS.z);
   gfp_mul_8x1w(t1, vSS.y, t0);
   gfp_mont2num_8x1w(t0, t1);
 
@@ -256,7 +260,7 @@ void test_multi_actions(int round)
     // keypair generation
     action(&vPK, vsk, &vE);
 
-    gfp_inv_8x1w(t0, vPK.z);
+    gfp_sginv_8x1w(t0, vPK.z);
     gfp_mul_8x1w(t1, vPK.y, t0);
     gfp_mont2num_8x1w(t0, t1);
 
@@ -272,7 +276,7 @@ void test_multi_actions(int round)
     // shared secret computation
     action(&vSS, vsk, &vPK);
 
-    gfp_inv_8x1w(t0, vSS.z);
+    gfp_sginv_8x1w(t0, vSS.z);
     gfp_mul_8x1w(t1, vSS.y, t0);
     gfp_mont2num_8x1w(t0, t1);
 
@@ -302,18 +306,12 @@ void test_multi_actions(int round)
 
 void timing_action()
 {
-  uint8_t sk_a[N], sk_b[N], sk_c[N], sk_d[N], sk_e[N], sk_f[N], sk_g[N], sk_h[N];
   htpoint vE, vPK;
   __m512i vsk[N];
   int i;
 
   // randomly generate eight private keys 
-  random_sk(sk_a); random_sk(sk_b); random_sk(sk_c); random_sk(sk_d);
-  random_sk(sk_e); random_sk(sk_f); random_sk(sk_g); random_sk(sk_h);
-
-  // initialize AVX512 vector of private key
-  for (i = 0; i < N; i++) 
-    vsk[i] = set_vector(sk_h[i], sk_g[i], sk_f[i], sk_e[i], sk_d[i], sk_c[i], sk_b[i], sk_a[i]);
+  random_sk_8x1w(&vsk, NULL, 1);
 
   for (i = 0; i < HT_NWORDS; i++) {
     vE.y[i] = VSET1(E[0][i]);
@@ -327,10 +325,338 @@ void timing_action()
   printf("* GROUP ACTION : %ld cycles\n", diff_cycles);
 }
 
+void timing_exp()
+{
+  htfe_t a, r;
+  uint64_t old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) a[i] = VSET1(E[0][i]);
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(gfp_pow_8x1w(r, a, u64_psub2), 100);
+  MEASURE_TIME(gfp_pow_8x1w(r, a, u64_psub2), ITER_S);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_inv_8x1w(r, a), ITER_S);
+  printf("* INVERSION    : %ld -> %ld cycles (%ld saved)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+  MEASURE_TIME(gfp_sginv_8x1w(r, a), ITER_S);
+  printf("* SAFEGCD INV  : %ld -> %ld cycles (%ld saved)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+
+  MEASURE_TIME(gfp_pow_8x1w(r, a, u64_pdiv2), ITER_S);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_euler_8x1w(a), ITER_S);
+  printf("* EULER        : %ld -> %ld cycles (%ld saved per elligator)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+  MEASURE_TIME(gfp_jacobi_8x1w(a), ITER_S);
+  printf("* JACOBI       : %ld -> %ld cycles (%ld saved per elligator)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+}
+
+// the scalar conversion of eight radix-64 integers to radix-29 and back
+static void loadstore_scalar(uint64_t (*r)[8], htfe_t b, const uint64_t (*a)[8])
+{
+  uint32_t a29[8][HT_NWORDS], a32[8][16];
+  int i;
+
+  for (i = 0; i < 8; i++) {
+    mpi_conv_64to32(a32[i], a[i]);
+    mpi_conv_32to29(a29[i], a32[i], HT_NWORDS, 16);
+  }
+  for (i = 0; i < HT_NWORDS; i++) 
+    b[i] = set_vector(a29[7][i], a29[6][i], a29[5][i], a29[4][i], a29[3][i], a29[2][i], a29[1][i], a29[0][i]);
+  for (i = 0; i < 8; i++) {
+    get_channel_8x1w(a29[i], b, i);
+    mpi_conv_29to32(a32[i], a29[i], 16, HT_NWORDS);
+    mpi_conv_32to64(r[i], a32[i]);
+  }
+}
+
+// the SIMD load/store gives the same radix-29 element as the scalar conversion
+void test_loadstore()
+{
+  uint64_t a[8][8], r0[8][8], r1[8][8];
+  htfe_t b0, b1;
+  int wrong = 0;
+
+  randombytes(a, sizeof(a));
+  loadstore_scalar(r0, b0, (const uint64_t (*)[8])a);
+  mpi_load_8x1w(b1, (const uint64_t (*)[8])a);
+  mpi_store_8x1w(r1, b1);
+  wrong |= memcmp(b0, b1, sizeof(htfe_t));
+  wrong |= memcmp(r0, a, sizeof(a));
+  wrong |= memcmp(r1, a, sizeof(a));
+
+  if (wrong) printf("Load/store 8x1w   : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Load/store 8x1w   : \x1b[32mPASS!\x1b[0m\n");
+}
+
+void timing_loadstore()
+{
+  uint64_t a[8][8] = {0}, r[8][8];
+  htfe_t b;
+  uint64_t old_cycles;
+  int i;
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(loadstore_scalar(r, b, (const uint64_t (*)[8])a), 100);
+  MEASURE_TIME(loadstore_scalar(r, b, (const uint64_t (*)[8])a), ITER_L);
+  old_cycles = diff_cycles;
+  MEASURE_TIME((mpi_load_8x1w(b, (const uint64_t (*)[8])a), mpi_store_8x1w(r, b)), ITER_L);
+  printf("* LOAD/STORE   : %ld -> %ld cycles (radix-64 -> 29 -> 64, 8 elements)\n", old_cycles, diff_cycles);
+}
+
+// read from the kernel, as randombytes() did before the DRBG
+static void urandom_read(void *r, size_t len)
+{
+  static int fd = -1;
+  ssize_t n;
+
+  if ((fd < 0) && (0 > (fd = open("/dev/urandom", O_RDONLY)))) exit(1);
+  for (size_t i = 0; i < len; i += n)
+    if (0 >= (n = read(fd, (char *)r + i, len-i))) exit(2);
+}
+
+// the ChaCha20 core gives the block of RFC 8439 (Sect. 2.3.2) and its successors
+// in the next lanes, and a fixed seed gives the same bytes however they are read
+void test_rng()
+{
+  const uint32_t out[16] = {
+    0xe4e7f110, 0x15593bd1, 0x1fdd0f50, 0xc47120a3, 0xc7f4d1c7, 0x0368c033, 0x9aaa2204, 0x4e6cd4c3, 
+    0x466482d2, 0x09aa9f07, 0x05d7c214, 0xa2028bd9, 0xd19c12b5, 0xb94e16de, 0xe883d0cb, 0x4e3c50a2, };
+  const uint32_t nonce[3] = { 0x09000000, 0x4a000000, 0x00000000 };
+  uint32_t key[8], w0[16][RNG_LANES], w1[16][RNG_LANES];
+  uint8_t seed[32] = { 0 }, a[3000], b[3000];
+  __m512i x[16];
+  int i, k, wrong = 0;
+
+  for (i = 0; i < 8; i++) key[i] = 0x03020100 + 0x04040404*i;   // key = 00:01:...:1f
+  chacha20_16x1w(x, key, nonce, 1);
+  memcpy(w0, x, sizeof(w0));
+  for (i = 0; i < 16; i++) wrong |= (w0[i][0] != out[i]);
+  chacha20_16x1w(x, key, nonce, RNG_LANES-1);
+  memcpy(w1, x, sizeof(w1));
+  for (i = 0; i < 16; i++) wrong |= (w0[i][RNG_LANES-2] != w1[i][0]);
+
+  rng_seed(seed);
+  randombytes(a, sizeof(a));
+  rng_seed(seed);
+  for (i = 0, k = 1; i < sizeof(b); i += k, k = 2*k+1) randombytes(&b[i], (i+k < sizeof(b)) ? k : sizeof(b)-i);
+  wrong |= memcmp(a, b, sizeof(a));
+  memset(b, 0, sizeof(b));
+  wrong |= !memcmp(a, b, sizeof(a));
+  rng_seed(NULL);
+
+  if (wrong) printf("ChaCha20 DRBG     : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("ChaCha20 DRBG     : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// the Jacobi symbol agrees with Euler's criterion on random elements (< 2^511)
+// and on 0, 1, p-1 and p
+void test_jacobi()
+{
+  uint64_t x[HT_NWORDS][8];
+  htfe_t a;
+  __m512i r, s;
+  int i, k, wrong = 0;
+
+  for (k = 0; k < 2000; k++) {
+    randombytes(x, sizeof(x));
+    for (i = 0; i < HT_NWORDS; i++) a[i] = VAND(VLOAD(x[i]), VSET1(HT_BMASK));
+    a[HT_NWORDS-1] = VAND(a[HT_NWORDS-1], VSET1((1ULL<<(511-HT_BRADIX*(HT_NWORDS-1)))-1));
+    if (k == 0) {
+      for (i = 0; i < HT_NWORDS; i++) 
+        a[i] = VSET(0, 0, 0, 0, ht_p[i], ht_p[i]-(i == 0), (i == 0), 0);
+    }
+    r = gfp_jacobi_8x1w(a);
+    s = gfp_euler_8x1w(a);
+    wrong |= VTEST(VXOR(r, s), VXOR(r, s));
+  }
+
+  if (wrong) printf("Jacobi symbol     : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Jacobi symbol     : \x1b[32mPASS!\x1b[0m\n");
+}
+
+void timing_rng()
+{
+  uint64_t u[8], old_cycles;
+  int i;
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(urandom_read(u, sizeof(u)), 100);
+  MEASURE_TIME(urandom_read(u, sizeof(u)), ITER_M);
+  old_cycles = diff_cycles;
+  LOAD_CACHE(randombytes(u, sizeof(u)), 100);
+  MEASURE_TIME(randombytes(u, sizeof(u)), ITER_M);
+  printf("* RANDOMBYTES  : %ld -> %ld cycles (64 bytes)\n", old_cycles, diff_cycles);
+}
+
+// the exponents of the batch sampler are in the ranges of random_sk(), and the
+// per-key form is the lane-packed one
+void test_keygen()
+{
+  __m512i vsk[2][N];
+  uint8_t sk[16][N], sk0[N];
+  int i, k, e, wrong = 0, hit[N][2] = { 0 };
+
+  random_sk_8x1w(vsk, sk, 2);
+  for (k = 0; k < 16; k++) {
+    for (i = 0; i < N; i++) {
+      wrong |= (sk[k][i] != ((uint64_t *)&vsk[k/8][i])[k%8]);
+      e = (2*(sk[k][i]&1)-1)*(sk[k][i]>>1);
+      wrong |= ((sk[k][i] >> 1) == 0) && !(sk[k][i] & 1);   // 0 is always positive
+      wrong |= (e < -B[i]) || (e > B[i]);
+      hit[i][e > 0] = 1;
+    }
+  }
+  // a negative and a positive exponent in every position (fails with a 
+  // negligible probability)
+  for (i = 0; i < N; i++) wrong |= !(hit[i][0] & hit[i][1]);
+  // random_sk() maps 0 the same way
+  random_sk(sk0);
+  for (i = 0; i < N; i++) wrong |= ((sk0[i] >> 1) == 0) && !(sk0[i] & 1);
+
+  if (wrong) printf("Key sampler 8x1w  : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Key sampler 8x1w  : \x1b[32mPASS!\x1b[0m\n");
+}
+
+void timing_keygen()
+{
+  __m512i vsk[N];
+  uint8_t sk[8][N];
+  uint64_t old_cycles;
+  int i, k;
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  start_cycles = read_tsc();
+  for (i = 0; i < ITER_S; i++) {
+    for (k = 0; k < 8; k++) random_sk(sk[k]);
+    for (k = 0; k < N; k++) 
+      vsk[k] = set_vector(sk[7][k], sk[6][k], sk[5][k], sk[4][k], sk[3][k], sk[2][k], sk[1][k], sk[0][k]);
+  }
+  end_cycles = read_tsc();
+  old_cycles = (end_cycles-start_cycles)/ITER_S;
+  MEASURE_TIME(random_sk_8x1w(&vsk, sk, 1), ITER_S);
+  printf("* KEYGEN       : %ld -> %ld cycles (8 secret keys)\n", old_cycles, diff_cycles);
+}
+
+// the first-round points on the base curve: T+ lies on E and T- on its twist, 
+// and both have the order of the product of the primes of BATCHES[1]
+void test_basepoints()
+{
+  htpoint vE, T[2], G;
+  htfe_t t0, t1, t2;
+  __m512i r;
+  const int m = 1 % NUMBA;
+  int i, j, k, wrong = 0;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+    for (k = 0; k < 2; k++) {
+      T[k].y[i] = VSET1(ET[k][i]);
+      T[k].z[i] = VSET1(ht_montR[i]);
+    }
+  }
+  wrong |= !curve_iseql_8x1w(&vE, E[0], E[1]);
+  wrong |= curve_iseql_8x1w(&vE, E[1], E[0]);
+
+  for (k = 0; k < 2; k++) {
+    // Montgomery X = z+y, Z = z-y, then X*Z*(X^2+Z^2) is a square iff x^3+x is
+    gfp_add_8x1w(t0, T[k].z, T[k].y);
+    gfp_sub_8x1w(t1, T[k].z, T[k].y);
+    gfp_mul_8x1w(t2, t0, t1);
+    gfp_sqr_8x1w(t0, t0);
+    gfp_sqr_8x1w(t1, t1);
+    gfp_add_8x1w(t0, t0, t1);
+    gfp_mul_8x1w(t2, t2, t0);
+    r = gfp_issqr_8x1w(t2);
+    wrong |= (VADDRDC(r) != 8*k);
+
+    for (i = 0; i < SIZEBA[m]; i++) {
+      point_copy_8x1w(&G, &T[k]);
+      for (j = 0; j < SIZEBA[m]; j++)
+        if (j != i) yMUL_8x1w(&G, &G, &vE, BATCHES[m][j]);
+      r = point_isinf_8x1w(&G);
+      wrong |= (VORRDC(r) != 0);
+      yMUL_8x1w(&G, &G, &vE, BATCHES[m][i]);
+      r = point_isinf_8x1w(&G);
+      wrong |= (VADDRDC(r) != 8);
+    }
+  }
+
+  if (wrong) printf("Base curve points : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Base curve points : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// the first round on the base curve: Elligator and the cofactor clearing over 
+// COMPBA[1] against loading the precomputed points
+static void basepoints_elligator(htpoint_t T0, htpoint_t T1, const htpoint_t A)
+{
+  const int m = 1 % NUMBA;
+  int i;
+
+  elligator_8x1w(T1, T0, A);
+  yDBL_8x1w(T0, T0, A); 
+  yDBL_8x1w(T0, T0, A);
+  yDBL_8x1w(T1, T1, A);
+  yDBL_8x1w(T1, T1, A); 
+  for (i = 0; i < SICOBA[m]; i++) {
+    yMUL_8x1w(T0, T0, A, COMPBA[m][i]); 
+    yMUL_8x1w(T1, T1, A, COMPBA[m][i]);
+  }
+}
+
+static void basepoints_table(htpoint_t T0, htpoint_t T1)
+{
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    T0->y[i] = VSET1(ET[0][i]);
+    T1->y[i] = VSET1(ET[1][i]);
+    T0->z[i] = T1->z[i] = VSET1(ht_montR[i]);
+  }
+}
+
+void timing_basepoints()
+{
+  htpoint vE, T0, T1;
+  uint64_t old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(basepoints_elligator(&T0, &T1, &vE), 10);
+  MEASURE_TIME(basepoints_elligator(&T0, &T1, &vE), ITER_S);
+  old_cycles = diff_cycles;
+  LOAD_CACHE(basepoints_table(&T0, &T1), 100);
+  MEASURE_TIME(basepoints_table(&T0, &T1), ITER_L);
+  printf("* BASE POINTS  : %ld -> %ld cycles (first round on E)\n", old_cycles, diff_cycles);
+}
+
 int main() 
 {
+  test_rng();
+  test_jacobi();
+#ifdef RNG_FIXED
+  rng_seed(rng_fixed);                  // reproducible runs
+#endif
   test_action();
+  test_keygen();
+  test_basepoints();
+  test_loadstore();
   // test_multi_actions(1000);
+  timing_rng();
+  timing_keygen();
+  timing_exp();
+  timing_basepoints();
+  timing_loadstore();
   timing_action();
   
   return 0;
@@ -7,14 +7,151 @@
  *******************************************************************************
  */
 
+#include <string.h>
+#include <errno.h>
+#include <sys/random.h>
+#include <pthread.h>
 #include "rng.h"
 
-void randombytes(void *r, size_t len)
+// A buffered ChaCha20 DRBG. Every thread has its own state, seeded with 32 bytes 
+// from getrandom(2) at its first request. A refill computes RNG_LANES ChaCha20 
+// blocks at once (one block per 32-bit lane), takes the first 32 bytes as the 
+// next key (so that the bytes already handed out cannot be recomputed) and serves 
+// the requests from the rest; the key is reseeded from the kernel only every 
+// RNG_RESEED refills. rng_seed() gives a fixed seed and turns the reseeding off.
+// A child made by fork() starts with a copy of the state, so (unless the seed is
+// fixed) it reseeds from the kernel before its first byte instead of repeating
+// the output of the parent.
+
+#define RNG_BUFLEN (64*RNG_LANES)     // bytes of keystream per refill
+#define RNG_RESEED 4096               // refills between two reseeds from the kernel
+
+typedef struct {
+  uint32_t key[8];
+  uint8_t buf[RNG_BUFLEN];
+  size_t pos;                         // bytes of buf that are used up 
+  uint64_t refills;
+  unsigned forks;                     // rng_forks when the state was last seeded
+  int seeded, fixed;
+} rng_state;
+
+static __thread rng_state rng;        // per-thread state
+
+// number of fork()s this process descends from, counted by the child
+static unsigned rng_forks;
+static pthread_once_t rng_once = PTHREAD_ONCE_INIT;
+
+static void rng_atfork_child()
+{
+  rng_forks++;
+}
+
+static void rng_atfork()
+{
+  if (pthread_atfork(NULL, NULL, rng_atfork_child)) exit(3);
+}
+
+// read from the kernel with getrandom(2), which needs no file descriptor (so 
+// that the threads of a pool leave none open when they exit)
+static void urandom_read(void *r, size_t len)
 {
-  static int fd = -1;
   ssize_t n;
 
-  if ((fd < 0) && (0 > (fd = open("/dev/urandom", O_RDONLY)))) exit(1);
   for (size_t i = 0; i < len; i += n)
-    if (0 >= (n = read(fd, (char *)r + i, len-i))) exit(2);
+    if (0 >= (n = getrandom((char *)r + i, len-i, 0))) {
+      if ((n < 0) && (errno == EINTR)) n = 0;
+      else exit(2);
+    }
+}
+
+#define QROUND(A, B, C, D)                         \
+  A = VADD32(A, B); D = VROL32(VXOR(D, A), 16);    \
+  C = VADD32(C, D); B = VROL32(VXOR(B, C), 12);    \
+  A = VADD32(A, B); D = VROL32(VXOR(D, A), 8);     \
+  C = VADD32(C, D); B = VROL32(VXOR(B, C), 7)
+
+// RNG_LANES ChaCha20 blocks (RFC 8439) with the block counters ctr, ctr+1, ...:
+// lane b of r[i] is the word i of the block ctr+b
+void chacha20_16x1w(__m512i *r, const uint32_t *key, const uint32_t *nonce, const uint32_t ctr)
+{
+  __m512i x[16];
+  int i;
+
+  x[0] = VSET132(0x61707865); x[1] = VSET132(0x3320646e);
+  x[2] = VSET132(0x79622d32); x[3] = VSET132(0x6b206574);
+  for (i = 0; i < 8; i++) x[i+4] = VSET132(key[i]);
+  x[12] = VADD32(VSET132(ctr), _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+  for (i = 0; i < 3; i++) x[i+13] = VSET132(nonce[i]);
+
+  for (i = 0; i < 16; i++) r[i] = x[i];
+  for (i = 0; i < 10; i++) {
+    QROUND(r[0], r[4], r[ 8], r[12]);   // column rounds
+    QROUND(r[1], r[5], r[ 9], r[13]);
+    QROUND(r[2], r[6], r[10], r[14]);
+    QROUND(r[3], r[7], r[11], r[15]);
+    QROUND(r[0], r[5], r[10], r[15]);   // diagonal rounds
+    QROUND(r[1], r[6], r[11], r[12]);
+    QROUND(r[2], r[7], r[ 8], r[13]);
+    QROUND(r[3], r[4], r[ 9], r[14]);
+  }
+  for (i = 0; i < 16; i++) r[i] = VADD32(r[i], x[i]);
+}
+
+// compute the next RNG_BUFLEN bytes of keystream and rekey
+static void rng_refill()
+{
+  const uint32_t nonce[3] = { 0, 0, 0 };
+  __m512i x[16];
+  uint32_t fresh[8];
+  int i;
+
+  if (!rng.seeded) {
+    pthread_once(&rng_once, rng_atfork);
+    urandom_read(rng.key, sizeof(rng.key));
+    rng.seeded = 1;
+    rng.forks = rng_forks;
+  }
+  else if (!rng.fixed && (++rng.refills % RNG_RESEED == 0)) {
+    urandom_read(fresh, sizeof(fresh));
+    for (i = 0; i < 8; i++) rng.key[i] ^= fresh[i];
+  }
+
+  // a key is never used twice, so the counter and nonce can start from zero
+  chacha20_16x1w(x, rng.key, nonce, 0);
+  for (i = 0; i < 16; i++) VSTORE(&rng.buf[sizeof(__m512i)*i], x[i]);
+
+  memcpy(rng.key, rng.buf, sizeof(rng.key));
+  memset(rng.buf, 0, sizeof(rng.key));
+  rng.pos = sizeof(rng.key);
+}
+
+void randombytes(void *r, size_t len)
+{
+  size_t n;
+
+  // forked since the last seeding: drop the state shared with the parent 
+  if (rng.seeded && !rng.fixed && (rng.forks != rng_forks)) rng.seeded = 0;
+
+  while (len > 0) {
+    if (!rng.seeded || (rng.pos == RNG_BUFLEN)) rng_refill();
+    n = (len < RNG_BUFLEN-rng.pos) ? len : RNG_BUFLEN-rng.pos;
+    memcpy(r, &rng.buf[rng.pos], n);
+    memset(&rng.buf[rng.pos], 0, n);  // a byte is handed out only once
+    rng.pos += n;
+    r = (uint8_t *)r + n;
+    len -= n;
+  }
+}
+
+// seed the DRBG of the calling thread with the 32-byte seed; the output is then 
+// the same in every run (e.g., for benchmarks), and is never reseeded from the
+// kernel. seed = NULL goes back to seeding from the kernel.
+void rng_seed(const uint8_t *seed)
+{
+  memset(&rng, 0, sizeof(rng));
+  if (seed) {
+    memcpy(rng.key, seed, sizeof(rng.key));
+    rng.seeded = rng.fixed = 1;
+    rng.pos = RNG_BUFLEN;
+  }
 }
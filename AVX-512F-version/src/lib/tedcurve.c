@@ -107,6 +107,28 @@ __m512i point_isinf_8x1w(const htpoint_t P)
   return r;      
 }
 
+// check whether the curve A is the public curve (y:z) in all eight lanes, i.e.
+// whether yA*z == zA*y; the curves are public, so a plain flag is returned. 
+int curve_iseql_8x1w(const htpoint_t A, const uint32_t *y, const uint32_t *z)
+{
+  htfe_t t0, t1;
+  __m512i r;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    t0[i] = VSET1(z[i]);
+    t1[i] = VSET1(y[i]);
+  }
+
+  gfp_mul_8x1w(t0, A->y, t0);      // t0 = yA*z
+  gfp_mul_8x1w(t1, A->z, t1);      // t1 = zA*y
+  gfp_sub_8x1w(t0, t0, t1);        // t0 = yA*z - zA*y
+  gfp_rdcp_8x1w(t0, t0);           // reduce t0 to [0, p)
+  r = gfp_iszero_8x1w(t0);
+
+  return VTEST(r, r) == 0xFF;
+}
+
 // (8x1)-way y-coordinate doubling R = [2]P on twisted Edwards curve,
 // which is very similar to x-coordinate doubling on Montgomery curve. 
 // NOTE: A->y = A24plus = a, A->z = C24 = a-d
@@ -221,7 +243,6 @@ void elligator_8x1w(htpoint_t Tplus, htpoint_t Tminus, const htpoint_t A)
 {
   htfe_t tc, t0, t1, c0, c1, alpha, vu, vR;;
   uint64_t u64[8][8];
-  uint32_t u32[8][16], u[8][HT_NWORDS];
   __m512i m;
   int i;
  
@@ -234,12 +255,10 @@ void elligator_8x1w(htpoint_t Tplus, htpoint_t Tminus, const htpoint_t A)
     do {
       fp_random(u64[i]);
     } while (mpi64_compare(u64[i], u64_pdiv2) > 0);// repeat if u > (p-1)/2 
-    mpi_conv_64to32(u32[i], u64[i]);               // convert to radix-32
-    mpi_conv_32to29(u[i], u32[i], HT_NWORDS, 16);  // convert to radix-29      
   }
+  mpi_load_8x1w(vu, u64);                          // convert to radix-29
 
   for (i = 0; i < HT_NWORDS; i++) { 
-    vu[i] = set_vector(u[7][i], u[6][i], u[5][i], u[4][i], u[3][i], u[2][i], u[1][i], u[0][i]);
     vR[i] = VSET1(ht_montR[i]);
   }
 
@@ -10,6 +10,10 @@
 #include "action.h"
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+
+// the (8x1)-way unbatched component hands over once fewer tails are left
+#define TAILMIN 4
 
 // cmove for small 7-bit integer 
 static void u8_cmove(uint8_t *r, const uint8_t a, const uint8_t b)
@@ -78,6 +82,7 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A, const
   uint8_t ba[N], sizeba = 0, compba[N], sicoba = 0, lastiso;
   uint8_t e[N], bc, ec = 0, fnsh[N] = { 0 }, isocnt[N] = { 0 };
   llpoint_t A0, T0, T1, G0, G1, K[HLMAX];
+  llpoint_t *R[2] = { &T0, &T1 };
   int total = 0, i, j, sum = 0;
 
   // Initialize variables for computing CSIDH class group action.
@@ -131,8 +136,7 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A, const
           yISOG_2x4w(K, A0, G0, A0, ba[i]);
 
           if (ba[i] != lastiso) {
-            yEVAL_2x4w(T0, T0, K, ba[i]);
-            yEVAL_2x4w(T1, T1, K, ba[i]);
+            yEVALmulti_2x4w(R, R, K, 2, ba[i]);
 
             yMUL_2x4w(T1, T1, A0, ba[i]);         
           }
@@ -142,6 +146,8 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A, const
           total += 1;
         }
         else {
+          // T0 keeps its factor l when only G1 is the point at infinity
+          yMUL_2x4w(T0, T0, A0, ba[i]);
           yMUL_2x4w(T1, T1, A0, ba[i]);
         }
 
@@ -164,8 +170,11 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
   uint8_t ba[NUMBA][MAXSIZEBA], sizeba[NUMBA], compba[NUMBA][N], sicoba[NUMBA], lastiso[NUMBA];
   uint8_t fnsh[N] = { 0 }, isocnt[N] = { 0 };
   __m512i ec = VZERO, inf, bc, vone = VSET1(1), t, x;  
-  htpoint A0, A1, T0, T1, G0, G1, K[HLMAX];
-  int count = 0, total = 0, i, j, m = 0, numba = NUMBA, n_inf;
+  htpoint A0, A1, T0, T1, G0, G1;
+#ifndef ISOG_FUSED
+  htpoint K[HLMAX];
+#endif
+  int count = 0, total = 0, i, j, m = 0, numba = NUMBA, first, n_inf;
 
   // Initialize SIMBA variables. 
   memcpy(ba, BATCHES, N);
@@ -176,6 +185,7 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
 
   // Initialize variables for computing CSIDH class group action.
   point_copy_8x1w(&A0, A);
+  first = point_first_8x1w(&T0, &T1, A);  // on the base curve or a cached one
   memcpy(isocnt, B, N);
 
   while (total < NUMISO) {
@@ -200,15 +210,19 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
       }
     }
 
-    elligator_8x1w(&T1, &T0, &A0);
-    yDBL_8x1w(&T0, &T0, &A0); 
-    yDBL_8x1w(&T0, &T0, &A0);
-    yDBL_8x1w(&T1, &T1, &A0);
-    yDBL_8x1w(&T1, &T1, &A0); 
-
-    for (i = 0; i < sicoba[m]; i++) {
-      yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
-      yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+    // the first round on the base curve or on a cached curve starts from the
+    // points of point_first_8x1w()
+    if (count || !first) {
+      elligator_8x1w(&T1, &T0, &A0);
+      yDBL_8x1w(&T0, &T0, &A0); 
+      yDBL_8x1w(&T0, &T0, &A0);
+      yDBL_8x1w(&T1, &T1, &A0);
+      yDBL_8x1w(&T1, &T1, &A0); 
+
+      for (i = 0; i < sicoba[m]; i++) {
+        yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
+        yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+      }
     }
 
     for (i = 0; i < sizeba[m]; i++) {
@@ -232,6 +246,7 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
           //////////////////////////////////////////////////////////
           // extra-dummy
           htpoint A1, A2, T2, T3, T4, T5;
+          htpoint *R[2] = { &T2, &T3 };
 
           point_copy_8x1w(&A1, &A0);
           point_copy_8x1w(&A2, &A0);
@@ -240,15 +255,23 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
           point_copy_8x1w(&T4, &T0);
           point_copy_8x1w(&T5, &T1);
 
+#ifdef ISOG_FUSED
+          // one pass over the kernel multiples, T2 and T3 are pushed in place
+          if (ba[m][i] != lastiso[m]) {
+            yISOGEVAL_8x1w(&A1, R, NULL, &G0, &A0, R, 2, ba[m][i]);
+            yMUL_8x1w(&T3, &T3, &A1, ba[m][i]);
+          }
+          else yISOGEVAL_8x1w(&A1, NULL, NULL, &G0, &A0, NULL, 0, ba[m][i]);
+#else
           yISOG_8x1w(K, &A1, &G0, &A0, ba[m][i]);
 
           if (ba[m][i] != lastiso[m]) {
 
-            yEVAL_8x1w(&T2, &T2, K, ba[m][i]);
-            yEVAL_8x1w(&T3, &T3, K, ba[m][i]);
+            yEVALmulti_8x1w(R, R, K, 2, ba[m][i]);
             
             yMUL_8x1w(&T3, &T3, &A1, ba[m][i]);
           }
+#endif
           t = VSHR(ec, 1);
           t = VSUB(t, VXOR(bc, vone));
           t = VXOR(t, bc);
@@ -294,118 +317,306 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
   point_copy_8x1w(C, &A0);
 }
 
-// The complete CSIDH group action using the combined method.  
-void action(htpoint_t C, const __m512i *sk, const htpoint_t A)
+// One round of the unbatched component on 8 lanes: every lane works on its own
+// leftover isogenies (visocnt), and a lane that has no isogeny of l_i left 
+// computes a dummy one in the round, like a lane at infinity. 
+static void tail_round_8x1w(htpoint_t A0, __m512i *visocnt, __m512i *e)
 {
-  __m512i visocnt[N], e[N];
-  htpoint A0;
-  int i;
+  uint8_t ba[N], compba[N], sizeba = 0, sicoba = 0, lastiso = 0;
+  __m512i ec = VZERO, inf, bc, vone = VSET1(1), t, x;
+  htpoint A1, A2, T0, T1, T2, T3, T4, T5, G0, G1;
+  htpoint *R[2] = { &T2, &T3 };
+#ifndef ISOG_FUSED
+  htpoint K[HLMAX];
+#endif
+  int i, j;
+
+  // the primes still needed by a lane (public information)
+  for (i = 0; i < N; i++) {
+    if (VTEST(visocnt[i], visocnt[i])) {
+      lastiso = i;
+      ba[sizeba++] = i;
+    }
+    else compba[sicoba++] = i;
+  }
 
-  // Initialize the vectorized isogeny counter.
-  for (i = 0; i < N; i++) visocnt[i] = VSET1(B[i]);
+  elligator_8x1w(&T1, &T0, A0);
+  yDBL_8x1w(&T0, &T0, A0); 
+  yDBL_8x1w(&T0, &T0, A0);
+  yDBL_8x1w(&T1, &T1, A0);
+  yDBL_8x1w(&T1, &T1, A0); 
 
-  // Initialize the exponent vector.
-  for (i = 0; i < N; i++) e[i] = sk[i];
+  for (i = 0; i < sicoba; i++) {
+    yMUL_8x1w(&T0, &T0, A0, compba[i]); 
+    yMUL_8x1w(&T1, &T1, A0, compba[i]);
+  }
 
-  // Execute the batched component. 
-  action_8x1w(&A0, visocnt, e, sk, A);
+  for (i = 0; i < sizeba; i++) {
+    ec = querye_8x1w(ba[i], e);
+    point_cswap_8x1w(&T0, &T1,  VAND(ec, VSET1(1)));
+    point_copy_8x1w(&G0, &T0);
+    point_copy_8x1w(&G1, &T0);
+
+    for (j = i+1; j < sizeba; j++) yMUL_8x1w(&G0, &G0, A0, ba[j]);
+
+    // a lane that has finished l_i behaves like a lane at infinity
+    inf = point_isinf_8x1w(&G0);
+    inf = VOR(inf, point_isinf_8x1w(&G1));
+    inf = VOR(inf, u8_iszero_8x1w(visocnt[ba[i]]));
+
+    bc = u8_iszero_8x1w(VSHR(ec, 1));
+
+    point_copy_8x1w(&A1, A0);
+    point_copy_8x1w(&A2, A0);
+    point_copy_8x1w(&T2, &T0);
+    point_copy_8x1w(&T3, &T1);
+    point_copy_8x1w(&T4, &T0);
+    point_copy_8x1w(&T5, &T1);
+
+#ifdef ISOG_FUSED
+    // one pass over the kernel multiples, T2 and T3 are pushed in place
+    if (ba[i] != lastiso) {
+      yISOGEVAL_8x1w(&A1, R, NULL, &G0, A0, R, 2, ba[i]);
+      yMUL_8x1w(&T3, &T3, &A1, ba[i]);
+    }
+    else yISOGEVAL_8x1w(&A1, NULL, NULL, &G0, A0, NULL, 0, ba[i]);
+#else
+    yISOG_8x1w(K, &A1, &G0, A0, ba[i]);
+
+    if (ba[i] != lastiso) {
+      yEVALmulti_8x1w(R, R, K, 2, ba[i]);
+      
+      yMUL_8x1w(&T3, &T3, &A1, ba[i]);
+    }
+#endif
+    t = VSHR(ec, 1);
+    t = VSUB(t, VXOR(bc, vone));
+    t = VXOR(t, bc);
+    t = VSHL(t, 1);
 
-  // ---------------------------------------------------------------------------
-  // The batched component has completed at this moment.
-  // We now extract the variables of each instance for the unbatched low-latency component.
+    t = VXOR(t, VXOR(VAND(ec, vone), bc));
+    x = VSUB(inf, VSET1(1));          // not infinity x = 1; infinity x = 0
+    t = VXOR(t, e[ba[i]]);            // t = t ^ e
+    e[ba[i]] = VXOR(e[ba[i]], VAND(x, t));  // e = e ^ ((t^e)&x)
 
-  uint8_t llisocnt[8][N], lle[8][N];
-  llpoint_t llC[8], llA[8];
-  uint64_t a43[8][LL_NWORDS] = {0}, a52[8][HT_NWORDS] = {0};
-  uint64_t ad43[8][LL_NWORDS] = {0}, ad52[8][HT_NWORDS] = {0};
+    point_cswap_8x1w(&T0, &T2, VXOR(inf, VSET1(1)));
+    point_cswap_8x1w(&T1, &T3, VXOR(inf, VSET1(1)));
+    point_cswap_8x1w(A0, &A1, VXOR(inf, VSET1(1)));
 
-  // Extract the isogeny counter of each instance.
-  for (i = 0; i < N; i++) {
-    llisocnt[0][i] = ((uint64_t *)&visocnt[i])[0];
-    llisocnt[1][i] = ((uint64_t *)&visocnt[i])[1];
-    llisocnt[2][i] = ((uint64_t *)&visocnt[i])[2];
-    llisocnt[3][i] = ((uint64_t *)&visocnt[i])[3];
-    llisocnt[4][i] = ((uint64_t *)&visocnt[i])[4];
-    llisocnt[5][i] = ((uint64_t *)&visocnt[i])[5];
-    llisocnt[6][i] = ((uint64_t *)&visocnt[i])[6];
-    llisocnt[7][i] = ((uint64_t *)&visocnt[i])[7];
-  }
+    yMUL_8x1w(&T4, &T4, &A2, ba[i]);
+    yMUL_8x1w(&T5, &T5, &A2, ba[i]);
+    point_cswap_8x1w(&T0, &T4, inf);
+    point_cswap_8x1w(&T1, &T5, inf);
 
-  // Convert coefficients from Montgomery domain to number domain,
-  // because the Montgomery domain (R = 2^516) of low-latency component is different 
-  // from the Montgomery domain (R' = 2^520) of high-throughput component 
-  gfp_mont2num_8x1w(A0.y, A0.y);
-  gfp_mont2num_8x1w(A0.z, A0.z);
+    point_cswap_8x1w(&T0, &T1, VAND(ec, vone));
 
-  // extract the curve coefficient for each instance
-  get_channel_8x1w(a52[0], A0.y, 0); get_channel_8x1w(a52[1], A0.y, 1);
-  get_channel_8x1w(a52[2], A0.y, 2); get_channel_8x1w(a52[3], A0.y, 3);
-  get_channel_8x1w(a52[4], A0.y, 4); get_channel_8x1w(a52[5], A0.y, 5);
-  get_channel_8x1w(a52[6], A0.y, 6); get_channel_8x1w(a52[7], A0.y, 7);
+    visocnt[ba[i]] = VSUB(visocnt[ba[i]], VXOR(inf, vone));
+  }
+}
 
-  get_channel_8x1w(ad52[0], A0.z, 0); get_channel_8x1w(ad52[1], A0.z, 1);
-  get_channel_8x1w(ad52[2], A0.z, 2); get_channel_8x1w(ad52[3], A0.z, 3);
-  get_channel_8x1w(ad52[4], A0.z, 4); get_channel_8x1w(ad52[5], A0.z, 5);
-  get_channel_8x1w(ad52[6], A0.z, 6); get_channel_8x1w(ad52[7], A0.z, 7);
+// the tails of the 8 lanes after the batched component; the curve stays in 
+// Montgomery domain R' = 2^520
+static void tail_store(httail *tail, const htpoint_t A, const __m512i *visocnt, const __m512i *e)
+{
+  int i, k;
+
+  for (k = 0; k < 8; k++) {
+    get_channel_8x1w(tail[k].y, A->y, k);
+    get_channel_8x1w(tail[k].z, A->z, k);
+    for (i = 0; i < N; i++) {
+      tail[k].isocnt[i] = ((uint64_t *)&visocnt[i])[k];
+      tail[k].e[i] = ((uint64_t *)&e[i])[k];
+    }
+  }
+}
 
+// form the (8x1)-way curve of 8 tails 
+static void tail_pack(htpoint_t A, httail *const *tail)
+{
+  int i;
 
-  // convert from radix-52 to radix-43
-  for (i = 0; i < 8; i++) {
-    mpi_conv_52to43(a43[i], a52[i], LL_NWORDS, HT_NWORDS);
-    mpi_conv_52to43(ad43[i], ad52[i], LL_NWORDS, HT_NWORDS);
+  for (i = 0; i < HT_NWORDS; i++) {
+    A->y[i] = set_vector(tail[7]->y[i], tail[6]->y[i], tail[5]->y[i], tail[4]->y[i], 
+                         tail[3]->y[i], tail[2]->y[i], tail[1]->y[i], tail[0]->y[i]);
+    A->z[i] = set_vector(tail[7]->z[i], tail[6]->z[i], tail[5]->z[i], tail[4]->z[i], 
+                         tail[3]->z[i], tail[2]->z[i], tail[1]->z[i], tail[0]->z[i]);
   }
+}
+
+// store the (8x1)-way curve of 8 finished tails 
+static void tail_unpack(httail *const *tail, const htpoint_t A)
+{
+  int k;
 
-  // form the (2x4)-way limb vector set
-  for (i = 0; i < 8; i++) {
-    llA[i][0] = set_vector(a43[i][9] , a43[i][6], a43[i][3], a43[i][0], ad43[i][9] , ad43[i][6], ad43[i][3], ad43[i][0]);
-    llA[i][1] = set_vector(a43[i][10], a43[i][7], a43[i][4], a43[i][1], ad43[i][10], ad43[i][7], ad43[i][4], ad43[i][1]);
-    llA[i][2] = set_vector(a43[i][11], a43[i][8], a43[i][5], a43[i][2], ad43[i][11], ad43[i][8], ad43[i][5], ad43[i][2]);
-    gfp_num2mont_2x4w(llA[i], llA[i]);  // convert to Montgomery domain
+  for (k = 0; k < 8; k++) {
+    get_channel_8x1w(tail[k]->y, A->y, k);
+    get_channel_8x1w(tail[k]->z, A->z, k);
+    memset(tail[k]->isocnt, 0, N);
   }
+}
+
+// check whether the tail has any isogeny left (public information)
+static int tail_busy(const httail *tail)
+{
+  int i, r = 0;
 
-  // extract the secret exponent for each instance
+  for (i = 0; i < N; i++) r |= tail->isocnt[i];
+  return r != 0;
+}
+
+// finish 8 tails sequentially with the (2x4)-way unbatched component; a tail 
+// with no isogeny left costs nothing but the handover
+static void tail_finish_2x4w(httail *const *tail)
+{
+  llpoint_t llA[8], llC[8];
+  htpoint A0;
+  int k;
+
+  // the Montgomery domain changes from R' = 2^520 of high-throughput component
+  // to R = 2^516 of low-latency component and back
+  tail_pack(&A0, tail);
+  point_ht2ll_8x1w(llA, &A0);
+
+  for (k = 0; k < 8; k++) action_2x4w(llC[k], tail[k]->e, llA[k], tail[k]->isocnt);
+
+  point_ll2ht_8x1w(&A0, llC);
+  tail_unpack(tail, &A0);
+}
+
+// load the tail into lane k of the (8x1)-way unbatched component
+static void lane_load(htpoint_t A, __m512i *visocnt, __m512i *e, const httail *tail, const int k)
+{
+  const __mmask8 lane = 1 << k;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    A->y[i] = VMMOV(A->y[i], lane, VSET1(tail->y[i]));
+    A->z[i] = VMMOV(A->z[i], lane, VSET1(tail->z[i]));
+  }
   for (i = 0; i < N; i++) {
-    lle[0][i] = ((uint64_t *)&e[i])[0];
-    lle[1][i] = ((uint64_t *)&e[i])[1];
-    lle[2][i] = ((uint64_t *)&e[i])[2];
-    lle[3][i] = ((uint64_t *)&e[i])[3];
-    lle[4][i] = ((uint64_t *)&e[i])[4];
-    lle[5][i] = ((uint64_t *)&e[i])[5];
-    lle[6][i] = ((uint64_t *)&e[i])[6];
-    lle[7][i] = ((uint64_t *)&e[i])[7];
+    visocnt[i] = VMMOV(visocnt[i], lane, VSET1(tail->isocnt[i]));
+    e[i] = VMMOV(e[i], lane, VSET1(tail->e[i]));
   }
+}
 
-  // ---------------------------------------------------------------------------
-  // Perform sequentially the unbatched component for each instance.
+// store the curve of the finished lane k into the tail
+static void lane_store(httail *tail, const htpoint_t A, const int k)
+{
+  get_channel_8x1w(tail->y, A->y, k);
+  get_channel_8x1w(tail->z, A->z, k);
+  memset(tail->isocnt, 0, N);
+}
 
-  for (i = 0; i < 8; i++) action_2x4w(llC[i], lle[i], llA[i], llisocnt[i]);
+// Finish the n tails with the (8x1)-way unbatched component. Its lanes are 
+// recycled: at the end of a round, a lane whose tail is finished is stored and 
+// refilled with the next busy tail, so that no lane waits for the slowest tail 
+// of a group. Once all the tails have had a lane and fewer than TAILMIN are 
+// left, these run on the (2x4)-way component. 
+void action_tails(httail *tail, const int n)
+{
+  __m512i visocnt[N], e[N], acc;
+  httail last[8], *lane[8], *p[8];
+  htpoint A0;
+  int next = 0, nlive, i, k;
+  __mmask8 live;
 
-  // ---------------------------------------------------------------------------
-  // The entire CSIDH class group action has completed at this moment.
+  // the idle lanes compute dummy isogenies on the base curve
+  for (i = 0; i < HT_NWORDS; i++) {
+    A0.y[i] = VSET1(E[0][i]);
+    A0.z[i] = VSET1(E[1][i]);
+  }
+  for (i = 0; i < N; i++) visocnt[i] = e[i] = VZERO;
+  for (k = 0; k < 8; k++) lane[k] = NULL;
+
+  while (1) {
+    // the lanes that still have isogenies to compute (public information)
+    acc = VZERO;
+    for (i = 0; i < N; i++) acc = VOR(acc, visocnt[i]);
+    live = VTEST(acc, acc);
+
+    for (k = nlive = 0; k < 8; k++) {
+      if (!(live & (1 << k))) {
+        if (lane[k]) lane_store(lane[k], &A0, k);
+        lane[k] = NULL;
+        while (next < n && !tail_busy(&tail[next])) next++;
+        if (next == n) continue;
+        lane_load(&A0, visocnt, e, &tail[next], k);
+        lane[k] = &tail[next++];
+      }
+      nlive++;
+    }
+    if (next == n && nlive < TAILMIN) break;
 
-  for (i = 0; i < 8; i++) gfp_mont2num_2x4w(llC[i], llC[i]);
+    tail_round_8x1w(&A0, visocnt, e);
+  }
 
-  for (i = 0; i < 8; i++) {
-    get_channel_2x4w(a43[i], llC[i], 4);
-    get_channel_2x4w(ad43[i], llC[i], 0);
+  if (!nlive) return;
 
-    mpi43_carryp(a43[i]);
-    mpi43_carryp(ad43[i]);
+  // the idle lanes have no isogeny left and cost nothing but the handover
+  tail_store(last, &A0, visocnt, e);
+  for (k = 0; k < 8; k++) p[k] = &last[k];
+  tail_finish_2x4w(p);
+  for (k = 0; k < 8; k++) if (lane[k]) memcpy(lane[k], &last[k], sizeof(httail));
+}
 
-    mpi_conv_43to52(a52[i], a43[i], HT_NWORDS, LL_NWORDS);
-    mpi_conv_43to52(ad52[i], ad43[i], HT_NWORDS, LL_NWORDS);
-  } 
+// The batched component of the combined method for 8 instances. The leftover 
+// isogenies of instance k are kept in tail[k]. 
+void action_head(httail *tail, const __m512i *sk, const htpoint_t A)
+{
+  __m512i visocnt[N], e[N];
+  htpoint A0;
+  int i;
 
-  // form the final (8x1)-way result
-  for (i = 0; i < HT_NWORDS; i++) {
-    C->y[i] = set_vector(a52[7][i],  a52[6][i],  a52[5][i],  a52[4][i],  a52[3][i],  a52[2][i],  a52[1][i],  a52[0][i]);
-    C->z[i] = set_vector(ad52[7][i], ad52[6][i], ad52[5][i], ad52[4][i], ad52[3][i], ad52[2][i], ad52[1][i], ad52[0][i]);
+  // Initialize the vectorized isogeny counter.
+  for (i = 0; i < N; i++) visocnt[i] = VSET1(B[i]);
+
+  // Initialize the exponent vector.
+  for (i = 0; i < N; i++) e[i] = sk[i];
+
+  // Execute the batched component. 
+  action_8x1w(&A0, visocnt, e, sk, A);
+
+  tail_store(tail, &A0, visocnt, e);
+}
+
+// The complete CSIDH group action using the combined method.  
+void action(htpoint_t C, const __m512i *sk, const htpoint_t A)
+{
+  httail tail[8], *p[8];
+  int k;
+
+  action_head(tail, sk, A);
+
+  // Perform sequentially the unbatched component for each instance.
+  for (k = 0; k < 8; k++) p[k] = &tail[k];
+  tail_finish_2x4w(p);
+
+  tail_pack(C, p);
+}
+
+// The combined method for nb batches of 8 instances, C[b] = sk[b] * A[b]. The 
+// tails of all the batches are pooled and finished by action_tails(). Return -1
+// if the tails cannot be allocated. 
+int action_batches(htpoint *C, const __m512i (*sk)[N], const htpoint *A, const int nb)
+{
+  httail *tail, *p[8];
+  int b, k;
+
+  tail = malloc(8*nb*sizeof(httail));
+  if (!tail) return -1;
+
+  for (b = 0; b < nb; b++) action_head(&tail[8*b], sk[b], &A[b]);
+
+  action_tails(tail, 8*nb);
+
+  for (b = 0; b < nb; b++) {
+    for (k = 0; k < 8; k++) p[k] = &tail[8*b+k];
+    tail_pack(&C[b], p);
   }
 
-  // convert from number domain to Montgomery domain 
-  gfp_num2mont_8x1w(C->y, C->y);
-  gfp_num2mont_8x1w(C->z, C->z);
-} 
+  free(tail);
+  return 0;
+}
 
 // The functions below are from [CCC+19] code for generating the secret key.
 
@@ -456,3 +667,47 @@ void random_sk(uint8_t *sk)
     sk[i] = (exp << 1) ^ (1 & (1 + sgn));
   }
 }
+
+// eight random bytes, one in each 64-bit lane
+static __m512i random_u8_8x1w()
+{
+  uint64_t r;
+
+  randombytes(&r, sizeof(r));
+  return _mm512_cvtepu8_epi64(_mm_cvtsi64_si128(r));
+}
+
+// Sample nb batches of eight secret keys at once: vsk[b] is the lane-packed 
+// form (as consumed by action()) of the keys 8b, ..., 8b+7, and sk[8b+k] (if 
+// sk is not NULL) is the key 8b+k in the form of random_sk(). The exponents 
+// are sampled like in random_sk(), but by rejection from the smallest power of
+// 2 above the bound instead of from a full byte, and in all lanes at once.
+void random_sk_8x1w(__m512i (*vsk)[N], uint8_t (*sk)[N], const int nb)
+{
+  __m512i t, m, exp, sgn, bound;
+  __mmask8 rej;
+  int b, i, k;
+
+  for (b = 0; b < nb; b++) {
+    for (i = 0; i < N; i++) {
+      // exp is randomly selected from |[ 0, B ]|
+      bound = VSET1(B[i]);
+      m = VSET1((2 << (31 - __builtin_clz(B[i]))) - 1);
+      t = VAND(random_u8_8x1w(), m);
+      while ((rej = VCMPGT(t, bound))) t = VMMOV(t, rej, VAND(random_u8_8x1w(), m));
+
+      // Mapping integers from |[ 0, B |] into |[ -B/2, B/2]| if B is even, or
+      // |[ -(B+1)/2, (B-1)/2 ]| if B is odd, and then into the set |[-B, B]|.
+      exp = VSRA(VSUB(VSHL(t, 1), VSET1(B[i] + (B[i] & 1))), 1);
+      exp = VADD(VSHL(exp, 1), VSET1(B[i] & 1));
+      sgn = VSRA(exp, 63);              // sign of exp
+
+      // Next, to write  key[i] = e || ((1 + sgn)/2)
+      exp = VSUB(VXOR(exp, sgn), sgn);
+      vsk[b][i] = VXOR(VSHL(exp, 1), VADD(sgn, VSET1(1)));
+    }
+    if (sk)
+      for (k = 0; k < 8; k++)
+        for (i = 0; i < N; i++) sk[8*b+k][i] = (uint8_t) ((uint64_t *)&vsk[b][i])[k];
+  }
+}
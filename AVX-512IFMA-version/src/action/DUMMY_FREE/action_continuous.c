@@ -0,0 +1,61 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#include "action.h"
+#include <string.h>
+#include <stdlib.h>
+
+// the batched component of the combined method on cnt <= 8 instances; the 
+// unused lanes repeat the first instance 
+static void stream_head(httail *tail, const htinst *inst, const int cnt)
+{
+  __m512i sk[N];
+  htpoint A;
+  uint64_t t[8];
+  int i, k;
+
+  for (i = 0; i < N; i++) {
+    for (k = 0; k < 8; k++) t[k] = inst[k < cnt ? k : 0].sk[i];
+    sk[i] = set_vector(t[7], t[6], t[5], t[4], t[3], t[2], t[1], t[0]);
+  }
+  for (i = 0; i < HT_NWORDS; i++) {
+    for (k = 0; k < 8; k++) t[k] = inst[k < cnt ? k : 0].y[i];
+    A.y[i] = set_vector(t[7], t[6], t[5], t[4], t[3], t[2], t[1], t[0]);
+    for (k = 0; k < 8; k++) t[k] = inst[k < cnt ? k : 0].z[i];
+    A.z[i] = set_vector(t[7], t[6], t[5], t[4], t[3], t[2], t[1], t[0]);
+  }
+
+  action_head(tail, sk, &A);
+}
+
+// C = sk * A for the queue of n instances, with the combined method of 
+// action_batches(): the instances run through the batched component 8 at a 
+// time, and their tails are pooled and finished by action_tails(). Return -1 if
+// the tails cannot be allocated. 
+int action_stream(htinst *inst, const int n)
+{
+  httail *tail;
+  int i;
+
+  // the last batch has 8 tails even if fewer instances are left
+  tail = malloc(((n+7) & ~7)*sizeof(httail));
+  if (!tail) return -1;
+
+  for (i = 0; i < n; i += 8) stream_head(&tail[i], &inst[i], (n-i < 8) ? n-i : 8);
+
+  action_tails(tail, n);
+
+  for (i = 0; i < n; i++) {
+    memcpy(inst[i].y, tail[i].y, sizeof(inst[i].y));
+    memcpy(inst[i].z, tail[i].z, sizeof(inst[i].z));
+  }
+
+  free(tail);
+  return 0;
+}
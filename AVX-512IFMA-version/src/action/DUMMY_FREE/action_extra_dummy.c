@@ -78,6 +78,7 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A, const
   uint8_t ba[N], sizeba = 0, compba[N], sicoba = 0, lastiso;
   uint8_t e[N], bc, ec = 0, fnsh[N] = { 0 }, isocnt[N] = { 0 };
   llpoint_t A0, T0, T1, G0, G1, K[HLMAX];
+  llpoint_t *R[2] = { &T0, &T1 };
   int total = 0, i, j, sum = 0;
 
   // Initialize variables for computing CSIDH class group action.
@@ -131,8 +132,7 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A, const
           yISOG_2x4w(K, A0, G0, A0, ba[i]);
 
           if (ba[i] != lastiso) {
-            yEVAL_2x4w(T0, T0, K, ba[i]);
-            yEVAL_2x4w(T1, T1, K, ba[i]);
+            yEVALmulti_2x4w(R, R, K, 2, ba[i]);
 
             yMUL_2x4w(T1, T1, A0, ba[i]);         
           }
@@ -142,6 +142,8 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A, const
           total += 1;
         }
         else {
+          // T0 keeps its factor l when only G1 is the point at infinity
+          yMUL_2x4w(T0, T0, A0, ba[i]);
           yMUL_2x4w(T1, T1, A0, ba[i]);
         }
 
@@ -164,8 +166,11 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
   uint8_t ba[NUMBA][MAXSIZEBA], sizeba[NUMBA], compba[NUMBA][N], sicoba[NUMBA], lastiso[NUMBA];
   uint8_t fnsh[N] = { 0 }, isocnt[N] = { 0 };
   __m512i ec = VZERO, inf, bc, vone = VSET1(1), t, x;  
-  htpoint A0, A1, T0, T1, G0, G1, K[HLMAX];
-  int count = 0, total = 0, i, j, m = 0, numba = NUMBA;
+  htpoint A0, A1, T0, T1, G0, G1;
+#ifndef ISOG_FUSED
+  htpoint K[HLMAX];
+#endif
+  int count = 0, total = 0, i, j, m = 0, numba = NUMBA, first;
 
   // Initialize SIMBA variables. 
   memcpy(ba, BATCHES, N);
@@ -176,6 +181,7 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
 
   // Initialize variables for computing CSIDH class group action.
   point_copy_8x1w(&A0, A);
+  first = point_first_8x1w(&T0, &T1, A);  // on the base curve or a cached one
   memcpy(isocnt, B, N);
 
   while (total < NUMISO) {
@@ -200,15 +206,19 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
       }
     }
 
-    elligator_8x1w(&T1, &T0, &A0);
-    yDBL_8x1w(&T0, &T0, &A0); 
-    yDBL_8x1w(&T0, &T0, &A0);
-    yDBL_8x1w(&T1, &T1, &A0);
-    yDBL_8x1w(&T1, &T1, &A0); 
-
-    for (i = 0; i < sicoba[m]; i++) {
-      yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
-      yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+    // the first round on the base curve or on a cached curve starts from the
+    // points of point_first_8x1w()
+    if (count || !first) {
+      elligator_8x1w(&T1, &T0, &A0);
+      yDBL_8x1w(&T0, &T0, &A0); 
+      yDBL_8x1w(&T0, &T0, &A0);
+      yDBL_8x1w(&T1, &T1, &A0);
+      yDBL_8x1w(&T1, &T1, &A0); 
+
+      for (i = 0; i < sicoba[m]; i++) {
+        yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
+        yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+      }
     }
 
     for (i = 0; i < sizeba[m]; i++) {
@@ -230,6 +240,7 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
         //////////////////////////////////////////////////////////
         // extra-dummy
         htpoint A1, A2, T2, T3, T4, T5;
+        htpoint *R[2] = { &T2, &T3 };
 
         point_copy_8x1w(&A1, &A0);
         point_copy_8x1w(&A2, &A0);
@@ -238,15 +249,23 @@ static void action_8x1w(htpoint_t C, __m512i* visocnt, __m512i* e, const __m512i
         point_copy_8x1w(&T4, &T0);
         point_copy_8x1w(&T5, &T1);
 
+#ifdef ISOG_FUSED
+        // one pass over the kernel multiples, T2 and T3 are pushed in place
+        if (ba[m][i] != lastiso[m]) {
+          yISOGEVAL_8x1w(&A1, R, NULL, &G0, &A0, R, 2, ba[m][i]);
+          yMUL_8x1w(&T3, &T3, &A1, ba[m][i]);
+        }
+        else yISOGEVAL_8x1w(&A1, NULL, NULL, &G0, &A0, NULL, 0, ba[m][i]);
+#else
         yISOG_8x1w(K, &A1, &G0, &A0, ba[m][i]);
 
         if (ba[m][i] != lastiso[m]) {
 
-          yEVAL_8x1w(&T2, &T2, K, ba[m][i]);
-          yEVAL_8x1w(&T3, &T3, K, ba[m][i]);
+          yEVALmulti_8x1w(R, R, K, 2, ba[m][i]);
           
           yMUL_8x1w(&T3, &T3, &A1, ba[m][i]);
         }
+#endif
         t = VSHR(ec, 1);
         t = VSUB(t, VXOR(bc, vone));
         t = VXOR(t, bc);
@@ -308,8 +327,6 @@ void action(htpoint_t C, const __m512i *sk, const htpoint_t A)
 
   uint8_t llisocnt[8][N], lle[8][N];
   llpoint_t llC[8], llA[8];
-  uint64_t a43[8][LL_NWORDS] = {0}, a52[8][HT_NWORDS] = {0};
-  uint64_t ad43[8][LL_NWORDS] = {0}, ad52[8][HT_NWORDS] = {0};
 
   // Extract the isogeny counter of each instance.
   for (i = 0; i < N; i++) {
@@ -323,36 +340,10 @@ void action(htpoint_t C, const __m512i *sk, const htpoint_t A)
     llisocnt[7][i] = ((uint64_t *)&visocnt[i])[7];
   }
 
-  // Convert coefficients from Montgomery domain to number domain,
-  // because the Montgomery domain (R = 2^516) of low-latency component is different 
-  // from the Montgomery domain (R' = 2^520) of high-throughput component 
-  gfp_mont2num_8x1w(A0.y, A0.y);
-  gfp_mont2num_8x1w(A0.z, A0.z);
-
-  // extract the curve coefficient for each instance
-  get_channel_8x1w(a52[0], A0.y, 0); get_channel_8x1w(a52[1], A0.y, 1);
-  get_channel_8x1w(a52[2], A0.y, 2); get_channel_8x1w(a52[3], A0.y, 3);
-  get_channel_8x1w(a52[4], A0.y, 4); get_channel_8x1w(a52[5], A0.y, 5);
-  get_channel_8x1w(a52[6], A0.y, 6); get_channel_8x1w(a52[7], A0.y, 7);
-
-  get_channel_8x1w(ad52[0], A0.z, 0); get_channel_8x1w(ad52[1], A0.z, 1);
-  get_channel_8x1w(ad52[2], A0.z, 2); get_channel_8x1w(ad52[3], A0.z, 3);
-  get_channel_8x1w(ad52[4], A0.z, 4); get_channel_8x1w(ad52[5], A0.z, 5);
-  get_channel_8x1w(ad52[6], A0.z, 6); get_channel_8x1w(ad52[7], A0.z, 7);
-
-  // convert from radix-52 to radix-43
-  for (i = 0; i < 8; i++) {
-    mpi_conv_52to43(a43[i], a52[i], LL_NWORDS, HT_NWORDS);
-    mpi_conv_52to43(ad43[i], ad52[i], LL_NWORDS, HT_NWORDS);
-  }
-
-  // form the (2x4)-way limb vector set
-  for (i = 0; i < 8; i++) {
-    llA[i][0] = set_vector(a43[i][9] , a43[i][6], a43[i][3], a43[i][0], ad43[i][9] , ad43[i][6], ad43[i][3], ad43[i][0]);
-    llA[i][1] = set_vector(a43[i][10], a43[i][7], a43[i][4], a43[i][1], ad43[i][10], ad43[i][7], ad43[i][4], ad43[i][1]);
-    llA[i][2] = set_vector(a43[i][11], a43[i][8], a43[i][5], a43[i][2], ad43[i][11], ad43[i][8], ad43[i][5], ad43[i][2]);
-    gfp_num2mont_2x4w(llA[i], llA[i]);  // convert to Montgomery domain
-  }
+  // split the curve into one (2x4)-way point per instance; the Montgomery domain 
+  // changes from R' = 2^520 of high-throughput component to R = 2^516 of 
+  // low-latency component
+  point_ht2ll_8x1w(llA, &A0);
 
   // extract the secret exponent for each instance
   for (i = 0; i < N; i++) {
@@ -374,28 +365,8 @@ void action(htpoint_t C, const __m512i *sk, const htpoint_t A)
   // ---------------------------------------------------------------------------
   // The entire CSIDH class group action has completed at this moment.
 
-  for (i = 0; i < 8; i++) gfp_mont2num_2x4w(llC[i], llC[i]);
-
-  for (i = 0; i < 8; i++) {
-    get_channel_2x4w(a43[i], llC[i], 4);
-    get_channel_2x4w(ad43[i], llC[i], 0);
-
-    mpi43_carryp(a43[i]);
-    mpi43_carryp(ad43[i]);
-
-    mpi_conv_43to52(a52[i], a43[i], HT_NWORDS, LL_NWORDS);
-    mpi_conv_43to52(ad52[i], ad43[i], HT_NWORDS, LL_NWORDS);
-  } 
-
-  // form the final (8x1)-way result
-  for (i = 0; i < HT_NWORDS; i++) {
-    C->y[i] = set_vector(a52[7][i],  a52[6][i],  a52[5][i],  a52[4][i],  a52[3][i],  a52[2][i],  a52[1][i],  a52[0][i]);
-    C->z[i] = set_vector(ad52[7][i], ad52[6][i], ad52[5][i], ad52[4][i], ad52[3][i], ad52[2][i], ad52[1][i], ad52[0][i]);
-  }
-
-  // convert from number domain to Montgomery domain 
-  gfp_num2mont_8x1w(C->y, C->y);
-  gfp_num2mont_8x1w(C->z, C->z);
+  // form the final (8x1)-way result in Montgomery domain R' = 2^520
+  point_ll2ht_8x1w(C, llC);
 } 
 
 // The functions below are from [CCC+19] code for generating the secret key.
@@ -447,3 +418,47 @@ void random_sk(uint8_t *sk)
     sk[i] = (exp << 1) ^ (1 & (1 + sgn));
   }
 }
+
+// eight random bytes, one in each 64-bit lane
+static __m512i random_u8_8x1w()
+{
+  uint64_t r;
+
+  randombytes(&r, sizeof(r));
+  return _mm512_cvtepu8_epi64(_mm_cvtsi64_si128(r));
+}
+
+// Sample nb batches of eight secret keys at once: vsk[b] is the lane-packed 
+// form (as consumed by action()) of the keys 8b, ..., 8b+7, and sk[8b+k] (if 
+// sk is not NULL) is the key 8b+k in the form of random_sk(). The exponents 
+// are sampled like in random_sk(), but by rejection from the smallest power of
+// 2 above the bound instead of from a full byte, and in all lanes at once.
+void random_sk_8x1w(__m512i (*vsk)[N], uint8_t (*sk)[N], const int nb)
+{
+  __m512i t, m, exp, sgn, bound;
+  __mmask8 rej;
+  int b, i, k;
+
+  for (b = 0; b < nb; b++) {
+    for (i = 0; i < N; i++) {
+      // exp is randomly selected from |[ 0, B ]|
+      bound = VSET1(B[i]);
+      m = VSET1((2 << (31 - __builtin_clz(B[i]))) - 1);
+      t = VAND(random_u8_8x1w(), m);
+      while ((rej = VCMPGT(t, bound))) t = VMMOV(t, rej, VAND(random_u8_8x1w(), m));
+
+      // Mapping integers from |[ 0, B |] into |[ -B/2, B/2]| if B is even, or
+      // |[ -(B+1)/2, (B-1)/2 ]| if B is odd, and then into the set |[-B, B]|.
+      exp = VSRA(VSUB(VSHL(t, 1), VSET1(B[i] + (B[i] & 1))), 1);
+      exp = VADD(VSHL(exp, 1), VSET1(B[i] & 1));
+      sgn = VSRA(exp, 63);              // sign of exp
+
+      // Next, to write  key[i] = e || ((1 + sgn)/2)
+      exp = VSUB(VXOR(exp, sgn), sgn);
+      vsk[b][i] = VXOR(VSHL(exp, 1), VADD(sgn, VSET1(1)));
+    }
+    if (sk)
+      for (k = 0; k < 8; k++)
+        for (i = 0; i < N; i++) sk[8*b+k][i] = (uint8_t) ((uint64_t *)&vsk[b][i])[k];
+  }
+}
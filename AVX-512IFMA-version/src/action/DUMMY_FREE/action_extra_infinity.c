@@ -78,6 +78,7 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
   uint8_t ba[N], sizeba = 0, compba[N], sicoba = 0, lastiso;
   uint8_t e[N], bc, ec = 0, fnsh[N] = { 0 }, isocnt[N] = { 0 };
   llpoint_t A0, T0, T1, G0, G1, K[HLMAX];
+  llpoint_t *R[2] = { &T0, &T1 };
   int total = 0, i, j;
 
   // extra-infinity
@@ -137,8 +138,7 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
           yISOG_2x4w(K, A0, G0, A0, ba[i]);
 
           if (ba[i] != lastiso) {
-            yEVAL_2x4w(T0, T0, K, ba[i]);
-            yEVAL_2x4w(T1, T1, K, ba[i]);
+            yEVALmulti_2x4w(R, R, K, 2, ba[i]);
 
             yMUL_2x4w(T1, T1, A0, ba[i]);         
           }
@@ -148,6 +148,8 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
           total += 1;
         }
         else {
+          // T0 keeps its factor l when only G1 is the point at infinity
+          yMUL_2x4w(T0, T0, A0, ba[i]);
           yMUL_2x4w(T1, T1, A0, ba[i]);
         }
 
@@ -170,8 +172,12 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
   uint8_t ba[NUMBA][MAXSIZEBA], sizeba[NUMBA], compba[NUMBA][N], sicoba[NUMBA], lastiso[NUMBA];
   uint8_t fnsh[N] = { 0 }, isocnt[N] = { 0 };
   __m512i ec = VZERO, inf, bc, vone = VSET1(1), t, x;  
-  htpoint A0, T0, T1, G0, G1, K[HLMAX];
-  int count = 0, total = 0, i, j, m = 0, numba = NUMBA;
+  htpoint A0, T0, T1, G0, G1;
+  htpoint *R[2] = { &T0, &T1 };
+#ifndef ISOG_FUSED
+  htpoint K[HLMAX];
+#endif
+  int count = 0, total = 0, i, j, m = 0, numba = NUMBA, first;
   uint64_t f_inf;
 
   // Initialize SIMBA variables. 
@@ -183,6 +189,7 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
 
   // Initialize variables for computing CSIDH class group action.
   point_copy_8x1w(&A0, A);
+  first = point_first_8x1w(&T0, &T1, A);  // on the base curve or a cached one
   memcpy(isocnt, B, N);
 
   // extra-infinity 
@@ -232,15 +239,25 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
       }
     }
 
-    elligator_8x1w(&T1, &T0, &A0);
-    yDBL_8x1w(&T0, &T0, &A0); 
-    yDBL_8x1w(&T0, &T0, &A0);
-    yDBL_8x1w(&T1, &T1, &A0);
-    yDBL_8x1w(&T1, &T1, &A0); 
-
-    for (i = 0; i < sicoba[m]; i++) {
-      yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
-      yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+    if (!count && first) {
+      // the first round starts from the points of point_first_8x1w(), which do
+      // not cover the primes moved to the complement above
+      for (i = SICOBA[m]; i < sicoba[m]; i++) {
+        yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
+        yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+      }
+    }
+    else {
+      elligator_8x1w(&T1, &T0, &A0);
+      yDBL_8x1w(&T0, &T0, &A0); 
+      yDBL_8x1w(&T0, &T0, &A0);
+      yDBL_8x1w(&T1, &T1, &A0);
+      yDBL_8x1w(&T1, &T1, &A0); 
+
+      for (i = 0; i < sicoba[m]; i++) {
+        yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
+        yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+      }
     }
 
     for (i = 0; i < sizeba[m]; i++) {
@@ -266,14 +283,22 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
 
           bc = u8_iszero_8x1w(VSHR(ec, 1));
 
+#ifdef ISOG_FUSED
+          // one pass over the kernel multiples, T0 and T1 are pushed in place
+          if (ba[m][i] != lastiso[m]) {
+            yISOGEVAL_8x1w(&A0, R, NULL, &G0, &A0, R, 2, ba[m][i]);
+            yMUL_8x1w(&T1, &T1, &A0, ba[m][i]);
+          }
+          else yISOGEVAL_8x1w(&A0, NULL, NULL, &G0, &A0, NULL, 0, ba[m][i]);
+#else
           yISOG_8x1w(K, &A0, &G0, &A0, ba[m][i]);
 
           if (ba[m][i] != lastiso[m]) {
-            yEVAL_8x1w(&T0, &T0, K, ba[m][i]);
-            yEVAL_8x1w(&T1, &T1, K, ba[m][i]);
+            yEVALmulti_8x1w(R, R, K, 2, ba[m][i]);
 
             yMUL_8x1w(&T1, &T1, &A0, ba[m][i]);
           }
+#endif
           t = VSHR(ec, 1);
           t = VSUB(t, VXOR(bc, vone));
           t = VXOR(t, bc);
@@ -321,40 +346,12 @@ void action(htpoint_t C, const __m512i *sk, const htpoint_t A)
   // We now extract the variables of each instance for the unbatched low-latency component.
 
   llpoint_t llC[8], llA[8];
-  uint64_t a43[8][LL_NWORDS] = {0}, a52[8][HT_NWORDS] = {0};
-  uint64_t ad43[8][LL_NWORDS] = {0}, ad52[8][HT_NWORDS] = {0};
   uint8_t lle[8][N];
 
-  // Convert coefficients from Montgomery domain to number domain,
-  // because the Montgomery domain (R = 2^516) of low-latency component is different 
-  // from the Montgomery domain (R' = 2^520) of high-throughput component 
-  gfp_mont2num_8x1w(A0.y, A0.y);
-  gfp_mont2num_8x1w(A0.z, A0.z);
-
-  // extract the curve coefficient for each instance
-  get_channel_8x1w(a52[0], A0.y, 0); get_channel_8x1w(a52[1], A0.y, 1);
-  get_channel_8x1w(a52[2], A0.y, 2); get_channel_8x1w(a52[3], A0.y, 3);
-  get_channel_8x1w(a52[4], A0.y, 4); get_channel_8x1w(a52[5], A0.y, 5);
-  get_channel_8x1w(a52[6], A0.y, 6); get_channel_8x1w(a52[7], A0.y, 7);
-
-  get_channel_8x1w(ad52[0], A0.z, 0); get_channel_8x1w(ad52[1], A0.z, 1);
-  get_channel_8x1w(ad52[2], A0.z, 2); get_channel_8x1w(ad52[3], A0.z, 3);
-  get_channel_8x1w(ad52[4], A0.z, 4); get_channel_8x1w(ad52[5], A0.z, 5);
-  get_channel_8x1w(ad52[6], A0.z, 6); get_channel_8x1w(ad52[7], A0.z, 7);
-
-  // convert from radix-52 to radix-43
-  for (i = 0; i < 8; i++) {
-    mpi_conv_52to43(a43[i], a52[i], LL_NWORDS, HT_NWORDS);
-    mpi_conv_52to43(ad43[i], ad52[i], LL_NWORDS, HT_NWORDS);
-  }
-
-  // form the (2x4)-way limb vector set
-  for (i = 0; i < 8; i++) {
-    llA[i][0] = set_vector(a43[i][9] , a43[i][6], a43[i][3], a43[i][0], ad43[i][9] , ad43[i][6], ad43[i][3], ad43[i][0]);
-    llA[i][1] = set_vector(a43[i][10], a43[i][7], a43[i][4], a43[i][1], ad43[i][10], ad43[i][7], ad43[i][4], ad43[i][1]);
-    llA[i][2] = set_vector(a43[i][11], a43[i][8], a43[i][5], a43[i][2], ad43[i][11], ad43[i][8], ad43[i][5], ad43[i][2]);
-    gfp_num2mont_2x4w(llA[i], llA[i]);  // convert to Montgomery domain
-  }
+  // split the curve into one (2x4)-way point per instance; the Montgomery domain 
+  // changes from R' = 2^520 of high-throughput component to R = 2^516 of 
+  // low-latency component
+  point_ht2ll_8x1w(llA, &A0);
 
   // extract the secret exponent for each instance
   for (i = 0; i < N; i++) {
@@ -376,28 +373,8 @@ void action(htpoint_t C, const __m512i *sk, const htpoint_t A)
   // ---------------------------------------------------------------------------
   // The entire CSIDH class group action has completed at this moment.
 
-  for (i = 0; i < 8; i++) gfp_mont2num_2x4w(llC[i], llC[i]);
-
-  for (i = 0; i < 8; i++) {
-    get_channel_2x4w(a43[i], llC[i], 4);
-    get_channel_2x4w(ad43[i], llC[i], 0);
-
-    mpi43_carryp(a43[i]);
-    mpi43_carryp(ad43[i]);
-
-    mpi_conv_43to52(a52[i], a43[i], HT_NWORDS, LL_NWORDS);
-    mpi_conv_43to52(ad52[i], ad43[i], HT_NWORDS, LL_NWORDS);
-  } 
-
-  // form the final (8x1)-way result
-  for (i = 0; i < HT_NWORDS; i++) {
-    C->y[i] = set_vector(a52[7][i],  a52[6][i],  a52[5][i],  a52[4][i],  a52[3][i],  a52[2][i],  a52[1][i],  a52[0][i]);
-    C->z[i] = set_vector(ad52[7][i], ad52[6][i], ad52[5][i], ad52[4][i], ad52[3][i], ad52[2][i], ad52[1][i], ad52[0][i]);
-  }
-
-  // convert from number domain to Montgomery domain 
-  gfp_num2mont_8x1w(C->y, C->y);
-  gfp_num2mont_8x1w(C->z, C->z);
+  // form the final (8x1)-way result in Montgomery domain R' = 2^520
+  point_ll2ht_8x1w(C, llC);
 } 
 
 // The functions below are from [CCC+19] code for generating the secret key.
@@ -449,3 +426,47 @@ void random_sk(uint8_t *sk)
     sk[i] = (exp << 1) ^ (1 & (1 + sgn));
   }
 }
+
+// eight random bytes, one in each 64-bit lane
+static __m512i random_u8_8x1w()
+{
+  uint64_t r;
+
+  randombytes(&r, sizeof(r));
+  return _mm512_cvtepu8_epi64(_mm_cvtsi64_si128(r));
+}
+
+// Sample nb batches of eight secret keys at once: vsk[b] is the lane-packed 
+// form (as consumed by action()) of the keys 8b, ..., 8b+7, and sk[8b+k] (if 
+// sk is not NULL) is the key 8b+k in the form of random_sk(). The exponents 
+// are sampled like in random_sk(), but by rejection from the smallest power of
+// 2 above the bound instead of from a full byte, and in all lanes at once.
+void random_sk_8x1w(__m512i (*vsk)[N], uint8_t (*sk)[N], const int nb)
+{
+  __m512i t, m, exp, sgn, bound;
+  __mmask8 rej;
+  int b, i, k;
+
+  for (b = 0; b < nb; b++) {
+    for (i = 0; i < N; i++) {
+      // exp is randomly selected from |[ 0, B ]|
+      bound = VSET1(B[i]);
+      m = VSET1((2 << (31 - __builtin_clz(B[i]))) - 1);
+      t = VAND(random_u8_8x1w(), m);
+      while ((rej = VCMPGT(t, bound))) t = VMMOV(t, rej, VAND(random_u8_8x1w(), m));
+
+      // Mapping integers from |[ 0, B |] into |[ -B/2, B/2]| if B is even, or
+      // |[ -(B+1)/2, (B-1)/2 ]| if B is odd, and then into the set |[-B, B]|.
+      exp = VSRA(VSUB(VSHL(t, 1), VSET1(B[i] + (B[i] & 1))), 1);
+      exp = VADD(VSHL(exp, 1), VSET1(B[i] & 1));
+      sgn = VSRA(exp, 63);              // sign of exp
+
+      // Next, to write  key[i] = e || ((1 + sgn)/2)
+      exp = VSUB(VXOR(exp, sgn), sgn);
+      vsk[b][i] = VXOR(VSHL(exp, 1), VADD(sgn, VSET1(1)));
+    }
+    if (sk)
+      for (k = 0; k < 8; k++)
+        for (i = 0; i < N; i++) sk[8*b+k][i] = (uint8_t) ((uint64_t *)&vsk[b][i])[k];
+  }
+}
@@ -51,6 +51,7 @@ void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
   uint8_t ba[NUMBA][MAXSIZEBA], sizeba[NUMBA], compba[NUMBA][N], sicoba[NUMBA], lastiso[NUMBA];
   uint8_t e[N], bc, ec = 0, fnsh[N] = { 0 }, isocnt[N] = { 0 };
   llpoint_t A0, T0, T1, T2, T3, G0, G1, K[HLMAX], Z;
+  llpoint_t *R[2] = { &T0, &T1 };
   int count = 0, total = 0, si, i, j, m = 0, numba = NUMBA;
 
   // Initialize SIMBA variables. 
@@ -115,8 +116,7 @@ void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
           yISOG_2x4w(K, A0, G0, A0, ba[m][i]);
 
           if (ba[m][i] != lastiso[m]) {
-            yEVAL_2x4w(T0, T0, K, ba[m][i]);
-            yEVAL_2x4w(T1, T1, K, ba[m][i]);
+            yEVALmulti_2x4w(R, R, K, 2, ba[m][i]);
 
             yMUL_2x4w(T1, T1, A0, ba[m][i]);  
           }
@@ -126,6 +126,8 @@ void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
           total += 1;
         }
         else {
+          // T0 keeps its factor l when only G1 is the point at infinity
+          yMUL_2x4w(T0, T0, A0, ba[m][i]);
           yMUL_2x4w(T1, T1, A0, ba[m][i]);
         }
 
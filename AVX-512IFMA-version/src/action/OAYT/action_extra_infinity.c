@@ -79,12 +79,13 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
   uint8_t e[N], bc, ec = 0, fnsh[N] = { 0 };
   uint8_t mask, isocnt[N] = { 0 };
   llpoint_t A0, A1, T0, T1, T2, T3, G0, G1, K[HLMAX], Z;
+  llpoint_t *Q[2] = { &T0, &T1 }, *R[2] = { &T2, &T3 };
   int total = 0, si, i, j;
 
   // extra-infinity
   for (i = 0; i < N; i++) fnsh[i] = 1;
   for (i = 0; i < LL_NUMIDX; i++) {
-    isocnt[ll_idx[i]] = B[ll_idx[i]];
+    isocnt[ll_idx[i]] = RADICAL(ll_idx[i]) ? 1 : B[ll_idx[i]];
     fnsh[ll_idx[i]] = 0;
   }
   total = HT_NUMISO; // HT_NUMISO isogenies have been computed in the batched component
@@ -95,7 +96,7 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
   
   // Since there are only few isogeny computations in the unbatched component, 
   // we will not use SIMBA here         
-  // initialize BA and COMPBA  
+  // initialize BA and COMPBA, the radical primes 66, 67, 68 at the end of BA  
   for (i = 0; i < N; i++) {                   
     if (isocnt[i] == 0) {
       compba[sicoba] = i;
@@ -110,7 +111,7 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
   }
 
   // the main loop
-  while (total < NUMISO) {
+  while (total < HT_NUMISO + LL_NUMISO) {
     elligator_2x4w(T1, T0, A0);           
     yDBL_2x4w(T0, T0, A0);            
     yDBL_2x4w(T0, T0, A0);            
@@ -133,7 +134,19 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
         for (j = i+1; j < sizeba; j++)
           if (!fnsh[ba[j]]) yMUL_2x4w(G0, G0, A0, ba[j]);
 
-        if (!point_isinf_2x4w(G0)) {
+        if (RADICAL(ba[i]) && !point_isinf_2x4w(G0)) {
+          // the points are not pushed through the chain of radical isogenies, 
+          // so that it ends the round 
+          radical_2x4w(A0, A0, G0, ec, ba[i], B[ba[i]]);
+          e[ba[i]] = ec&1;
+          isocnt[ba[i]] = 0;
+          total += 1;
+          fnsh[ba[i]] = 1;
+          compba[sicoba] = ba[i];
+          sicoba += 1;
+          break;
+        }
+        else if (!point_isinf_2x4w(G0)) {
           bc = u8_iszero(ec>>1);
           point_cswap_2x4w(G0, G1, bc);
           yISOG_2x4w(K, A1, G0, A0, ba[i]);
@@ -144,8 +157,7 @@ static void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
 
             yMUL_2x4w(T1, T1, A0, ba[i]);
 
-            yEVAL_2x4w(T2, T0, K, ba[i]);
-            yEVAL_2x4w(T3, T1, K, ba[i]);
+            yEVALmulti_2x4w(R, Q, K, 2, ba[i]);
 
             yADD_2x4w(Z, K[si+mask-1], G0, K[si+mask-2]);
             point_cswap_2x4w(Z, K[si], mask^1);
@@ -183,8 +195,12 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
   uint8_t ba[NUMBA][MAXSIZEBA], sizeba[NUMBA], compba[NUMBA][N], sicoba[NUMBA], lastiso[NUMBA];
   uint8_t fnsh[N] = { 0 }, mask, isocnt[N] = { 0 };
   __m512i ec = VZERO, inf, bc, vone = VSET1(1), t;  
-  htpoint A0, A1, T0, T1, T2, T3, G0, G1, K[HLMAX], Z;
-  int count = 0, total = 0, si, i, j, m = 0, numba = NUMBA;
+  htpoint A0, A1, T0, T1, T2, T3, G0, G1;
+  htpoint *Q[2] = { &T0, &T1 }, *R[2] = { &T2, &T3 };
+#ifndef ISOG_FUSED
+  htpoint K[HLMAX], Z;
+#endif
+  int count = 0, total = 0, si, i, j, m = 0, numba = NUMBA, first;
   uint64_t f_inf;
 
   // Initialize SIMBA variables. 
@@ -196,6 +212,7 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
 
   // Initialize variables for computing CSIDH class group action.
   point_copy_8x1w(&A0, A);
+  first = point_first_8x1w(&T0, &T1, A);  // on the base curve or a cached one
   memcpy(isocnt, B, N);
 
   // extra-infinity 
@@ -204,11 +221,11 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
     fnsh[ll_idx[i]] = 1;                // these isogenies will be computed in the unbatched component 
   }
   // put these primes directly in the complement of the BA 
-  compba[0][sicoba[0]] = ba[0][22];
+  compba[0][sicoba[0]] = ba[0][24];
   sicoba[0] += 1;
-  compba[1][sicoba[1]] = ba[1][22];
+  compba[1][sicoba[1]] = ba[1][24];
   sicoba[1] += 1;
-  compba[2][sicoba[2]] = ba[2][22];
+  compba[2][sicoba[2]] = ba[2][23];
   sicoba[2] += 1;
   compba[2][sicoba[2]] = ba[2][21];
   sicoba[2] += 1;
@@ -218,6 +235,10 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
   sicoba[0] += 1;
   compba[2][sicoba[2]] = ba[2][20];
   sicoba[2] += 1;
+  // the radical primes closing the BAs have been moved, the BAs end one earlier
+  lastiso[0] = ba[0][23];
+  lastiso[1] = ba[1][23];
+  lastiso[2] = ba[2][22];
 
   // perform HT_NUMISO isogeny computations in the batched component
   while (total < HT_NUMISO) {
@@ -242,15 +263,25 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
       }
     }
 
-    elligator_8x1w(&T1, &T0, &A0);
-    yDBL_8x1w(&T0, &T0, &A0); 
-    yDBL_8x1w(&T0, &T0, &A0);
-    yDBL_8x1w(&T1, &T1, &A0);
-    yDBL_8x1w(&T1, &T1, &A0); 
-
-    for (i = 0; i < sicoba[m]; i++) {
-      yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
-      yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+    if (!count && first) {
+      // the first round starts from the points of point_first_8x1w(), which do
+      // not cover the primes moved to the complement above
+      for (i = SICOBA[m]; i < sicoba[m]; i++) {
+        yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
+        yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+      }
+    }
+    else {
+      elligator_8x1w(&T1, &T0, &A0);
+      yDBL_8x1w(&T0, &T0, &A0); 
+      yDBL_8x1w(&T0, &T0, &A0);
+      yDBL_8x1w(&T1, &T1, &A0);
+      yDBL_8x1w(&T1, &T1, &A0); 
+
+      for (i = 0; i < sicoba[m]; i++) {
+        yMUL_8x1w(&T0, &T0, &A0, compba[m][i]); 
+        yMUL_8x1w(&T1, &T1, &A0, compba[m][i]);
+      }
     }
 
     for (i = 0; i < sizeba[m]; i++) {
@@ -271,6 +302,18 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
         if (!f_inf) {
           bc = u8_iszero_8x1w(VSHR(ec, 1));
           point_cswap_8x1w(&G0, &G1, bc);
+#ifdef ISOG_FUSED
+          // one pass over the kernel multiples: T2, T3 are the images of T0, T1 and
+          // T0 = [l]G0 for a dummy isogeny
+          if (ba[m][i] != lastiso[m]) {
+            yMUL_8x1w(&T1, &T1, &A0, ba[m][i]);
+            yISOGEVAL_8x1w(&A1, R, &T0, &G0, &A0, Q, 2, ba[m][i]);
+
+            point_cswap_8x1w(&T0, &T2, VXOR(bc, vone));
+            point_cswap_8x1w(&T1, &T3, VXOR(bc, vone));
+          }
+          else yISOGEVAL_8x1w(&A1, NULL, NULL, &G0, &A0, NULL, 0, ba[m][i]);
+#else
           yISOG_8x1w(K, &A1, &G0, &A0, ba[m][i]);
 
           if (ba[m][i] != lastiso[m]) {
@@ -278,8 +321,7 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
             si = primeli[ba[m][i]] >> 1;
             yMUL_8x1w(&T1, &T1, &A0, ba[m][i]);
 
-            yEVAL_8x1w(&T2, &T0, K, ba[m][i]);
-            yEVAL_8x1w(&T3, &T1, K, ba[m][i]);
+            yEVALmulti_8x1w(R, Q, K, 2, ba[m][i]);
 
             yADD_8x1w(&Z, &K[si+mask-1], &G0, &K[si+mask-2]);
             point_cswap_8x1w(&Z, &K[si], VSET1(mask^1));
@@ -288,6 +330,7 @@ static void action_8x1w(htpoint_t C, __m512i* e, const __m512i *sk, const htpoin
             point_cswap_8x1w(&T0, &T2, VXOR(bc, vone));
             point_cswap_8x1w(&T1, &T3, VXOR(bc, vone));
           }
+#endif
           point_cmove_8x1w(&A0, &A1, VXOR(bc, vone));
 
           t = VSHR(ec, 1);
@@ -335,40 +378,12 @@ void action(htpoint_t C, const __m512i *sk, const htpoint_t A)
   // we now extract the variables of each instance for the low-latency component
 
   llpoint_t llC[8], llA[8];
-  uint64_t a43[8][LL_NWORDS] = {0}, a52[8][HT_NWORDS] = {0};
-  uint64_t ad43[8][LL_NWORDS] = {0}, ad52[8][HT_NWORDS] = {0};
   uint8_t lle[8][N];
 
-  // convert coefficients from Montgomery domain to number domain,
-  // because the Montgomery domain (R = 2^516) of low-latency component is different 
-  // from the Montgomery domain (R' = 2^520) of high-throughput component 
-  gfp_mont2num_8x1w(A0.y, A0.y);
-  gfp_mont2num_8x1w(A0.z, A0.z);
-
-  // extract the curve coefficient for each instance
-  get_channel_8x1w(a52[0], A0.y, 0); get_channel_8x1w(a52[1], A0.y, 1);
-  get_channel_8x1w(a52[2], A0.y, 2); get_channel_8x1w(a52[3], A0.y, 3);
-  get_channel_8x1w(a52[4], A0.y, 4); get_channel_8x1w(a52[5], A0.y, 5);
-  get_channel_8x1w(a52[6], A0.y, 6); get_channel_8x1w(a52[7], A0.y, 7);
-
-  get_channel_8x1w(ad52[0], A0.z, 0); get_channel_8x1w(ad52[1], A0.z, 1);
-  get_channel_8x1w(ad52[2], A0.z, 2); get_channel_8x1w(ad52[3], A0.z, 3);
-  get_channel_8x1w(ad52[4], A0.z, 4); get_channel_8x1w(ad52[5], A0.z, 5);
-  get_channel_8x1w(ad52[6], A0.z, 6); get_channel_8x1w(ad52[7], A0.z, 7);
-
-  // convert from radix-52 to radix-43
-  for (i = 0; i < 8; i++) {
-    mpi_conv_52to43(a43[i], a52[i], LL_NWORDS, HT_NWORDS);
-    mpi_conv_52to43(ad43[i], ad52[i], LL_NWORDS, HT_NWORDS);
-  }
-
-  // form the (2x4)-way limb vector set
-  for (i = 0; i < 8; i++) {
-    llA[i][0] = set_vector(a43[i][9] , a43[i][6], a43[i][3], a43[i][0], ad43[i][9] , ad43[i][6], ad43[i][3], ad43[i][0]);
-    llA[i][1] = set_vector(a43[i][10], a43[i][7], a43[i][4], a43[i][1], ad43[i][10], ad43[i][7], ad43[i][4], ad43[i][1]);
-    llA[i][2] = set_vector(a43[i][11], a43[i][8], a43[i][5], a43[i][2], ad43[i][11], ad43[i][8], ad43[i][5], ad43[i][2]);
-    gfp_num2mont_2x4w(llA[i], llA[i]);  // convert to Montgomery domain
-  }
+  // split the curve into one (2x4)-way point per instance; the Montgomery domain 
+  // changes from R' = 2^520 of high-throughput component to R = 2^516 of 
+  // low-latency component
+  point_ht2ll_8x1w(llA, &A0);
 
   // extract the secret exponent for each instance
   for (i = 0; i < N; i++) {
@@ -390,28 +405,8 @@ void action(htpoint_t C, const __m512i *sk, const htpoint_t A)
   // ---------------------------------------------------------------------------
   // the entire CSIDH class group action has completed at this moment
 
-  for (i = 0; i < 8; i++) gfp_mont2num_2x4w(llC[i], llC[i]);
-
-  for (i = 0; i < 8; i++) {
-    get_channel_2x4w(a43[i], llC[i], 4);
-    get_channel_2x4w(ad43[i], llC[i], 0);
-
-    mpi43_carryp(a43[i]);
-    mpi43_carryp(ad43[i]);
-
-    mpi_conv_43to52(a52[i], a43[i], HT_NWORDS, LL_NWORDS);
-    mpi_conv_43to52(ad52[i], ad43[i], HT_NWORDS, LL_NWORDS);
-  } 
-
-  // form the final (8x1)-way result
-  for (i = 0; i < HT_NWORDS; i++) {
-    C->y[i] = set_vector(a52[7][i],  a52[6][i],  a52[5][i],  a52[4][i],  a52[3][i],  a52[2][i],  a52[1][i],  a52[0][i]);
-    C->z[i] = set_vector(ad52[7][i], ad52[6][i], ad52[5][i], ad52[4][i], ad52[3][i], ad52[2][i], ad52[1][i], ad52[0][i]);
-  }
-
-  // convert from number domain to Montgomery domain
-  gfp_num2mont_8x1w(C->y, C->y);
-  gfp_num2mont_8x1w(C->z, C->z);
+  // form the final (8x1)-way result in Montgomery domain R' = 2^520
+  point_ll2ht_8x1w(C, llC);
 }
 
 // The functions below are from [CCC+19] code for generating the secret key.
@@ -455,3 +450,45 @@ void random_sk(uint8_t *sk)
   }
 }
 
+// eight random bytes, one in each 64-bit lane
+static __m512i random_u8_8x1w()
+{
+  uint64_t r;
+
+  randombytes(&r, sizeof(r));
+  return _mm512_cvtepu8_epi64(_mm_cvtsi64_si128(r));
+}
+
+// Sample nb batches of eight secret keys at once: vsk[b] is the lane-packed 
+// form (as consumed by action()) of the keys 8b, ..., 8b+7, and sk[8b+k] (if 
+// sk is not NULL) is the key 8b+k in the form of random_sk(). The exponents 
+// are sampled like in random_sk(), but by rejection from the smallest power of
+// 2 above the bound instead of from a full byte, and in all lanes at once.
+void random_sk_8x1w(__m512i (*vsk)[N], uint8_t (*sk)[N], const int nb)
+{
+  __m512i t, m, exp, sgn, bound;
+  __mmask8 rej;
+  int b, i, k;
+
+  for (b = 0; b < nb; b++) {
+    for (i = 0; i < N; i++) {
+      // exp is randomly selected from |[ 0, 2B ]|
+      bound = VSET1(B[i] << 1);
+      m = VSET1((2 << (31 - __builtin_clz(B[i] << 1))) - 1);
+      t = VAND(random_u8_8x1w(), m);
+      while ((rej = VCMPGT(t, bound))) t = VMMOV(t, rej, VAND(random_u8_8x1w(), m));
+
+      // Mapping integers from |[ 0, 2B |] into |[ -B, B ]|
+      exp = VSUB(t, VSET1(B[i]));
+      sgn = VSRA(exp, 63);              // sign of exp
+
+      // Next, to write  key[i] = e || ((1 + sgn)/2)
+      exp = VSUB(VXOR(exp, sgn), sgn);
+      vsk[b][i] = VXOR(VSHL(exp, 1), VADD(sgn, VSET1(1)));
+    }
+    if (sk)
+      for (k = 0; k < 8; k++)
+        for (i = 0; i < N; i++) sk[8*b+k][i] = (uint8_t) ((uint64_t *)&vsk[b][i])[k];
+  }
+}
+
@@ -51,6 +51,7 @@ void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
   uint8_t ba[NUMBA][MAXSIZEBA], sizeba[NUMBA], compba[NUMBA][N], sicoba[NUMBA], lastiso[NUMBA];
   uint8_t e[N], bc, ec = 0, fnsh[N] = { 0 }, mask, isocnt[N] = { 0 };
   llpoint_t A0, A1, T0, T1, T2, T3, G0, G1, K[HLMAX], Z;
+  llpoint_t *Q[2] = { &T0, &T1 }, *R[2] = { &T2, &T3 };
   int count = 0, total = 0, si, i, j, m = 0, numba = NUMBA;
 
   // Initialize SIMBA variables. 
@@ -121,8 +122,7 @@ void action_2x4w(llpoint_t C, const uint8_t *sk, const llpoint_t A)
 
             yMUL_2x4w(T1, T1, A0, ba[m][i]);
 
-            yEVAL_2x4w(T2, T0, K, ba[m][i]);
-            yEVAL_2x4w(T3, T1, K, ba[m][i]);
+            yEVALmulti_2x4w(R, Q, K, 2, ba[m][i]);
 
             yADD_2x4w(Z, K[si+mask-1], G0, K[si+mask-2]);
             point_cswap_2x4w(Z, K[si], mask^1);
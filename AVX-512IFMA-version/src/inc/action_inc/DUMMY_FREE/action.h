@@ -12,6 +12,7 @@
 
 #include "gfparith.h"
 #include "tedcurve.h"
+#include "cache.h"
 #include "rng.h"
 
 // exponent bound 
@@ -78,6 +79,19 @@ static uint8_t COMPBA[NUMBA][N] = {
   60, 61, 62, 63, 65, 66, 67, 68, 70, 71, 72, 73, 74, 74, 74, 74,
   74, 74, 74, 74, 74, 74, 74, 74, 74, 74 } };
 
+// the points T- (on the twist) and T+ (on E) the first round starts from when 
+// the curve is the base curve E: the Montgomery points x = 3 and x = 4 multiplied by 4
+// and all primes of COMPBA[1], so that their order is the product of the primes 
+// of BATCHES[1]; twisted Edwards y in radix-52 Montgomery domain, z = 1
+static uint64_t ET[2][HT_NWORDS] = {
+  { 0x61887531D4D7F, 0x8EF5B59141482, 0xD4E85B51E6A74, 0x55BE8485C0CAB,
+    0x1CFE18E35267F, 0x76117E1EAE19A, 0xC128A0AFE4C1D, 0x7EEFC2E75AF90,
+    0xB23663148B4E3, 0x0057B579168C7, },
+  { 0x3AF5DDCCD50D1, 0x32AD5258DF6DA, 0x6920828DEB96A, 0xB889652827223,
+    0x997F5F9F394FD, 0xDB5B1C4261DB8, 0xC6B47AA03CAF8, 0x386627DFA39DA,
+    0x4DC956716E64C, 0x0005CB70DA530, },
+};
+
 // parameters for hybrid-extra-infinity 
 // HT_NUMISO + LL_NUMISO = NUMISO
 static int HT_NUMISO = 646;
@@ -88,7 +102,27 @@ static uint8_t ll_idx[LL_NUMIDX] = { 60, 61, 62, 63, 64, 65, 66, 67, 68 };
 
 // -----------------------------------------------------------------------------
 
+// an instance of the queue of action_stream() (METHOD=CONTINUOUS): private key 
+// and curve (A24plus, C24) in radix-52 Montgomery domain, overwritten by sk * A 
+typedef struct {
+  uint8_t sk[N];
+  uint64_t y[HT_NWORDS], z[HT_NWORDS];
+} htinst;
+
+// the leftover state of an instance after the batched component of the combined 
+// method (METHOD=COMBINED): secret exponents, isogeny counters and the curve 
+// (A24plus, C24) in radix-52 Montgomery domain 
+typedef struct {
+  uint8_t e[N], isocnt[N];
+  uint64_t y[HT_NWORDS], z[HT_NWORDS];
+} httail;
+
 void action(htpoint_t C, const __m512i *sk, const htpoint_t A);
+int action_stream(htinst *inst, const int n);
+void action_head(httail *tail, const __m512i *sk, const htpoint_t A);
+void action_tails(httail *tail, const int n);
+int action_batches(htpoint *C, const __m512i (*sk)[N], const htpoint *A, const int nb);
 void random_sk(uint8_t *sk);
+void random_sk_8x1w(__m512i (*vsk)[N], uint8_t (*sk)[N], const int nb);
 
 #endif
\ No newline at end of file
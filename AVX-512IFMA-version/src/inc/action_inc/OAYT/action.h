@@ -12,6 +12,7 @@
 
 #include "gfparith.h"
 #include "tedcurve.h"
+#include "cache.h"
 #include "rng.h"
 
 // exponent bound 
@@ -38,16 +39,20 @@ static uint64_t E[2][HT_NWORDS] = {
 #define MAXSIZEBA 25
 
 static uint8_t SIZEBA[NUMBA] = { 25, 25, 24 };
+// the radical primes 66, 67, 68 close the BAs: a whole chain of radical isogenies
+// is one (the last) isogeny computation of the round, tried RAD_TRIES times 
 static uint8_t BATCHES[NUMBA][MAXSIZEBA] = { 
   {  0,  3,  6,  9, 12, 15, 18, 21, 24, 27, 30, 33, 
-    36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69, 72 },
+    36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 69, 72, 66 },
   {  1,  4,  7, 10, 13, 16, 19, 22, 25, 28, 31, 34, 
-    37, 40, 43, 46, 49, 52, 55, 58, 61, 64, 67, 70, 73 },
+    37, 40, 43, 46, 49, 52, 55, 58, 61, 64, 70, 73, 67 },
   {  2,  5,  8, 11, 14, 17, 20, 23, 26, 29, 32, 35, 
-    38, 41, 44, 47, 50, 53, 56, 59, 62, 65, 68, 71 }, };
+    38, 41, 44, 47, 50, 53, 56, 59, 62, 65, 71, 68 }, };
 
-static uint8_t LASTISO[NUMBA] = { 72, 73, 71 };
-static uint16_t NUMISO = 404;
+#define RAD_TRIES 2
+
+static uint8_t LASTISO[NUMBA] = { 66, 67, 68 };
+static uint16_t NUMISO = 392;
 
 static uint8_t SICOBA[NUMBA] = { 49, 49, 50 };
 static uint8_t COMPBA[NUMBA][N] = {
@@ -64,17 +69,51 @@ static uint8_t COMPBA[NUMBA][N] = {
     57, 58, 60, 61, 63, 64, 66, 67, 69, 70, 72, 73, 74, 74, 74, 74, 74, 74, 74,
     74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74 } };
 
+// the points T- (on the twist) and T+ (on E) the first round starts from when 
+// the curve is the base curve E: the Montgomery points x = 2 and x = 4 multiplied by 4
+// and all primes of COMPBA[1], so that their order is the product of the primes 
+// of BATCHES[1]; twisted Edwards y in radix-52 Montgomery domain, z = 1
+static uint64_t ET[2][HT_NWORDS] = {
+  { 0x59CEFA6B63C2C, 0x27CFE69D9FE40, 0x2439F8AB07B74, 0x854CC2B6F4932,
+    0xBF85EDC0F5483, 0xB7E97D372FC6A, 0x2A17FC6F3D9C3, 0x0EAAECC8835B7,
+    0xCF40ACC2660E1, 0x0033984E1CAB0, },
+  { 0x2B4B6A3C9A23A, 0x9548903D41F12, 0xA20E2770FEFB4, 0x63B29A28CA9DD,
+    0xBD5829C478E56, 0x04E2FA708B2E3, 0x53BF862C23997, 0x54BC59A41E969,
+    0x07DC7452EBD24, 0x001A277323693, },
+};
+
 // parameters for extra-infinity 
-// HT_NUMISO + LL_NUMISO = NUMISO
+// HT_NUMISO + LL_NUMISO = NUMISO - 3*(RAD_TRIES-1), the radical primes are all
+// computed in the unbatched component, one chain each 
 static int HT_NUMISO = 358;
-static int LL_NUMISO = 46;
+static int LL_NUMISO = 31;
 
 #define LL_NUMIDX 7 
 static uint8_t ll_idx[LL_NUMIDX] = { 62, 63, 64, 65, 66, 67, 68 };
 
 // -----------------------------------------------------------------------------
 
+// an instance of the queue of action_stream() (METHOD=CONTINUOUS): private key 
+// and curve (A24plus, C24) in radix-52 Montgomery domain, overwritten by sk * A 
+typedef struct {
+  uint8_t sk[N];
+  uint64_t y[HT_NWORDS], z[HT_NWORDS];
+} htinst;
+
+// the leftover state of an instance after the batched component of the combined 
+// method (METHOD=COMBINED): secret exponents, isogeny counters and the curve 
+// (A24plus, C24) in radix-52 Montgomery domain 
+typedef struct {
+  uint8_t e[N], isocnt[N];
+  uint64_t y[HT_NWORDS], z[HT_NWORDS];
+} httail;
+
 void action(htpoint_t C, const __m512i *sk, const htpoint_t A);
+int action_stream(htinst *inst, const int n);
+void action_head(httail *tail, const __m512i *sk, const htpoint_t A);
+void action_tails(httail *tail, const int n);
+int action_batches(htpoint *C, const __m512i (*sk)[N], const htpoint *A, const int nb);
 void random_sk(uint8_t *sk);
+void random_sk_8x1w(__m512i (*vsk)[N], uint8_t (*sk)[N], const int nb);
 
 #endif
\ No newline at end of file
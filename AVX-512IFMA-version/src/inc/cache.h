@@ -0,0 +1,30 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#ifndef _CACHE_H
+#define _CACHE_H
+
+#include "tedcurve.h"
+
+#define HT_CACHE_SIZE  16               // largest number of cached curves
+#define HT_CACHE_TRIES 8                // Elligator calls (of 8 u's each) per added curve
+
+// one cached curve: the Montgomery coefficient A in [0, p) in radix-64, and the
+// projective (y:z) of the first-round points T- and T+ on it in radix-52
+// Montgomery domain
+typedef struct {
+  uint64_t a[8];
+  uint64_t t[2][2][HT_NWORDS];
+} htcache;
+
+int cache_add(const uint64_t a[8]);
+void cache_clear();
+int point_first_8x1w(htpoint_t T0, htpoint_t T1, const htpoint_t A);
+
+#endif
@@ -47,6 +47,27 @@ static const uint64_t ht_montR2[HT_NWORDS] = {
   0xE3AA0C3B19E9E, 0x3A0C5CE31A621, 0x114C5DF09803F, 0x702F11A883DAD,
   0x94ECD5F5EC3F3, 0x00034FA8BE69F, };
 
+// 2^516 mod p, maps a * 2^520 to a * 2^516 (HT to LL Montgomery domain)
+static const uint64_t ht_ht2ll[HT_NWORDS] = {
+  0xB172FE8F0ACC8, 0xD24D05B7B3B3B, 0x63BA2199E2BA1, 0xB6DB47E0601B2,
+  0xDCD50F127C1FA, 0xA080F9029077D, 0x6CAD8AA15A1C8, 0x46441453D8F6B,
+  0x27A008A545F49, 0x001BC9B995DD9, };
+
+// 2^524 mod p, maps a * 2^516 to a * 2^520 (LL to HT Montgomery domain)
+static const uint64_t ht_ll2ht[HT_NWORDS] = {
+  0x05181FC18BED9, 0x71642E5D63512, 0xD95C470C2E049, 0xF04EEF8FF421D,
+  0xF1FE9948CF620, 0x95D77CE817795, 0x2F69307D3E61A, 0xDD49C3B666939,
+  0x9DFCB42FDA0D7, 0x00600F29334A4, };
+
+// p * 2^516 in a redundant radix-52 form with every column >= 2^58 - 2^6 except
+// the top one, used to keep a*b - c*d non-negative column by column
+static const uint64_t ht_pbias[2*HT_NWORDS] = {
+  0x400000000000000, 0x3FFFFFFFFFFFFC0, 0x3FFFFFFFFFFFFC0, 0x3FFFFFFFFFFFFC0,
+  0x3FFFFFFFFFFFFC0, 0x3FFFFFFFFFFFFC0, 0x3FFFFFFFFFFFFC0, 0x3FFFFFFFFFFFFC0,
+  0x3FFFFFFFFFFFFC0, 0x40AFFFFFFFFFFC0, 0x4081B90533C6C47, 0x40BF457ACA834DB,
+  0x401F0B4F25C26E1, 0x40355075167308C, 0x40CDA7AAC6C563F, 0x40AFBFCC6932289,
+  0x40083AEDC88C3E5, 0x4015E3E4C4AB3ED, 0x400F89BFFC8AACD, 0x0000065B48E8F34, };
+
 // -----------------------------------------------------------------------------
 // radix-43 parameters and constants for Low-Latency (LL) implementations
 
@@ -82,6 +103,17 @@ static const uint64_t ll_montR2[LL_NWORDS] = {
   0x50EDA6B9700, 0x30118B01CBE, 0x326643EEEC2, 0x4B7B05A78F3, 
   0x7377415838D, 0x5864018C56A, 0x633D0C02F46, 0x016D9B5D997, }; 
 
+// -----------------------------------------------------------------------------
+// signed radix-26 parameters for the safegcd inversion [BY19] of HT field elements
+
+#define SG_BRADIX 26                    // limb size, also the number of divsteps per iteration
+#define SG_NWORDS 20                    // limb number (two per radix-52 limb)
+#define SG_BMASK  0x3FFFFFFULL          // 2^26 - 1
+#define SG_NITERS 57                    // 57*26 = 1482 >= 1477 divsteps needed for 511-bit p
+#define SG_PINV   0xD1D6B3              // p^(-1) mod 2^26
+#define JC_NITERS 40                    // 40*26 = 1040 >= 2*511-1 binary GCD steps needed for the
+                                        // Jacobi symbol with 511-bit p [Por20]
+
 // -----------------------------------------------------------------------------
 // radix-64 constants 
 
@@ -100,24 +132,149 @@ static const uint64_t u64_pdiv2[8] = {
   0x8dc0dc8299e3643d, 0xe1390dfa2bd6541a, 0xa8b398660f85a792, 0xd3d56362b3f9aa83,
   0x2d7dfe63499164e6, 0x5a16841d76e44621, 0xfe455868af1f2625, 0x32da4747ba07c4df, };
 
+// -----------------------------------------------------------------------------
+// fixed sliding-window (w = 5) chains of the exponents (p-2) and (p-1)/2, and of
+// the root exponents (p+1)/4 and 1/l mod (p-1) for l = 3, 5, 7 (radical isogenies)
+// each step {s, k} means r = r^(2^s) * a^(2k+1), the first step means r = a^(2k+1)
+
+#define EXP_WINTBL 16                   // number of precomputed odd powers a^1, a^3, ..., a^31
+#define EXP_CHNLEN 85                   // number of steps in the chain
+#define EXP_SQRTLEN 84
+#define EXP_CBRTLEN 85
+#define EXP_RT5LEN  86
+#define EXP_RT7LEN  86
+
+static const uint8_t psub2_chain[EXP_CHNLEN][2] = {
+  { 0, 12}, { 6, 13}, { 5,  4}, { 8, 14}, { 7,  7}, { 6, 14}, {11, 15}, { 8,  9},
+  { 6, 15}, { 5, 15}, { 5, 12}, { 8, 10}, { 3,  1}, { 8,  6}, { 8, 10}, { 3,  3},
+  { 8, 15}, { 7,  9}, { 7,  4}, { 6, 10}, { 3,  2}, { 8,  5}, { 2,  0}, { 5,  0},
+  {10, 14}, { 6, 14}, { 5, 11}, { 7,  8}, { 5,  1}, { 4,  0}, { 8,  4}, { 5,  6},
+  { 6, 15}, { 6, 15}, { 3,  3}, { 4,  1}, { 7,  6}, { 7,  9}, { 7,  8}, { 6, 12},
+  { 5,  3}, { 7, 13}, { 6,  9}, { 4,  6}, { 6, 10}, { 5,  8}, { 4,  5}, { 8, 10},
+  { 5,  9}, { 5, 15}, { 6,  6}, { 6, 10}, {10, 14}, { 6,  8}, { 6, 12}, { 5, 12},
+  { 1,  0}, { 9, 12}, { 1,  0}, {10, 15}, { 8,  5}, { 6,  9}, { 5, 12}, { 7, 11},
+  { 9,  9}, { 4,  4}, { 9, 13}, { 4,  7}, { 6,  8}, { 6, 11}, { 5, 10}, { 4,  4},
+  { 4,  2}, { 9,  6}, { 6,  8}, { 5, 11}, {11, 13}, { 4,  4}, { 8,  2}, { 7, 12},
+  { 3,  3}, { 8, 13}, { 3,  0}, { 8,  7}, { 3,  0},
+};
+
+static const uint8_t pdiv2_chain[EXP_CHNLEN][2] = {
+  { 0, 12}, { 6, 13}, { 5,  4}, { 8, 14}, { 7,  7}, { 6, 14}, {11, 15}, { 8,  9},
+  { 6, 15}, { 5, 15}, { 5, 12}, { 8, 10}, { 3,  1}, { 8,  6}, { 8, 10}, { 3,  3},
+  { 8, 15}, { 7,  9}, { 7,  4}, { 6, 10}, { 3,  2}, { 8,  5}, { 2,  0}, { 5,  0},
+  {10, 14}, { 6, 14}, { 5, 11}, { 7,  8}, { 5,  1}, { 4,  0}, { 8,  4}, { 5,  6},
+  { 6, 15}, { 6, 15}, { 3,  3}, { 4,  1}, { 7,  6}, { 7,  9}, { 7,  8}, { 6, 12},
+  { 5,  3}, { 7, 13}, { 6,  9}, { 4,  6}, { 6, 10}, { 5,  8}, { 4,  5}, { 8, 10},
+  { 5,  9}, { 5, 15}, { 6,  6}, { 6, 10}, {10, 14}, { 6,  8}, { 6, 12}, { 5, 12},
+  { 1,  0}, { 9, 12}, { 1,  0}, {10, 15}, { 8,  5}, { 6,  9}, { 5, 12}, { 7, 11},
+  { 9,  9}, { 4,  4}, { 9, 13}, { 4,  7}, { 6,  8}, { 6, 11}, { 5, 10}, { 4,  4},
+  { 4,  2}, { 9,  6}, { 6,  8}, { 5, 11}, {11, 13}, { 4,  4}, { 8,  2}, { 7, 12},
+  { 3,  3}, { 8, 13}, { 3,  0}, { 8,  7}, { 2,  0},
+};
+
+static const uint8_t sqrt_chain[EXP_SQRTLEN][2] = {
+  { 0, 12}, { 6, 13}, { 5,  4}, { 8, 14}, { 7,  7}, { 6, 14}, {11, 15}, { 8,  9},
+  { 6, 15}, { 5, 15}, { 5, 12}, { 8, 10}, { 3,  1}, { 8,  6}, { 8, 10}, { 3,  3},
+  { 8, 15}, { 7,  9}, { 7,  4}, { 6, 10}, { 3,  2}, { 8,  5}, { 2,  0}, { 5,  0},
+  {10, 14}, { 6, 14}, { 5, 11}, { 7,  8}, { 5,  1}, { 4,  0}, { 8,  4}, { 5,  6},
+  { 6, 15}, { 6, 15}, { 3,  3}, { 4,  1}, { 7,  6}, { 7,  9}, { 7,  8}, { 6, 12},
+  { 5,  3}, { 7, 13}, { 6,  9}, { 4,  6}, { 6, 10}, { 5,  8}, { 4,  5}, { 8, 10},
+  { 5,  9}, { 5, 15}, { 6,  6}, { 6, 10}, {10, 14}, { 6,  8}, { 6, 12}, { 5, 12},
+  { 1,  0}, { 9, 12}, { 1,  0}, {10, 15}, { 8,  5}, { 6,  9}, { 5, 12}, { 7, 11},
+  { 9,  9}, { 4,  4}, { 9, 13}, { 4,  7}, { 6,  8}, { 6, 11}, { 5, 10}, { 4,  4},
+  { 4,  2}, { 9,  6}, { 6,  8}, { 5, 11}, {11, 13}, { 4,  4}, { 8,  2}, { 7, 12},
+  { 3,  3}, { 8, 13}, { 3,  0}, { 9, 15},
+};
+
+static const uint8_t cbrt_chain[EXP_CBRTLEN][2] = {
+  { 0,  0}, { 8,  7}, { 7, 13}, { 5,  6}, { 8, 11}, { 5, 14}, { 8, 10}, { 5, 10},
+  {10, 12}, { 5, 15}, { 5, 15}, { 5, 13}, { 3,  1}, { 6,  3}, { 6,  5}, { 7, 13},
+  { 8, 15}, { 5,  6}, { 2,  0}, { 9, 12}, { 6, 13}, { 5,  8}, { 3,  3}, {10,  7},
+  {11, 10}, { 4,  7}, { 7,  9}, { 4,  6}, { 8,  5}, { 6, 12}, { 5,  6}, { 6, 13},
+  { 5,  9}, { 5, 10}, { 7, 10}, { 6,  8}, { 9,  8}, { 5,  8}, { 9, 11}, { 4,  1},
+  { 8,  9}, { 6,  7}, { 6,  2}, { 6,  3}, { 3,  0}, { 8,  4}, { 8,  3}, { 6,  6},
+  { 4,  2}, { 8,  8}, { 2,  1}, { 8, 10}, { 4,  7}, { 8, 11}, { 6,  6}, { 4,  0},
+  {10,  8}, { 9,  2}, { 6,  5}, { 7,  8}, { 3,  2}, { 4,  1}, { 8,  7}, { 5,  5},
+  { 5,  7}, { 5,  6}, { 5,  7}, { 4,  2}, { 7, 13}, { 8, 15}, { 4,  4}, { 7,  3},
+  {11,  8}, { 4,  5}, { 6,  7}, { 6, 10}, { 5, 14}, { 9, 10}, { 2,  1}, { 8,  8},
+  { 2,  0}, { 8,  4}, { 8,  5}, { 6,  9}, { 1,  0},
+};
+
+static const uint8_t rt5_chain[EXP_RT5LEN][2] = {
+  { 0,  7}, { 2,  0}, {10, 11}, { 5, 11}, { 4,  4}, { 7,  5}, { 6, 15}, { 6,  7},
+  { 3,  0}, { 9, 11}, { 6, 12}, { 4,  4}, { 5,  7}, { 9, 12}, { 5, 10}, { 9, 11},
+  { 5,  3}, { 8,  8}, { 5,  7}, { 8, 14}, { 1,  0}, {14,  5}, { 5,  6}, { 7,  9},
+  { 4,  6}, { 8,  9}, { 1,  0}, {10, 14}, { 5, 14}, { 6, 14}, { 6,  8}, { 2,  1},
+  { 8, 13}, { 5,  4}, { 4,  3}, { 4,  1}, { 6,  2}, { 9, 15}, { 5,  8}, { 3,  3},
+  { 8,  6}, { 3,  1}, { 7,  4}, { 7,  1}, { 7,  5}, { 7, 12}, { 5, 13}, { 3,  2},
+  { 9, 12}, { 4,  7}, { 7, 11}, { 4,  5}, { 7, 12}, { 7, 14}, { 5, 15}, { 4,  5},
+  { 5,  4}, { 6,  2}, { 9,  7}, { 6,  9}, { 5, 12}, {10, 13}, { 6,  4}, { 7,  5},
+  { 4,  2}, { 7, 15}, { 5,  7}, { 5,  0}, { 6,  1}, { 8, 11}, { 5,  3}, { 7,  6},
+  { 8, 12}, { 7, 14}, { 4,  4}, { 6, 10}, { 8,  6}, { 4,  2}, { 8,  8}, { 4,  5},
+  { 5,  2}, { 6,  4}, { 4,  0}, {10,  8}, { 3,  3}, { 5,  1},
+};
+
+static const uint8_t rt7_chain[EXP_RT7LEN][2] = {
+  { 0, 14}, { 8,  7}, { 6,  0}, { 7,  2}, { 8, 15}, { 4,  4}, { 6,  5}, { 6, 11},
+  { 6,  6}, { 6,  4}, { 7,  8}, { 6,  9}, { 9, 12}, { 2,  0}, { 9,  9}, { 5, 13},
+  { 6,  5}, { 6, 11}, { 5,  8}, { 5,  3}, { 6,  7}, { 4,  2}, { 7, 10}, { 1,  0},
+  {11,  4}, { 6, 12}, { 5, 15}, { 5,  5}, { 7, 11}, { 7, 10}, { 5, 12}, { 7, 14},
+  { 9, 13}, { 5,  4}, { 3,  0}, { 8,  3}, { 8, 11}, { 5,  8}, { 6,  9}, { 8, 10},
+  { 7,  5}, { 8, 11}, { 4,  7}, { 6,  7}, { 6,  9}, { 2,  0}, { 8,  1}, { 7,  5},
+  { 5,  6}, { 2,  0}, { 6,  1}, { 8,  4}, { 6, 12}, { 5, 13}, { 4,  6}, { 6,  8},
+  { 6, 11}, { 8, 10}, { 5, 11}, { 4,  7}, { 6, 14}, { 8,  5}, { 6,  9}, { 3,  2},
+  { 7,  4}, { 6, 15}, { 1,  0}, {12, 15}, { 4,  7}, { 7, 10}, { 5,  6}, { 6, 10},
+  { 3,  3}, { 7, 13}, { 5, 10}, { 6,  9}, { 6,  8}, { 5,  2}, { 4,  0}, { 9,  4},
+  { 6, 10}, { 9,  8}, { 2,  0}, { 7,  3}, { 5,  2}, { 7,  7},
+};
+
 // -----------------------------------------------------------------------------
 // (8x1)-way prime-field operations
+//
+// Lazy reduction: gfp_addnr/subnr_8x1w neither propagate carries nor reduce,
+// so several of them can be chained before a single gfp_carryp_8x1w, which must
+// be called before the result enters any other operation (IFMA only reads the
+// low 52 bits of a limb). Their bounds, written as [0, kp), are tracked in the
+// comments of the caller. gfp_mul/sqr_8x1w accept a * b < 2^520 * p (e.g., a, b
+// in [0, 16p)), gfp_muladd_8x1w accepts a * b + c * d < 2^520 * p, and 
+// gfp_mulsub/muladdsub_8x1w additionally need c * d < 2^1026 (e.g., c in [0, 2p)
+// and d in [0, 8p)), gfp_dotp/dotpr_8x1w accept up to 128 products of inputs 
+// in [0, 2p); all of them return r in [0, 2p). The other operations 
+// expect inputs in [0, 2p).
 
 void gfp_add_8x1w(htfe_t r, const htfe_t a, const htfe_t b);
 void gfp_sub_8x1w(htfe_t r, const htfe_t a, const htfe_t b);
+void gfp_addnr_8x1w(htfe_t r, const htfe_t a, const htfe_t b);
+void gfp_subnr_8x1w(htfe_t r, const htfe_t a, const htfe_t b);
 void gfp_mul_8x1w(htfe_t r, const htfe_t a, const htfe_t b);
 void gfp_sqr_8x1w(htfe_t r, const htfe_t a);
+void gfp_mul2_8x1w(htfe_t r, const htfe_t a, const htfe_t b, htfe_t s, const htfe_t c, const htfe_t d);
+void gfp_sqr2_8x1w(htfe_t r, const htfe_t a, htfe_t s, const htfe_t c);
+void gfp_mulka_8x1w(htfe_t r, const htfe_t a, const htfe_t b);
+void gfp_sqrka_8x1w(htfe_t r, const htfe_t a);
+void gfp_muladd_8x1w(htfe_t r, const htfe_t a, const htfe_t b, const htfe_t c, const htfe_t d);
+void gfp_mulsub_8x1w(htfe_t r, const htfe_t a, const htfe_t b, const htfe_t c, const htfe_t d);
+void gfp_muladdsub_8x1w(htfe_t r, htfe_t s, const htfe_t a, const htfe_t b, const htfe_t c, const htfe_t d);
+void gfp_dotp_8x1w(htfe_t r, const htfe_t *a, const htfe_t *b, const int n);
+void gfp_dotpr_8x1w(htfe_t r, const htfe_t *a, const htfe_t *b, const int n);
 void gfp_pow_8x1w(htfe_t r, const htfe_t a, const uint64_t *e);
+void gfp_powchn_8x1w(htfe_t r, const htfe_t a, const uint8_t (*c)[2], const int n);
 void gfp_inv_8x1w(htfe_t r, const htfe_t a);
+void gfp_sginv_8x1w(htfe_t r, const htfe_t a);
 void gfp_rdcp_8x1w(htfe_t r, const htfe_t a);
+void gfp_carryp_8x1w(htfe_t r);
 void gfp_zero_8x1w(htfe_t r);
 void gfp_num2mont_8x1w(htfe_t r, const htfe_t a);
 void gfp_mont2num_8x1w(htfe_t r, const htfe_t a);
 void gfp_copy_8x1w(htfe_t r, const htfe_t a);
 void gfp_cmove_8x1w(htfe_t r, htfe_t a, const __m512i b);
 void gfp_cswap_8x1w(htfe_t r, htfe_t a, const __m512i b);
+__m512i gfp_euler_8x1w(const htfe_t a);
+__m512i gfp_jacobi_8x1w(const htfe_t a);
 __m512i gfp_issqr_8x1w(const htfe_t a);
 __m512i gfp_iszero_8x1w(const htfe_t a);
+void gfp_ht2ll_8x1w(__m512i *r, const htfe_t a);
+void gfp_ll2ht_8x1w(htfe_t r, const __m512i *a);
 
 // -----------------------------------------------------------------------------
 // (2x4)-way prime-field operations
@@ -129,6 +286,7 @@ void gfp_subaddc_2x4w(llfe_t rs, const llfe_t ac, const llfe_t bd);
 void gfp_mul_2x4w(llfe_t r, const llfe_t a, const llfe_t b);
 void gfp_sqr_2x4w(llfe_t r, const llfe_t a);
 void gfp_pow_2x4w(llfe_t r, const llfe_t a, const uint64_t *e);
+void gfp_powchn_2x4w(llfe_t r, const llfe_t a, const uint8_t (*c)[2], const int n);
 void gfp_inv_2x4w(llfe_t r, const llfe_t a);
 void gfp_rdcp_2x4w(llfe_t r, const llfe_t a);
 void gfp_carryp_2x4w(llfe_t r);
@@ -138,6 +296,8 @@ void gfp_mont2num_2x4w(llfe_t r, const llfe_t a);
 void gfp_copy_2x4w(llfe_t r, const llfe_t a);
 void gfp_cmove_2x4w(llfe_t r, llfe_t a, const uint8_t b);
 void gfp_cswap_2x4w(llfe_t r, llfe_t a, const uint8_t b);
+uint8_t gfp_euler_2x4w(const llfe_t a);
+uint8_t gfp_jacobi_2x4w(const llfe_t a);
 uint8_t gfp_issqr_2x4w(const llfe_t a);
 uint8_t gfp_iszero_2x4w(const llfe_t a);
 void vec_permlh_2x4w(llfe_t r, const llfe_t a);
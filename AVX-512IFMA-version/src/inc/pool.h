@@ -0,0 +1,61 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#ifndef _POOL_H
+#define _POOL_H
+
+#include <pthread.h>
+#include "tedcurve.h"
+
+#define POOL_MAXTHREADS 256             // largest number of worker threads 
+#define POOL_QLEN       1024            // capacity of each per-worker queue (power of 2)
+#ifdef ISOG_FUSED
+#define POOL_STACK      (1<<20)         // stack size of a worker (the action needs < 512 KB)
+#else
+#define POOL_STACK      (8<<20)         // stack size of a worker (same as the main stack)
+#endif
+
+// one (8x1)-way group action C = sk * A 
+typedef struct {
+  __m512i sk[N];
+  htpoint A, C;
+} pool_job;
+
+// queue of jobs of one worker: the owner takes the oldest job (head), the other
+// workers steal the newest one (tail)
+typedef struct {
+  pthread_mutex_t lock;
+  pool_job *job[POOL_QLEN];
+  size_t head, tail;
+} pool_queue;
+
+typedef struct pool_t pool_t;
+
+struct pool_worker {
+  pool_t *pool;
+  int id, cpu;
+  pthread_t thread;
+};
+
+struct pool_t {
+  int nthreads, next;
+  pthread_mutex_t lock;                 // protects queued, pending and stop
+  pthread_cond_t work, done;
+  size_t queued, pending;
+  int stop;
+  pool_queue queue[POOL_MAXTHREADS];
+  struct pool_worker worker[POOL_MAXTHREADS];
+};
+
+pool_t *pool_create(const int nthreads, const int *cpus);
+int pool_submit(pool_t *pool, pool_job *job);
+void pool_wait(pool_t *pool);
+void pool_destroy(pool_t *pool);
+
+#endif
@@ -15,7 +15,11 @@
 #include <fcntl.h>
 #include "gfparith.h"
 
+#define RNG_LANES 16                  // ChaCha20 blocks per refill, one per 32-bit lane
+
+void chacha20_16x1w(__m512i *r, const uint32_t *key, const uint32_t *nonce, const uint32_t ctr);
 void randombytes(void *r, size_t len);
+void rng_seed(const uint8_t *seed);
 void mpi64_random(uint64_t *r);
 
 #endif
@@ -38,6 +38,27 @@ typedef llfe_t llpoint_t;
 
 #define HLMAX 294                       // (587+1)/2 = 294  
 
+// the isogenies of degree l >= SV_LMIN use the sqrt-Velu formulae [BDLS20] 
+// instead of Velu's, the threshold is the crossover measured by timing_sqrtvelu()
+// in main_ht.c (sqrt-Velu needs l >= 17)
+#define SV_LMIN 113
+#define SV_BMAX 24                      // the largest b and b' of sqrt-Velu (l = 587)
+#define SV_DMAX 12                      // the largest d = 2b of sqrt-Velu (l = 587)
+
+// the most points yISOGEVAL_8x1w() pushes through the isogeny it computes
+#define ISOG_NQMAX 2
+
+// the most points yEVALmulti_8x1w() and yEVALmulti_2x4w() push through an isogeny
+// in one pass over its kernel multiples
+#define EVAL_NQMAX 4
+
+// the isogenies of degree l = 7, 5, 3 (k = 66, 67, 68) are computed in chains of
+// radical isogenies [CDV20] by the OAYT group action, see radical_8x1w(); the 
+// dummy-free one keeps Velu's formulae, since a chain has dummy steps 
+#define RAD_KMIN 66
+#define RAD_KMAX 68
+#define RADICAL(k) ((k) >= RAD_KMIN && (k) <= RAD_KMAX)
+
 // small primes l_i
 static int primeli[N] = { 
   349, 347, 337, 331, 317, 313, 311, 307, 293, 283, 281, 277, 271, 
@@ -72,6 +93,163 @@ static uint8_t addc_len[N] = {
    7,  7,  7,  7,  7,  7,  7,  6,  6,  6,  6,  5,  5,  5,  4,  4,
    3,  3,  2,  1,  0, 12, 11, 11, 11, 11 }; 
 
+#ifdef ELLIGATOR_FIXED
+// the public Elligator inputs u = 2, 3, ..., ELL_NU+1 of the fixed-u mode (see 
+// elligator_8x1w and elligator_2x4w), they are all in [2, (p-1)/2]
+#define ELL_NU 8
+
+// u, u^2, u^2+1 and u^2-1 in Montgomery domain R' = 2^520 (radix-52)
+static const uint64_t ht_ellu[ELL_NU][4][HT_NWORDS] = {
+  { // u = 2
+   { 0x51DD37FDF5528, 0xA6E351B4CD9B5, 0xF19CA05B1E35A, 0x332E70D27D03C,
+     0xC6CC7EECCFFBC, 0x3038EBB8F8AD4, 0x783A6FE52263C, 0xD69028257D6E9,
+     0x2F2116636629D, 0x004B92BE4011D, },
+   { 0x882A1CBF7E1D5, 0x596EF6C1661B2, 0xF2844E5A15499, 0x1155903DC93B7,
+     0xB31E516D49785, 0x647510DECE90C, 0x6CC6034180A1D, 0x4EE2040046B02,
+     0x65A62CFE2146A, 0x003170EDF0AF9, },
+   { 0x3118B8BE78C69, 0xACE09F9BCCE8D, 0x6B529E87A4646, 0x2AECC8A707BD6,
+     0x168490E3B1763, 0x7C9186BB4AE77, 0x28E33B3411D3B, 0x3A2A181305677,
+     0xFD36B82FD45B9, 0x00573A4D10B87, },
+   { 0xDF3B80C083741, 0x05FD4DE6FF4D7, 0x79B5FE2C862EC, 0xF7BE57D48AB99,
+     0x4FB811F6E17A6, 0x4C589B02523A2, 0xB0A8CB4EEF6FF, 0x6399EFED87F8D,
+     0xCE15A1CC6E31B, 0x000BA78ED0A6A, },
+  },
+  { // u = 3
+   { 0xDF3B80C083741, 0x05FD4DE6FF4D7, 0x79B5FE2C862EC, 0xF7BE57D48AB99,
+     0x4FB811F6E17A6, 0x4C589B02523A2, 0xB0A8CB4EEF6FF, 0x6399EFED87F8D,
+     0xCE15A1CC6E31B, 0x000BA78ED0A6A, },
+   { 0x9DB282418A5C3, 0x11F7E9B4FDE87, 0x6D21FA85928C4, 0xE73B077DA02CC,
+     0xEF2835E4A46F4, 0xE509D106F6AE6, 0x11FA61ECCE4FD, 0x2ACDCFC897EA9,
+     0x6A40E5654A952, 0x0022F6AC71F40, },
+   { 0x46A11E4085057, 0x6569928F64B62, 0xE5F04AB321A71, 0x00D23FE6DEAEA,
+     0x528E755B0C6D3, 0xFD2646E373051, 0xCE1799DF5F81B, 0x1615E3DB56A1D,
+     0x01D17096FDAA1, 0x0048C00B91FCF, },
+   { 0x1054397EFC3AA, 0xB2DDED82CC365, 0xE5089CB42A932, 0x22AB207B9276F,
+     0x663CA2DA92F0A, 0xC8EA21BD9D219, 0xD98C06830143A, 0x9DC408008D604,
+     0xCB4C59FC428D4, 0x0062E1DBE15F2, },
+  },
+  { // u = 4
+   { 0x882A1CBF7E1D5, 0x596EF6C1661B2, 0xF2844E5A15499, 0x1155903DC93B7,
+     0xB31E516D49785, 0x647510DECE90C, 0x6CC6034180A1D, 0x4EE2040046B02,
+     0x65A62CFE2146A, 0x003170EDF0AF9, },
+   { 0x05181FC18BED9, 0x71642E5D63512, 0xD95C470C2E049, 0xF04EEF8FF421D,
+     0xF1FE9948CF620, 0x95D77CE817795, 0x2F69307D3E61A, 0xDD49C3B666939,
+     0x9DFCB42FDA0D7, 0x00600F29334A4, },
+   { 0x927668841A0F2, 0xD07E2A8F95034, 0x6175A4DD95FDA, 0xB4DED69201D7A,
+     0x7AEA2C52E0E0B, 0xB1F72C3171063, 0x67D78BE70B6DD, 0x6A538B7E711DD,
+     0x3CF13F98E2155, 0x002023F9C3DF2, },
+   { 0x5C2983C291445, 0x1DF28582FC837, 0x608DF6DE9EE9C, 0xD6B7B726B59FF,
+     0x8E9859D267642, 0x7DBB070B9B22B, 0x734BF88AAD2FC, 0xF201AFA3A7DC4,
+     0x066C28FE26F88, 0x003A45CA13416, },
+  },
+  { // u = 5
+   { 0x3118B8BE78C69, 0xACE09F9BCCE8D, 0x6B529E87A4646, 0x2AECC8A707BD6,
+     0x168490E3B1763, 0x7C9186BB4AE77, 0x28E33B3411D3B, 0x3A2A181305677,
+     0xFD36B82FD45B9, 0x00573A4D10B87, },
+   { 0x873A4EC6A9C21, 0x8F046B6A2C1E1, 0x55C94F35996F1, 0x8282A5A663828,
+     0x06AC22C11D522, 0x7EE4875BEB5E0, 0xBDB4B5E1488BD, 0xA9D947344A511,
+     0x0FA199CC79958, 0x001D514715CA4, },
+   { 0x3028EAC5A46B5, 0xE276144492EBC, 0xCE979F632889E, 0x9C19DE0FA2046,
+     0x6A12623785500, 0x9700FD3867B4A, 0x79D1EDD3D9BDB, 0x95215B4709086,
+     0xA73224FE2CAA7, 0x00431AA635D32, },
+   { 0xF9DC06041BA08, 0x2FEA6F37FA6BE, 0xCDAFF16431760, 0xBDF2BEA455CCB,
+     0x7DC08FB70BD37, 0x62C4D81291D12, 0x85465A777B7FA, 0x1CCF7F6C3FC6D,
+     0x70AD0E63718DB, 0x005D3C7685356, },
+  },
+  { // u = 6
+   { 0xBE77018106E82, 0x0BFA9BCDFE9AF, 0xF36BFC590C5D8, 0xEF7CAFA915732,
+     0x9F7023EDC2F4D, 0x98B13604A4744, 0x6151969DDEDFE, 0xC733DFDB0FF1B,
+     0x9C2B4398DC636, 0x00174F1DA14D5, },
+   { 0x5B39B5C9BCE91, 0x5387FA2BC2866, 0xC3D2F7BA230F4, 0x47E4CC8F4FE6F,
+     0xE2262B263B3E0, 0x982A7D88B7EFE, 0xC43AAB2A7519C, 0x4CF8F2D7AB7D3,
+     0xB06795CC7F477, 0x00262623385C0, },
+   { 0x042851C8B7925, 0xA6F9A30629541, 0x3CA147E7B22A1, 0x617C04F88E68E,
+     0x458C6A9CA33BE, 0xB046F36534469, 0x8057E31D064BA, 0x384106EA6A348,
+     0x47F820FE325C6, 0x004BEF825864F, },
+   { 0xB24B19CAC23FD, 0x001651515BB8B, 0x4B04A78C93F47, 0x2E4D942611651,
+     0x7EBFEBAFD3402, 0x800E07AC3B994, 0x081D7337E3E7E, 0x61B0DEC4ECC5F,
+     0x18D70A9ACC328, 0x00005CC418532, },
+  },
+  { // u = 7
+   { 0x67659D8001916, 0x5F6C44A86568A, 0x6C3A4C869B785, 0x0913E81253F51,
+     0x02D663642AF2C, 0xB0CDABE120CAF, 0x1D6ECE907011C, 0xB27BF3EDCEA90,
+     0x33BBCECA8F785, 0x003D187CC1564, },
+   { 0x6586018E58DAE, 0xCA972DF9F16E8, 0x32C44E3DA3C35, 0xEB6E12E388832,
+     0xA9F2060BD2A66, 0xE5AC98DB5A655, 0xBF4C33CFFFE5C, 0x686A7A55D5EAE,
+     0x87B2A86740162, 0x0014D92F0B8B9, },
+   { 0x0E749D8D53842, 0x1E08D6D4583C3, 0xAB929E6B32DE3, 0x05054B4CC7050,
+     0x0D5845823AA45, 0xFDC90EB7D6BC0, 0x7B696BC29117A, 0x53B28E6894A23,
+     0x1F433398F32B1, 0x003AA28E2B948, },
+   { 0xD827B8CBCAB95, 0x6B7D31C7BFBC5, 0xAAAAF06C3BCA4, 0x26DE2BE17ACD5,
+     0x21067301C127C, 0xC98CE99200D88, 0x86DDD86632D99, 0xDB60B28DCB60A,
+     0xE8BE1CFE380E4, 0x0054C45E7AF6B, },
+  },
+  { // u = 8
+   { 0x1054397EFC3AA, 0xB2DDED82CC365, 0xE5089CB42A932, 0x22AB207B9276F,
+     0x663CA2DA92F0A, 0xC8EA21BD9D219, 0xD98C06830143A, 0x9DC408008D604,
+     0xCB4C59FC428D4, 0x0062E1DBE15F2, },
+   { 0xC1AF8550EA1F3, 0xE889B37CEDF1F, 0x9352451C42AD1, 0xC225CA0A3E231,
+     0x388A5FDE3A0A9, 0x63679FE6F5881, 0x32982C5AAD159, 0x5A6C29F97DC73,
+     0x8E1ED165670EB, 0x004F1EF91ECCF, },
+   { 0x4F0DCE137840C, 0x47A3AFAF1FA42, 0x1B6BA2EDAAA63, 0x86B5B10C4BD8E,
+     0xC175F2E84B894, 0x7F874F304F14E, 0x6B0687C47A21C, 0xE775F1C188517,
+     0x2D135CCE6F168, 0x000F33C9AF61D, },
+   { 0x18C0E951EF75F, 0x95180AA287245, 0x1A83F4EEB3924, 0xA88E91A0FFA13,
+     0xD5242067D20CB, 0x4B4B2A0A79316, 0x767AF4681BE3B, 0x6F2415E6BF0FE,
+     0xF68E4633B3F9C, 0x00295599FEC40, },
+  },
+  { // u = 9
+   { 0x9DB282418A5C3, 0x11F7E9B4FDE87, 0x6D21FA85928C4, 0xE73B077DA02CC,
+     0xEF2835E4A46F4, 0xE509D106F6AE6, 0x11FA61ECCE4FD, 0x2ACDCFC897EA9,
+     0x6A40E5654A952, 0x0022F6AC71F40, },
+   { 0x38959A9897A6A, 0xC4B031644DD9C, 0x0412F79DB1890, 0x21FD4F350F2EA,
+     0xD8F9DFC4C46C2, 0x1962058543C47, 0x16C0DBB8F45DC, 0x6681692D3AB80,
+     0xD27411359E16F, 0x00098E6453380, },
+   { 0xE1843697924FE, 0x1821DA3EB4A76, 0x7CE147CB40A3E, 0x3B94879E4DB08,
+     0x3C601F3B2C6A0, 0x317E7B61C01B2, 0xD2DE13AB858FA, 0x51C97D3FF96F4,
+     0x6A049C67512BE, 0x002F57C37340F, },
+   { 0xAB3751D609851, 0x659635321C279, 0x7BF999CC498FF, 0x5D6D68330178D,
+     0x500E4CBAB2ED7, 0xFD42563BEA37A, 0xDE52804F27518, 0xD977A165302DB,
+     0x337F85CC960F1, 0x00497993C2A33, },
+  },
+};
+
+// u in Montgomery domain R = 2^516 (radix-43)
+static const uint64_t ll_ellu[ELL_NU][LL_NWORDS] = {
+  { 0x65FD1E15990, 0x16DECECEEC5, 0x4F15D0E9268, 0x01B263BA219,
+   0x756DB68FC0C, 0x73543C49F07, 0x07C81483BEE, 0x2A15A1C8A08,
+   0x7B1ED6D95B1, 0x7D251910514, 0x493D00452A2, 0x01BC9B995DD, },
+  { 0x58FBAD20658, 0x224E3636628, 0x36A0B95DB9C, 0x028B9597326,
+   0x702491D7A12, 0x2CFE5A6EE8B, 0x0BAC1EC59E6, 0x7F2072ACF0C,
+   0x38AE4246089, 0x3BB7A59879F, 0x2DDB8067BF4, 0x029AE9660CC, },
+  { 0x3BA6FFBEAA5, 0x546D3366D54, 0x2D8F1AD5371, 0x7D03CF19CA0,
+   0x778665CE1A4, 0x31B31FBB33F, 0x1C75DC7C56A, 0x6FE52263C30,
+   0x4AFADD2F074, 0x18A775A40A0, 0x0E97908B31B, 0x004B92BE401, },
+  { 0x2EA58EC976D, 0x5FDC9ACE4B7, 0x151A0349CA5, 0x7DDD00F6DAD,
+   0x723D4115FAA, 0x6B5D3DE02C3, 0x2059E6BE361, 0x44EFF348134,
+   0x088A489BB4D, 0x573A022C32B, 0x733610ADC6C, 0x0129E08AEEF, },
+  { 0x21A41DD4435, 0x6B4C0235C1A, 0x7CA4EBBE5D9, 0x7EB632D3EB9,
+   0x6CF41C5DDB0, 0x25075C05247, 0x243DF100159, 0x19FAC42C638,
+   0x4619B408626, 0x15CC8EB45B5, 0x57D490D05BE, 0x02082E579DE, },
+  { 0x14A2ACDF0FD, 0x76BB699D37D, 0x642FD432F0D, 0x7F8F64B0FC6,
+   0x67AAF7A5BB6, 0x5EB17A2A1CB, 0x2821FB41F50, 0x6F059510B3C,
+   0x03A91F750FE, 0x545F1B3C840, 0x3C7310F2F0F, 0x02E67C244CD, },
+  { 0x774DFF7D54A, 0x28DA66CDAA8, 0x5B1E35AA6E3, 0x7A079E33940,
+   0x6F0CCB9C349, 0x63663F7667F, 0x38EBB8F8AD4, 0x5FCA44C7860,
+   0x15F5BA5E0E9, 0x314EEB48141, 0x1D2F2116636, 0x0097257C802, },
+  { 0x6A4C8E88212, 0x3449CE3520B, 0x42A91E1F017, 0x7AE0D010A4D,
+   0x69C3A6E414F, 0x1D105D9B603, 0x3CCFC33A8CC, 0x34D515ABD64,
+   0x538525CABC2, 0x6FE177D03CB, 0x01CDA138F87, 0x017573492F1, },
+};
+#endif
+
+// the radical 7-isogeny r' = N(alpha, r) / D(alpha, r): rad7_coef[0][i] (for N)
+// and rad7_coef[1][i] (for D) are the coefficients of r^2, r, 1 of alpha^i
+static const int8_t rad7_coef[2][5][3] = {
+  { { -7,   7,   0 }, { -9,   5,   4 }, {  2,  -5,   3 }, {  0,  -5,   4 }, {  0,   6,  -2 } },
+  { { -2,  -2,   4 }, { -8,  13,  -5 }, {  0, -14,  14 }, {  0,   9, -10 }, {  0,   2,  11 } },
+};
+
 // -----------------------------------------------------------------------------
 // (8x1)-way curve and isogeny operations 
 
@@ -79,12 +257,26 @@ void point_copy_8x1w(htpoint_t R, const htpoint_t P);
 void point_cmove_8x1w(htpoint_t R, htpoint_t P, const __m512i b);
 void point_cswap_8x1w(htpoint_t R, htpoint_t P, const __m512i b);
 __m512i point_isinf_8x1w(const htpoint_t P);
+int curve_iseql_8x1w(const htpoint_t A, const uint64_t *y, const uint64_t *z);
 void yDBL_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A);
 void yADD_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t Q, const htpoint_t PQ);
 void yMUL_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A, const uint8_t k);
 void elligator_8x1w(htpoint_t Tplus, htpoint_t Tminus, const htpoint_t A);
+void yISOGvelu_8x1w(htpoint R[], htpoint_t C, const htpoint_t P, const htpoint_t A, const uint8_t k);
+void yEVALvelu_8x1w(htpoint_t R, const htpoint_t Q, const htpoint P[], const uint8_t k);
+void yISOGsqrt_8x1w(htpoint R[], htpoint_t C, const htpoint_t P, const htpoint_t A, const uint8_t k);
+void yEVALsqrt_8x1w(htpoint_t R, const htpoint_t Q, const htpoint P[], const uint8_t k);
 void yISOG_8x1w(htpoint R[], htpoint_t C, const htpoint_t P, const htpoint_t A, const uint8_t k);
 void yEVAL_8x1w(htpoint_t R, const htpoint_t Q, const htpoint P[], const uint8_t k);
+void yEVALmultivelu_8x1w(htpoint *R[], htpoint *const Q[], const htpoint P[], const int n, const uint8_t k);
+void yEVALmultisqrt_8x1w(htpoint *R[], htpoint *const Q[], const htpoint P[], const int n, const uint8_t k);
+void yEVALmulti_8x1w(htpoint *R[], htpoint *const Q[], const htpoint P[], const int n, const uint8_t k);
+void yISOGEVALvelu_8x1w(htpoint_t C, htpoint *R[], htpoint_t L, const htpoint_t P, const htpoint_t A, htpoint *const Q[], const int n, const uint8_t k);
+void yISOGEVALsqrt_8x1w(htpoint_t C, htpoint *R[], htpoint_t L, const htpoint_t P, const htpoint_t A, htpoint *const Q[], const int n, const uint8_t k);
+void yISOGEVAL_8x1w(htpoint_t C, htpoint *R[], htpoint_t L, const htpoint_t P, const htpoint_t A, htpoint *const Q[], const int n, const uint8_t k);
+void radical_8x1w(htpoint_t C, const htpoint_t A, const htpoint_t P, const __m512i e, const uint8_t k, const int b);
+void point_ht2ll_8x1w(llpoint_t R[8], const htpoint_t P);
+void point_ll2ht_8x1w(htpoint_t R, const llpoint_t P[8]);
 
 // -----------------------------------------------------------------------------
 // (2x4)-way curve and isogeny operations 
@@ -99,5 +291,7 @@ void yMUL_2x4w(llpoint_t R, const llpoint_t P, const llpoint_t A, const uint8_t
 void elligator_2x4w(llpoint_t Tplus, llpoint_t Tminus, const llpoint_t A);
 void yISOG_2x4w(llpoint_t R[], llpoint_t C, const llpoint_t P, const llpoint_t A, const uint8_t k);
 void yEVAL_2x4w(llpoint_t R, const llpoint_t Q, const llpoint_t P[], const uint8_t k);
+void yEVALmulti_2x4w(llpoint_t *R[], llpoint_t *const Q[], const llpoint_t P[], const int n, const uint8_t k);
+void radical_2x4w(llpoint_t C, const llpoint_t A, const llpoint_t P, const uint8_t e, const uint8_t k, const int b);
 
 #endif
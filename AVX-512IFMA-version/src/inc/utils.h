@@ -27,4 +27,8 @@ __m512i set_vector(const uint64_t a7, const uint64_t a6, const uint64_t a5, cons
 void get_channel_8x1w(uint64_t *r, const htfe_t a, const int ch);
 void get_channel_2x4w(uint64_t *r, const llfe_t a, const int ch);
 
+void vec_transpose_8x8(__m512i *r, const __m512i *a);
+void mpi_load_8x1w(htfe_t r, const uint64_t (*a)[8]);
+void mpi_store_8x1w(uint64_t (*r)[8], const htfe_t a);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,46 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#include "action.h"
+#include "api.h"
+
+// (8x1)-way CSIDH class group action r[i] = sk[i] * a[i] for i = 0, ..., 7.
+// a[i] and r[i] are the Montgomery curve coefficients A in [0, p) in radix-64.
+void action_u64(uint64_t (*r)[8], const uint8_t (*sk)[N], const uint64_t (*a)[8])
+{
+  __m512i vsk[N];
+  htpoint vA, vC;
+  htfe_t t0, t1;
+  int i;
+
+  // form the vector of private key 
+  for (i = 0; i < N; i++) 
+    vsk[i] = set_vector(sk[7][i], sk[6][i], sk[5][i], sk[4][i], sk[3][i], sk[2][i], sk[1][i], sk[0][i]);
+
+  // convert from radix-64 to radix-52
+  mpi_load_8x1w(t0, a);
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    t1[i] = VSET1(E[0][i]);             // t1 = 2
+    vA.z[i] = VSET1(E[1][i]);           // zA = C24 = 4 
+  }
+  gfp_num2mont_8x1w(t0, t0);            // convert A to Montgomery domain
+  gfp_add_8x1w(vA.y, t0, t1);           // yA = A24plus = A+2
+
+  action(&vC, vsk, &vA);
+
+  gfp_sginv_8x1w(t0, vC.z);             // t0 = 1/C24
+  gfp_mul_8x1w(t0, vC.y, t0);           // t0 = A24plus/C24 = (A+2)/4
+  gfp_mul_8x1w(t0, t0, vA.z);           // t0 = A+2 
+  gfp_sub_8x1w(t0, t0, t1);             // t0 = A
+  gfp_mont2num_8x1w(t0, t0);            // convert A to number domain in [0, p)
+
+  // convert from radix-52 to radix-64 
+  mpi_store_8x1w(r, t0);
+}
@@ -0,0 +1,50 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#include "action_low_latency.h"
+#include "api.h"
+
+// (2x4)-way CSIDH class group action r = sk * a for a single instance. 
+// a and r are the Montgomery curve coefficients A in [0, p) in radix-64.
+void action_ll_u64(uint64_t r[8], const uint8_t sk[N], const uint64_t a[8])
+{
+  llpoint_t vA, vC, vE;
+  llfe_t t0, t1, z0, z1;
+  uint64_t a43[LL_NWORDS];
+
+  // form the vector of base curve and the vectors <2 | 0> and <0 | 2>
+  vE[0] = VSET(E[0][9] , E[0][6], E[0][3], E[0][0], E[1][9] , E[1][6], E[1][3], E[1][0]);
+  vE[1] = VSET(E[0][10], E[0][7], E[0][4], E[0][1], E[1][10], E[1][7], E[1][4], E[1][1]);
+  vE[2] = VSET(E[0][11], E[0][8], E[0][5], E[0][2], E[1][11], E[1][8], E[1][5], E[1][2]);
+  vec_permzh_2x4w(z0, vE);              // z0 = 0 | 2
+  vec_permlh_2x4w(z1, z0);              // z1 = 2 | 0
+
+  // convert from radix-64 to radix-43
+  mpi_conv_64to43(a43, a, LL_NWORDS, 8);
+
+  t0[0] = VSET(a43[9] , a43[6], a43[3], a43[0], 0, 0, 0, 4);
+  t0[1] = VSET(a43[10], a43[7], a43[4], a43[1], 0, 0, 0, 0);
+  t0[2] = VSET(a43[11], a43[8], a43[5], a43[2], 0, 0, 0, 0);
+  gfp_num2mont_2x4w(t0, t0);            // t0 = A | 4 in Montgomery domain
+  gfp_addsubc_2x4w(vA, t0, z1);         // A = A24plus | C24 = A+2 | 4
+
+  action_2x4w(vC, sk, vA);
+
+  vec_permzl_2x4w(t0, vC);              // t0 = 0 | C24
+  gfp_inv_2x4w(t1, t0);                 // t1 = 0 | 1/C24
+  vec_permzh_2x4w(t0, vC);              // t0 = 0 | A24plus
+  gfp_mul_2x4w(t0, t1, t0);             // t0 = 0 | A24plus/C24 = (A+2)/4
+  gfp_mul_2x4w(t0, t0, vE);             // t0 = * | A+2
+  gfp_addsubc_2x4w(t1, t0, z0);         // t1 = * | A
+  gfp_mont2num_2x4w(t0, t1);            // convert A to number domain in [0, p)
+
+  // convert from radix-43 to radix-64
+  get_channel_2x4w(a43, t0, 0);
+  mpi_conv_43to64(r, a43, 8, LL_NWORDS);
+}
@@ -0,0 +1,192 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#include "action.h"
+#include "cache.h"
+#include <string.h>
+#include <pthread.h>
+
+// The cache holds the first-round points T- and T+ of static (peer) curves, so
+// that the group actions on these curves skip Elligator and the cofactor
+// clearing of the first round, like the ones on the base curve E. Curves are
+// only added, under cache_lock so that two threads never write the same entry;
+// the number of the valid entries is published after an entry is written, so
+// that lookups need no lock.
+
+static htcache cache[HT_CACHE_SIZE];
+static int cache_num = 0;
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// the Montgomery coefficients A = 4*A24plus/C24 - 2 of the eight curves, in
+// [0, p) in radix-64
+static void curve_normalize_8x1w(uint64_t (*r)[8], const htpoint_t A)
+{
+  htfe_t t0, t1, t2;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    t1[i] = VSET1(E[0][i]);             // t1 = 2
+    t2[i] = VSET1(E[1][i]);             // t2 = 4
+  }
+
+  gfp_sginv_8x1w(t0, A->z);             // t0 = 1/C24
+  gfp_mul_8x1w(t0, A->y, t0);           // t0 = A24plus/C24 = (A+2)/4
+  gfp_mul_8x1w(t0, t0, t2);             // t0 = A+2
+  gfp_sub_8x1w(t0, t0, t1);             // t0 = A
+  gfp_mont2num_8x1w(t0, t0);            // convert A to number domain in [0, p)
+
+  mpi_store_8x1w(r, t0);
+}
+
+// cache_add() with cache_lock held
+static int cache_add_locked(const uint64_t a[8])
+{
+  htpoint vA, T[2], G;
+  htfe_t t0, t1;
+  uint64_t a8[8][8];
+  __m512i bad;
+  htcache *c;
+  const int m = 1 % NUMBA;              // SIMBA index of the first round
+  int i, j, k, n, tries, found[2] = { 0 };
+
+  n = cache_num;
+  for (i = 0; i < n; i++)
+    if (!memcmp(cache[i].a, a, sizeof(cache[i].a))) return 0;
+  if (n == HT_CACHE_SIZE) return -1;
+  c = &cache[n];
+
+  // the curve (A24plus, C24) = (A+2, 4) in all eight lanes
+  for (k = 0; k < 8; k++) memcpy(a8[k], a, sizeof(a8[k]));
+  mpi_load_8x1w(t0, a8);
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    t1[i] = VSET1(E[0][i]);             // t1 = 2
+    vA.z[i] = VSET1(E[1][i]);           // zA = C24 = 4
+  }
+  gfp_num2mont_8x1w(t0, t0);            // convert A to Montgomery domain
+  gfp_add_8x1w(vA.y, t0, t1);           // yA = A24plus = A+2
+
+  for (tries = 0; tries < HT_CACHE_TRIES && !(found[0] & found[1]); tries++) {
+    // eight candidates for each of T+ and T-, as in the first round
+    elligator_8x1w(&T[1], &T[0], &vA);
+    for (k = 0; k < 2; k++) {
+      yDBL_8x1w(&T[k], &T[k], &vA);
+      yDBL_8x1w(&T[k], &T[k], &vA);
+      for (i = 0; i < SICOBA[m]; i++) yMUL_8x1w(&T[k], &T[k], &vA, COMPBA[m][i]);
+    }
+
+    for (k = 0; k < 2; k++) {
+      if (found[k]) continue;
+      // a lane is bad if [prod(BATCHES[m])/l]T = O for some l of BATCHES[m], 
+      // or if [prod(BATCHES[m])]T != O (then the curve is not supersingular)
+      bad = VZERO;
+      for (i = 0; i < SIZEBA[m]; i++) {
+        point_copy_8x1w(&G, &T[k]);
+        for (j = 0; j < SIZEBA[m]; j++)
+          if (j != i) yMUL_8x1w(&G, &G, &vA, BATCHES[m][j]);
+        bad = VOR(bad, point_isinf_8x1w(&G));
+        yMUL_8x1w(&G, &G, &vA, BATCHES[m][i]);
+        bad = VOR(bad, VXOR(point_isinf_8x1w(&G), VSET1(1)));
+      }
+      for (j = 0; j < 8 && ((uint64_t *)&bad)[j]; j++);
+      if (j < 8) {
+        get_channel_8x1w(c->t[k][0], T[k].y, j);
+        get_channel_8x1w(c->t[k][1], T[k].z, j);
+        found[k] = 1;
+      }
+    }
+  }
+  if (!(found[0] & found[1])) return -1;
+
+  memcpy(c->a, a, sizeof(c->a));
+  __atomic_store_n(&cache_num, n+1, __ATOMIC_RELEASE);
+
+  return 0;
+}
+
+// Add the curve with the Montgomery coefficient a (in [0, p) in radix-64) to
+// the cache. Its points are the first T+ and T- (after Elligator and the
+// cofactor clearing of the first round) which keep all primes of BATCHES[1] in
+// their orders, so that the first round on the curve never misses an isogeny.
+// Returns 0 if the curve is (already) cached, and -1 if the cache is full or no
+// such points have been found (e.g., the curve is not supersingular). It may be
+// called by several threads at once. 
+int cache_add(const uint64_t a[8])
+{
+  int r;
+
+  pthread_mutex_lock(&cache_lock);
+  r = cache_add_locked(a);
+  pthread_mutex_unlock(&cache_lock);
+
+  return r;
+}
+
+// Empty the cache; not to be called while group actions are running.
+void cache_clear()
+{
+  pthread_mutex_lock(&cache_lock);
+  __atomic_store_n(&cache_num, 0, __ATOMIC_RELEASE);
+  pthread_mutex_unlock(&cache_lock);
+}
+
+// The points T- (T0) and T+ (T1) the first round on the curve A starts from:
+// the precomputed ones if A is the base curve E in all lanes, or the cached ones
+// if the curve of every lane is E or in the cache. Returns 1 if T0 and T1 have
+// been set, and 0 if the first round has to run Elligator. A is public.
+int point_first_8x1w(htpoint_t T0, htpoint_t T1, const htpoint_t A)
+{
+  uint64_t a[8][8], w[4][8], zero[8] = { 0 };
+  htcache base;
+  const htcache *c[8];
+  int i, j, k, n;
+
+  if (curve_iseql_8x1w(A, E[0], E[1])) {
+    for (i = 0; i < HT_NWORDS; i++) {
+      T0->y[i] = VSET1(ET[0][i]);
+      T1->y[i] = VSET1(ET[1][i]);
+      T0->z[i] = T1->z[i] = VSET1(ht_montR[i]);
+    }
+    return 1;
+  }
+
+  n = cache_num;
+  if (!n) return 0;
+
+  // the base curve (A = 0) is an entry as well, e.g. for padded lanes 
+  for (i = 0; i < HT_NWORDS; i++) {
+    base.t[0][0][i] = ET[0][i];
+    base.t[1][0][i] = ET[1][i];
+    base.t[0][1][i] = base.t[1][1][i] = ht_montR[i];
+  }
+
+  curve_normalize_8x1w(a, A);
+  for (k = 0; k < 8; k++) {
+    c[k] = memcmp(a[k], zero, sizeof(zero)) ? NULL : &base;
+    for (j = 0; (j < n) && !c[k]; j++)
+      if (!memcmp(cache[j].a, a[k], sizeof(a[k]))) c[k] = &cache[j];
+    if (!c[k]) return 0;
+  }
+
+  // lane k takes the points of the curve of lane k
+  for (i = 0; i < HT_NWORDS; i++) {
+    for (k = 0; k < 8; k++) {
+      w[0][k] = c[k]->t[0][0][i];
+      w[1][k] = c[k]->t[0][1][i];
+      w[2][k] = c[k]->t[1][0][i];
+      w[3][k] = c[k]->t[1][1][i];
+    }
+    T0->y[i] = VLOAD(w[0]);
+    T0->z[i] = VLOAD(w[1]);
+    T1->y[i] = VLOAD(w[2]);
+    T1->z[i] = VLOAD(w[3]);
+  }
+
+  return 1;
+}
@@ -134,6 +134,39 @@ void gfp_sub_8x1w(htfe_t r, const htfe_t a, const htfe_t b)
   r[5] = r5; r[6] = r6; r[7] = r7; r[8] = r8; r[9] = r9;  
 }
 
+// non-reducing field addition r = a + b (lazy, limb-wise without carry propagation)
+// the limbs of r may exceed 52 bits, r must go through gfp_carryp_8x1w before
+// being used as an input of any other non-lazy operation
+// a in [0, kp), b in [0, lp) -> r in [0, (k+l)p)
+void gfp_addnr_8x1w(htfe_t r, const htfe_t a, const htfe_t b)
+{
+  r[0] = VADD(a[0], b[0]); r[1] = VADD(a[1], b[1]); r[2] = VADD(a[2], b[2]); 
+  r[3] = VADD(a[3], b[3]); r[4] = VADD(a[4], b[4]); r[5] = VADD(a[5], b[5]); 
+  r[6] = VADD(a[6], b[6]); r[7] = VADD(a[7], b[7]); r[8] = VADD(a[8], b[8]); 
+  r[9] = VADD(a[9], b[9]); 
+}
+
+// non-reducing field subtraction r = a - b + 2p (lazy, limb-wise without carry propagation)
+// the limbs of r may be negative or exceed 52 bits, r must go through 
+// gfp_carryp_8x1w before being used as an input of any other non-lazy operation
+// a in [0, kp), b in [0, 2p) -> r in [0, (k+2)p)
+void gfp_subnr_8x1w(htfe_t r, const htfe_t a, const htfe_t b)
+{
+  const __m512i vp0 = VSET1(ht_pmul2[0]), vp1 = VSET1(ht_pmul2[1]);
+  const __m512i vp2 = VSET1(ht_pmul2[2]), vp3 = VSET1(ht_pmul2[3]);
+  const __m512i vp4 = VSET1(ht_pmul2[4]), vp5 = VSET1(ht_pmul2[5]);
+  const __m512i vp6 = VSET1(ht_pmul2[6]), vp7 = VSET1(ht_pmul2[7]);
+  const __m512i vp8 = VSET1(ht_pmul2[8]), vp9 = VSET1(ht_pmul2[9]);
+
+  r[0] = VSUB(VADD(a[0], vp0), b[0]); r[1] = VSUB(VADD(a[1], vp1), b[1]); 
+  r[2] = VSUB(VADD(a[2], vp2), b[2]); r[3] = VSUB(VADD(a[3], vp3), b[3]); 
+  r[4] = VSUB(VADD(a[4], vp4), b[4]); r[5] = VSUB(VADD(a[5], vp5), b[5]); 
+  r[6] = VSUB(VADD(a[6], vp6), b[6]); r[7] = VSUB(VADD(a[7], vp7), b[7]); 
+  r[8] = VSUB(VADD(a[8], vp8), b[8]); r[9] = VSUB(VADD(a[9], vp9), b[9]); 
+}
+
+#ifndef MUL_KARATSUBA
+
 // Montgomery multiplication r = a * b mod 2p
 // multiplication (product-scanning) interleaved with reduction (operand-scanning)
 // -> r in [0, 2p)
@@ -498,12 +531,1889 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z9 = VMACLO(z9, u, vp9); z10 = VMACHI(z10, u, vp9); 
   z1 = VADD(z1, VSHR(z0, HT_BRADIX));
 
-  z11 = VMACLO(z11, a2, a9); z11 = VMACLO(z11, a3, a8); z11 = VMACLO(z11, a4, a7); 
-  z11 = VMACLO(z11, a5, a6); 
-  z12 = VMACHI(z12, a2, a9); z12 = VMACHI(z12, a3, a8); z12 = VMACHI(z12, a4, a7); 
-  z12 = VMACHI(z12, a5, a6);
-  z11 = VADD(z11, z11);
-  z10 = VMACLO(z10, a5, a5); z11 = VMACHI(z11, a5, a5); 
+  z11 = VMACLO(z11, a2, a9); z11 = VMACLO(z11, a3, a8); z11 = VMACLO(z11, a4, a7); 
+  z11 = VMACLO(z11, a5, a6); 
+  z12 = VMACHI(z12, a2, a9); z12 = VMACHI(z12, a3, a8); z12 = VMACHI(z12, a4, a7); 
+  z12 = VMACHI(z12, a5, a6);
+  z11 = VADD(z11, z11);
+  z10 = VMACLO(z10, a5, a5); z11 = VMACHI(z11, a5, a5); 
+
+  u = VMACLO(zero, z1, vw); 
+  z1  = VMACLO(z1,  u, vp0); z2  = VMACHI(z2,  u, vp0); 
+  z2  = VMACLO(z2,  u, vp1); z3  = VMACHI(z3,  u, vp1); 
+  z3  = VMACLO(z3,  u, vp2); z4  = VMACHI(z4,  u, vp2); 
+  z4  = VMACLO(z4,  u, vp3); z5  = VMACHI(z5,  u, vp3); 
+  z5  = VMACLO(z5,  u, vp4); z6  = VMACHI(z6,  u, vp4); 
+  z6  = VMACLO(z6,  u, vp5); z7  = VMACHI(z7,  u, vp5); 
+  z7  = VMACLO(z7,  u, vp6); z8  = VMACHI(z8,  u, vp6); 
+  z8  = VMACLO(z8,  u, vp7); z9  = VMACHI(z9,  u, vp7); 
+  z9  = VMACLO(z9,  u, vp8); z10 = VMACHI(z10, u, vp8); 
+  z10 = VMACLO(z10, u, vp9); z11 = VMACHI(z11, u, vp9); 
+  z2 = VADD(z2, VSHR(z1, HT_BRADIX));  
+
+  z12 = VMACLO(z12, a3, a9); z12 = VMACLO(z12, a4, a8); z12 = VMACLO(z12, a5, a7); 
+  z13 = VMACHI(z13, a3, a9); z13 = VMACHI(z13, a4, a8); z13 = VMACHI(z13, a5, a7); 
+  z12 = VADD(z12, z12);
+
+  u = VMACLO(zero, z2, vw); 
+  z2  = VMACLO(z2,  u, vp0); z3  = VMACHI(z3,  u, vp0); 
+  z3  = VMACLO(z3,  u, vp1); z4  = VMACHI(z4,  u, vp1); 
+  z4  = VMACLO(z4,  u, vp2); z5  = VMACHI(z5,  u, vp2); 
+  z5  = VMACLO(z5,  u, vp3); z6  = VMACHI(z6,  u, vp3); 
+  z6  = VMACLO(z6,  u, vp4); z7  = VMACHI(z7,  u, vp4); 
+  z7  = VMACLO(z7,  u, vp5); z8  = VMACHI(z8,  u, vp5); 
+  z8  = VMACLO(z8,  u, vp6); z9  = VMACHI(z9,  u, vp6); 
+  z9  = VMACLO(z9,  u, vp7); z10 = VMACHI(z10, u, vp7); 
+  z10 = VMACLO(z10, u, vp8); z11 = VMACHI(z11, u, vp8); 
+  z11 = VMACLO(z11, u, vp9); z12 = VMACHI(z12, u, vp9); 
+  z3 = VADD(z3, VSHR(z2, HT_BRADIX));
+
+  z13 = VMACLO(z13, a4, a9); z13 = VMACLO(z13, a5, a8); z13 = VMACLO(z13, a6, a7); 
+  z14 = VMACHI(z14, a4, a9); z14 = VMACHI(z14, a5, a8); z14 = VMACHI(z14, a6, a7); 
+  z13 = VADD(z13, z13);
+  z12 = VMACLO(z12, a6, a6); z13 = VMACHI(z13, a6, a6); 
+
+  u = VMACLO(zero, z3, vw); 
+  z3  = VMACLO(z3,  u, vp0); z4  = VMACHI(z4,  u, vp0); 
+  z4  = VMACLO(z4,  u, vp1); z5  = VMACHI(z5,  u, vp1); 
+  z5  = VMACLO(z5,  u, vp2); z6  = VMACHI(z6,  u, vp2); 
+  z6  = VMACLO(z6,  u, vp3); z7  = VMACHI(z7,  u, vp3); 
+  z7  = VMACLO(z7,  u, vp4); z8  = VMACHI(z8,  u, vp4); 
+  z8  = VMACLO(z8,  u, vp5); z9  = VMACHI(z9,  u, vp5); 
+  z9  = VMACLO(z9,  u, vp6); z10 = VMACHI(z10, u, vp6); 
+  z10 = VMACLO(z10, u, vp7); z11 = VMACHI(z11, u, vp7); 
+  z11 = VMACLO(z11, u, vp8); z12 = VMACHI(z12, u, vp8); 
+  z12 = VMACLO(z12, u, vp9); z13 = VMACHI(z13, u, vp9); 
+  z4 = VADD(z4, VSHR(z3, HT_BRADIX));
+
+  z14 = VMACLO(z14, a5, a9); z14 = VMACLO(z14, a6, a8); 
+  z15 = VMACHI(z15, a5, a9); z15 = VMACHI(z15, a6, a8); 
+  z14 = VADD(z14, z14);
+
+  u = VMACLO(zero, z4, vw); 
+  z4  = VMACLO(z4,  u, vp0); z5  = VMACHI(z5,  u, vp0); 
+  z5  = VMACLO(z5,  u, vp1); z6  = VMACHI(z6,  u, vp1); 
+  z6  = VMACLO(z6,  u, vp2); z7  = VMACHI(z7,  u, vp2); 
+  z7  = VMACLO(z7,  u, vp3); z8  = VMACHI(z8,  u, vp3); 
+  z8  = VMACLO(z8,  u, vp4); z9  = VMACHI(z9,  u, vp4); 
+  z9  = VMACLO(z9,  u, vp5); z10 = VMACHI(z10, u, vp5); 
+  z10 = VMACLO(z10, u, vp6); z11 = VMACHI(z11, u, vp6); 
+  z11 = VMACLO(z11, u, vp7); z12 = VMACHI(z12, u, vp7); 
+  z12 = VMACLO(z12, u, vp8); z13 = VMACHI(z13, u, vp8); 
+  z13 = VMACLO(z13, u, vp9); z14 = VMACHI(z14, u, vp9); 
+  z5 = VADD(z5, VSHR(z4, HT_BRADIX));
+
+  z15 = VMACLO(z15, a6, a9); z15 = VMACLO(z15, a7, a8); 
+  z16 = VMACHI(z16, a6, a9); z16 = VMACHI(z16, a7, a8);
+  z15 = VADD(z15, z15);
+  z14 = VMACLO(z14, a7, a7); z15 = VMACHI(z15, a7, a7);
+
+  u = VMACLO(zero, z5, vw); 
+  z5  = VMACLO(z5,  u, vp0); z6  = VMACHI(z6,  u, vp0); 
+  z6  = VMACLO(z6,  u, vp1); z7  = VMACHI(z7,  u, vp1); 
+  z7  = VMACLO(z7,  u, vp2); z8  = VMACHI(z8,  u, vp2); 
+  z8  = VMACLO(z8,  u, vp3); z9  = VMACHI(z9,  u, vp3); 
+  z9  = VMACLO(z9,  u, vp4); z10 = VMACHI(z10, u, vp4); 
+  z10 = VMACLO(z10, u, vp5); z11 = VMACHI(z11, u, vp5); 
+  z11 = VMACLO(z11, u, vp6); z12 = VMACHI(z12, u, vp6); 
+  z12 = VMACLO(z12, u, vp7); z13 = VMACHI(z13, u, vp7); 
+  z13 = VMACLO(z13, u, vp8); z14 = VMACHI(z14, u, vp8); 
+  z14 = VMACLO(z14, u, vp9); z15 = VMACHI(z15, u, vp9); 
+  z6 = VADD(z6, VSHR(z5, HT_BRADIX));
+
+  z16 = VMACLO(z16, a7, a9);  
+  z17 = VMACHI(z17, a7, a9); 
+  z16 = VADD(z16, z16);
+
+  u = VMACLO(zero, z6, vw); 
+  z6  = VMACLO(z6,  u, vp0); z7  = VMACHI(z7,  u, vp0); 
+  z7  = VMACLO(z7,  u, vp1); z8  = VMACHI(z8,  u, vp1); 
+  z8  = VMACLO(z8,  u, vp2); z9  = VMACHI(z9,  u, vp2); 
+  z9  = VMACLO(z9,  u, vp3); z10 = VMACHI(z10, u, vp3); 
+  z10 = VMACLO(z10, u, vp4); z11 = VMACHI(z11, u, vp4); 
+  z11 = VMACLO(z11, u, vp5); z12 = VMACHI(z12, u, vp5); 
+  z12 = VMACLO(z12, u, vp6); z13 = VMACHI(z13, u, vp6); 
+  z13 = VMACLO(z13, u, vp7); z14 = VMACHI(z14, u, vp7); 
+  z14 = VMACLO(z14, u, vp8); z15 = VMACHI(z15, u, vp8); 
+  z15 = VMACLO(z15, u, vp9); z16 = VMACHI(z16, u, vp9); 
+  z7 = VADD(z7, VSHR(z6, HT_BRADIX)); 
+
+  z17 = VMACLO(z17, a8, a9); 
+  z18 = VMACHI(z18, a8, a9);
+  z17 = VADD(z17, z17);
+  z16 = VMACLO(z16, a8, a8); z17 = VMACHI(z17, a8, a8); 
+
+  u = VMACLO(zero, z7, vw); 
+  z7  = VMACLO(z7,  u, vp0); z8  = VMACHI(z8,  u, vp0); 
+  z8  = VMACLO(z8,  u, vp1); z9  = VMACHI(z9,  u, vp1); 
+  z9  = VMACLO(z9,  u, vp2); z10 = VMACHI(z10, u, vp2); 
+  z10 = VMACLO(z10, u, vp3); z11 = VMACHI(z11, u, vp3); 
+  z11 = VMACLO(z11, u, vp4); z12 = VMACHI(z12, u, vp4); 
+  z12 = VMACLO(z12, u, vp5); z13 = VMACHI(z13, u, vp5); 
+  z13 = VMACLO(z13, u, vp6); z14 = VMACHI(z14, u, vp6); 
+  z14 = VMACLO(z14, u, vp7); z15 = VMACHI(z15, u, vp7); 
+  z15 = VMACLO(z15, u, vp8); z16 = VMACHI(z16, u, vp8); 
+  z16 = VMACLO(z16, u, vp9); z17 = VMACHI(z17, u, vp9); 
+  z8 = VADD(z8, VSHR(z7, HT_BRADIX)); 
+
+  z18 = VADD(z18, z18);
+
+  u = VMACLO(zero, z8, vw); 
+  z8  = VMACLO(z8,  u, vp0); z9  = VMACHI(z9,  u, vp0); 
+  z9  = VMACLO(z9,  u, vp1); z10 = VMACHI(z10, u, vp1); 
+  z10 = VMACLO(z10, u, vp2); z11 = VMACHI(z11, u, vp2); 
+  z11 = VMACLO(z11, u, vp3); z12 = VMACHI(z12, u, vp3); 
+  z12 = VMACLO(z12, u, vp4); z13 = VMACHI(z13, u, vp4); 
+  z13 = VMACLO(z13, u, vp5); z14 = VMACHI(z14, u, vp5); 
+  z14 = VMACLO(z14, u, vp6); z15 = VMACHI(z15, u, vp6); 
+  z15 = VMACLO(z15, u, vp7); z16 = VMACHI(z16, u, vp7); 
+  z16 = VMACLO(z16, u, vp8); z17 = VMACHI(z17, u, vp8); 
+  z17 = VMACLO(z17, u, vp9); z18 = VMACHI(z18, u, vp9); 
+  z9 = VADD(z9, VSHR(z8, HT_BRADIX)); 
+
+  z18 = VMACLO(z18, a9, a9);
+  z19 = VMACHI(z19, a9, a9);
+
+  u = VMACLO(zero, z9, vw); 
+  z9  = VMACLO(z9,  u, vp0); z10 = VMACHI(z10, u, vp0); 
+  z10 = VMACLO(z10, u, vp1); z11 = VMACHI(z11, u, vp1); 
+  z11 = VMACLO(z11, u, vp2); z12 = VMACHI(z12, u, vp2); 
+  z12 = VMACLO(z12, u, vp3); z13 = VMACHI(z13, u, vp3); 
+  z13 = VMACLO(z13, u, vp4); z14 = VMACHI(z14, u, vp4); 
+  z14 = VMACLO(z14, u, vp5); z15 = VMACHI(z15, u, vp5); 
+  z15 = VMACLO(z15, u, vp6); z16 = VMACHI(z16, u, vp6); 
+  z16 = VMACLO(z16, u, vp7); z17 = VMACHI(z17, u, vp7); 
+  z17 = VMACLO(z17, u, vp8); z18 = VMACHI(z18, u, vp8); 
+  z18 = VMACLO(z18, u, vp9); z19 = VMACHI(z19, u, vp9);
+  z10 = VADD(z10, VSHR(z9, HT_BRADIX));
+
+  z11 = VADD(z11, VSHR(z10, HT_BRADIX)); z10 = VAND(z10, vbmask);
+  z12 = VADD(z12, VSHR(z11, HT_BRADIX)); z11 = VAND(z11, vbmask);
+  z13 = VADD(z13, VSHR(z12, HT_BRADIX)); z12 = VAND(z12, vbmask);
+  z14 = VADD(z14, VSHR(z13, HT_BRADIX)); z13 = VAND(z13, vbmask);
+  z15 = VADD(z15, VSHR(z14, HT_BRADIX)); z14 = VAND(z14, vbmask);
+  z16 = VADD(z16, VSHR(z15, HT_BRADIX)); z15 = VAND(z15, vbmask);
+  z17 = VADD(z17, VSHR(z16, HT_BRADIX)); z16 = VAND(z16, vbmask);
+  z18 = VADD(z18, VSHR(z17, HT_BRADIX)); z17 = VAND(z17, vbmask);
+  z19 = VADD(z19, VSHR(z18, HT_BRADIX)); z18 = VAND(z18, vbmask);
+
+  // ---------------------------------------------------------------------------
+
+  r[0] = z10; r[1] = z11; r[2] = z12; r[3] = z13; r[4] = z14; 
+  r[5] = z15; r[6] = z16; r[7] = z17; r[8] = z18; r[9] = z19; 
+}
+
+// two independent Montgomery multiplications r = a * b, s = c * d mod 2p
+// interleaved instruction by instruction to overlap their latency chains;
+// the operands are read from memory to leave the registers to the accumulators
+// -> r, s in [0, 2p)
+void gfp_mul2_8x1w(htfe_t r, const htfe_t a, const htfe_t b, htfe_t s, const htfe_t c, const htfe_t d)
+{
+  __m512i  z0 = VZERO,  z1 = VZERO,  z2 = VZERO,  z3 = VZERO,  z4 = VZERO;
+  __m512i  y0 = VZERO,  y1 = VZERO,  y2 = VZERO,  y3 = VZERO,  y4 = VZERO;
+  __m512i  z5 = VZERO,  z6 = VZERO,  z7 = VZERO,  z8 = VZERO,  z9 = VZERO;
+  __m512i  y5 = VZERO,  y6 = VZERO,  y7 = VZERO,  y8 = VZERO,  y9 = VZERO;
+  __m512i z10 = VZERO, z11 = VZERO, z12 = VZERO, z13 = VZERO, z14 = VZERO;
+  __m512i y10 = VZERO, y11 = VZERO, y12 = VZERO, y13 = VZERO, y14 = VZERO;
+  __m512i z15 = VZERO, z16 = VZERO, z17 = VZERO, z18 = VZERO, z19 = VZERO;
+  __m512i y15 = VZERO, y16 = VZERO, y17 = VZERO, y18 = VZERO, y19 = VZERO;
+  __m512i u, v;
+  const __m512i vp0 = VSET1(ht_p[0]), vp1 = VSET1(ht_p[1]);
+  const __m512i vp2 = VSET1(ht_p[2]), vp3 = VSET1(ht_p[3]);
+  const __m512i vp4 = VSET1(ht_p[4]), vp5 = VSET1(ht_p[5]);
+  const __m512i vp6 = VSET1(ht_p[6]), vp7 = VSET1(ht_p[7]);
+  const __m512i vp8 = VSET1(ht_p[8]), vp9 = VSET1(ht_p[9]);
+  const __m512i vbmask = VSET1(HT_BMASK), vw = VSET1(HT_MONTW), zero = VZERO;
+
+  // ---------------------------------------------------------------------------
+  // 1st loop of integer multiplication 
+
+  z0 = VMACLO(z0, a[0], b[0]);
+  y0 = VMACLO(y0, c[0], d[0]);
+  z1 = VMACHI(z1, a[0], b[0]);
+  y1 = VMACHI(y1, c[0], d[0]);
+
+  z1 = VMACLO(z1, a[0], b[1]); z1 = VMACLO(z1, a[1], b[0]);
+  y1 = VMACLO(y1, c[0], d[1]); y1 = VMACLO(y1, c[1], d[0]);
+  z2 = VMACHI(z2, a[0], b[1]); z2 = VMACHI(z2, a[1], b[0]);
+  y2 = VMACHI(y2, c[0], d[1]); y2 = VMACHI(y2, c[1], d[0]);
+
+  z2 = VMACLO(z2, a[0], b[2]); z2 = VMACLO(z2, a[1], b[1]); z2 = VMACLO(z2, a[2], b[0]);
+  y2 = VMACLO(y2, c[0], d[2]); y2 = VMACLO(y2, c[1], d[1]); y2 = VMACLO(y2, c[2], d[0]);
+  z3 = VMACHI(z3, a[0], b[2]); z3 = VMACHI(z3, a[1], b[1]); z3 = VMACHI(z3, a[2], b[0]);
+  y3 = VMACHI(y3, c[0], d[2]); y3 = VMACHI(y3, c[1], d[1]); y3 = VMACHI(y3, c[2], d[0]);
+
+  z3 = VMACLO(z3, a[0], b[3]); z3 = VMACLO(z3, a[1], b[2]); z3 = VMACLO(z3, a[2], b[1]); 
+  y3 = VMACLO(y3, c[0], d[3]); y3 = VMACLO(y3, c[1], d[2]); y3 = VMACLO(y3, c[2], d[1]); 
+  z3 = VMACLO(z3, a[3], b[0]);
+  y3 = VMACLO(y3, c[3], d[0]);
+  z4 = VMACHI(z4, a[0], b[3]); z4 = VMACHI(z4, a[1], b[2]); z4 = VMACHI(z4, a[2], b[1]); 
+  y4 = VMACHI(y4, c[0], d[3]); y4 = VMACHI(y4, c[1], d[2]); y4 = VMACHI(y4, c[2], d[1]); 
+  z4 = VMACHI(z4, a[3], b[0]);
+  y4 = VMACHI(y4, c[3], d[0]);
+
+  z4 = VMACLO(z4, a[0], b[4]); z4 = VMACLO(z4, a[1], b[3]); z4 = VMACLO(z4, a[2], b[2]); 
+  y4 = VMACLO(y4, c[0], d[4]); y4 = VMACLO(y4, c[1], d[3]); y4 = VMACLO(y4, c[2], d[2]); 
+  z4 = VMACLO(z4, a[3], b[1]); z4 = VMACLO(z4, a[4], b[0]);
+  y4 = VMACLO(y4, c[3], d[1]); y4 = VMACLO(y4, c[4], d[0]);
+  z5 = VMACHI(z5, a[0], b[4]); z5 = VMACHI(z5, a[1], b[3]); z5 = VMACHI(z5, a[2], b[2]); 
+  y5 = VMACHI(y5, c[0], d[4]); y5 = VMACHI(y5, c[1], d[3]); y5 = VMACHI(y5, c[2], d[2]); 
+  z5 = VMACHI(z5, a[3], b[1]); z5 = VMACHI(z5, a[4], b[0]);
+  y5 = VMACHI(y5, c[3], d[1]); y5 = VMACHI(y5, c[4], d[0]);
+
+  z5 = VMACLO(z5, a[0], b[5]); z5 = VMACLO(z5, a[1], b[4]); z5 = VMACLO(z5, a[2], b[3]); 
+  y5 = VMACLO(y5, c[0], d[5]); y5 = VMACLO(y5, c[1], d[4]); y5 = VMACLO(y5, c[2], d[3]); 
+  z5 = VMACLO(z5, a[3], b[2]); z5 = VMACLO(z5, a[4], b[1]); z5 = VMACLO(z5, a[5], b[0]);
+  y5 = VMACLO(y5, c[3], d[2]); y5 = VMACLO(y5, c[4], d[1]); y5 = VMACLO(y5, c[5], d[0]);
+  z6 = VMACHI(z6, a[0], b[5]); z6 = VMACHI(z6, a[1], b[4]); z6 = VMACHI(z6, a[2], b[3]); 
+  y6 = VMACHI(y6, c[0], d[5]); y6 = VMACHI(y6, c[1], d[4]); y6 = VMACHI(y6, c[2], d[3]); 
+  z6 = VMACHI(z6, a[3], b[2]); z6 = VMACHI(z6, a[4], b[1]); z6 = VMACHI(z6, a[5], b[0]);
+  y6 = VMACHI(y6, c[3], d[2]); y6 = VMACHI(y6, c[4], d[1]); y6 = VMACHI(y6, c[5], d[0]);
+
+  z6 = VMACLO(z6, a[0], b[6]); z6 = VMACLO(z6, a[1], b[5]); z6 = VMACLO(z6, a[2], b[4]); 
+  y6 = VMACLO(y6, c[0], d[6]); y6 = VMACLO(y6, c[1], d[5]); y6 = VMACLO(y6, c[2], d[4]); 
+  z6 = VMACLO(z6, a[3], b[3]); z6 = VMACLO(z6, a[4], b[2]); z6 = VMACLO(z6, a[5], b[1]); 
+  y6 = VMACLO(y6, c[3], d[3]); y6 = VMACLO(y6, c[4], d[2]); y6 = VMACLO(y6, c[5], d[1]); 
+  z6 = VMACLO(z6, a[6], b[0]);
+  y6 = VMACLO(y6, c[6], d[0]);
+  z7 = VMACHI(z7, a[0], b[6]); z7 = VMACHI(z7, a[1], b[5]); z7 = VMACHI(z7, a[2], b[4]); 
+  y7 = VMACHI(y7, c[0], d[6]); y7 = VMACHI(y7, c[1], d[5]); y7 = VMACHI(y7, c[2], d[4]); 
+  z7 = VMACHI(z7, a[3], b[3]); z7 = VMACHI(z7, a[4], b[2]); z7 = VMACHI(z7, a[5], b[1]); 
+  y7 = VMACHI(y7, c[3], d[3]); y7 = VMACHI(y7, c[4], d[2]); y7 = VMACHI(y7, c[5], d[1]); 
+  z7 = VMACHI(z7, a[6], b[0]);
+  y7 = VMACHI(y7, c[6], d[0]);
+
+  z7 = VMACLO(z7, a[0], b[7]); z7 = VMACLO(z7, a[1], b[6]); z7 = VMACLO(z7, a[2], b[5]); 
+  y7 = VMACLO(y7, c[0], d[7]); y7 = VMACLO(y7, c[1], d[6]); y7 = VMACLO(y7, c[2], d[5]); 
+  z7 = VMACLO(z7, a[3], b[4]); z7 = VMACLO(z7, a[4], b[3]); z7 = VMACLO(z7, a[5], b[2]); 
+  y7 = VMACLO(y7, c[3], d[4]); y7 = VMACLO(y7, c[4], d[3]); y7 = VMACLO(y7, c[5], d[2]); 
+  z7 = VMACLO(z7, a[6], b[1]); z7 = VMACLO(z7, a[7], b[0]);
+  y7 = VMACLO(y7, c[6], d[1]); y7 = VMACLO(y7, c[7], d[0]);
+  z8 = VMACHI(z8, a[0], b[7]); z8 = VMACHI(z8, a[1], b[6]); z8 = VMACHI(z8, a[2], b[5]); 
+  y8 = VMACHI(y8, c[0], d[7]); y8 = VMACHI(y8, c[1], d[6]); y8 = VMACHI(y8, c[2], d[5]); 
+  z8 = VMACHI(z8, a[3], b[4]); z8 = VMACHI(z8, a[4], b[3]); z8 = VMACHI(z8, a[5], b[2]); 
+  y8 = VMACHI(y8, c[3], d[4]); y8 = VMACHI(y8, c[4], d[3]); y8 = VMACHI(y8, c[5], d[2]); 
+  z8 = VMACHI(z8, a[6], b[1]); z8 = VMACHI(z8, a[7], b[0]);
+  y8 = VMACHI(y8, c[6], d[1]); y8 = VMACHI(y8, c[7], d[0]);
+
+  z8 = VMACLO(z8, a[0], b[8]); z8 = VMACLO(z8, a[1], b[7]); z8 = VMACLO(z8, a[2], b[6]); 
+  y8 = VMACLO(y8, c[0], d[8]); y8 = VMACLO(y8, c[1], d[7]); y8 = VMACLO(y8, c[2], d[6]); 
+  z8 = VMACLO(z8, a[3], b[5]); z8 = VMACLO(z8, a[4], b[4]); z8 = VMACLO(z8, a[5], b[3]); 
+  y8 = VMACLO(y8, c[3], d[5]); y8 = VMACLO(y8, c[4], d[4]); y8 = VMACLO(y8, c[5], d[3]); 
+  z8 = VMACLO(z8, a[6], b[2]); z8 = VMACLO(z8, a[7], b[1]); z8 = VMACLO(z8, a[8], b[0]);
+  y8 = VMACLO(y8, c[6], d[2]); y8 = VMACLO(y8, c[7], d[1]); y8 = VMACLO(y8, c[8], d[0]);
+  z9 = VMACHI(z9, a[0], b[8]); z9 = VMACHI(z9, a[1], b[7]); z9 = VMACHI(z9, a[2], b[6]); 
+  y9 = VMACHI(y9, c[0], d[8]); y9 = VMACHI(y9, c[1], d[7]); y9 = VMACHI(y9, c[2], d[6]); 
+  z9 = VMACHI(z9, a[3], b[5]); z9 = VMACHI(z9, a[4], b[4]); z9 = VMACHI(z9, a[5], b[3]); 
+  y9 = VMACHI(y9, c[3], d[5]); y9 = VMACHI(y9, c[4], d[4]); y9 = VMACHI(y9, c[5], d[3]); 
+  z9 = VMACHI(z9, a[6], b[2]); z9 = VMACHI(z9, a[7], b[1]); z9 = VMACHI(z9, a[8], b[0]);
+  y9 = VMACHI(y9, c[6], d[2]); y9 = VMACHI(y9, c[7], d[1]); y9 = VMACHI(y9, c[8], d[0]);
+
+  z9 = VMACLO(z9, a[0], b[9]); z9 = VMACLO(z9, a[1], b[8]); z9 = VMACLO(z9, a[2], b[7]); 
+  y9 = VMACLO(y9, c[0], d[9]); y9 = VMACLO(y9, c[1], d[8]); y9 = VMACLO(y9, c[2], d[7]); 
+  z9 = VMACLO(z9, a[3], b[6]); z9 = VMACLO(z9, a[4], b[5]); z9 = VMACLO(z9, a[5], b[4]); 
+  y9 = VMACLO(y9, c[3], d[6]); y9 = VMACLO(y9, c[4], d[5]); y9 = VMACLO(y9, c[5], d[4]); 
+  z9 = VMACLO(z9, a[6], b[3]); z9 = VMACLO(z9, a[7], b[2]); z9 = VMACLO(z9, a[8], b[1]); 
+  y9 = VMACLO(y9, c[6], d[3]); y9 = VMACLO(y9, c[7], d[2]); y9 = VMACLO(y9, c[8], d[1]); 
+  z9 = VMACLO(z9, a[9], b[0]);
+  y9 = VMACLO(y9, c[9], d[0]);
+  z10 = VMACHI(z10, a[0], b[9]); z10 = VMACHI(z10, a[1], b[8]); z10 = VMACHI(z10, a[2], b[7]); 
+  y10 = VMACHI(y10, c[0], d[9]); y10 = VMACHI(y10, c[1], d[8]); y10 = VMACHI(y10, c[2], d[7]); 
+  z10 = VMACHI(z10, a[3], b[6]); z10 = VMACHI(z10, a[4], b[5]); z10 = VMACHI(z10, a[5], b[4]); 
+  y10 = VMACHI(y10, c[3], d[6]); y10 = VMACHI(y10, c[4], d[5]); y10 = VMACHI(y10, c[5], d[4]); 
+  z10 = VMACHI(z10, a[6], b[3]); z10 = VMACHI(z10, a[7], b[2]); z10 = VMACHI(z10, a[8], b[1]); 
+  y10 = VMACHI(y10, c[6], d[3]); y10 = VMACHI(y10, c[7], d[2]); y10 = VMACHI(y10, c[8], d[1]); 
+  z10 = VMACHI(z10, a[9], b[0]);
+  y10 = VMACHI(y10, c[9], d[0]);
+
+  // ---------------------------------------------------------------------------
+  // 2nd loop of integer multiplication + Montgomery reduction  
+
+  u = VMACLO(zero, z0, vw); 
+  v = VMACLO(zero, y0, vw); 
+  z0 = VMACLO(z0, u, vp0); z1  = VMACHI(z1,  u, vp0); 
+  y0 = VMACLO(y0, v, vp0); y1  = VMACHI(y1,  v, vp0); 
+  z1 = VMACLO(z1, u, vp1); z2  = VMACHI(z2,  u, vp1); 
+  y1 = VMACLO(y1, v, vp1); y2  = VMACHI(y2,  v, vp1); 
+  z2 = VMACLO(z2, u, vp2); z3  = VMACHI(z3,  u, vp2); 
+  y2 = VMACLO(y2, v, vp2); y3  = VMACHI(y3,  v, vp2); 
+  z3 = VMACLO(z3, u, vp3); z4  = VMACHI(z4,  u, vp3); 
+  y3 = VMACLO(y3, v, vp3); y4  = VMACHI(y4,  v, vp3); 
+  z4 = VMACLO(z4, u, vp4); z5  = VMACHI(z5,  u, vp4); 
+  y4 = VMACLO(y4, v, vp4); y5  = VMACHI(y5,  v, vp4); 
+  z5 = VMACLO(z5, u, vp5); z6  = VMACHI(z6,  u, vp5); 
+  y5 = VMACLO(y5, v, vp5); y6  = VMACHI(y6,  v, vp5); 
+  z6 = VMACLO(z6, u, vp6); z7  = VMACHI(z7,  u, vp6); 
+  y6 = VMACLO(y6, v, vp6); y7  = VMACHI(y7,  v, vp6); 
+  z7 = VMACLO(z7, u, vp7); z8  = VMACHI(z8,  u, vp7); 
+  y7 = VMACLO(y7, v, vp7); y8  = VMACHI(y8,  v, vp7); 
+  z8 = VMACLO(z8, u, vp8); z9  = VMACHI(z9,  u, vp8); 
+  y8 = VMACLO(y8, v, vp8); y9  = VMACHI(y9,  v, vp8); 
+  z9 = VMACLO(z9, u, vp9); z10 = VMACHI(z10, u, vp9); 
+  y9 = VMACLO(y9, v, vp9); y10 = VMACHI(y10, v, vp9); 
+  z1 = VADD(z1, VSHR(z0, HT_BRADIX));
+  y1 = VADD(y1, VSHR(y0, HT_BRADIX));
+
+  z10 = VMACLO(z10, a[1], b[9]); z10 = VMACLO(z10, a[2], b[8]); z10 = VMACLO(z10, a[3], b[7]); 
+  y10 = VMACLO(y10, c[1], d[9]); y10 = VMACLO(y10, c[2], d[8]); y10 = VMACLO(y10, c[3], d[7]); 
+  z10 = VMACLO(z10, a[4], b[6]); z10 = VMACLO(z10, a[5], b[5]); z10 = VMACLO(z10, a[6], b[4]); 
+  y10 = VMACLO(y10, c[4], d[6]); y10 = VMACLO(y10, c[5], d[5]); y10 = VMACLO(y10, c[6], d[4]); 
+  z10 = VMACLO(z10, a[7], b[3]); z10 = VMACLO(z10, a[8], b[2]); z10 = VMACLO(z10, a[9], b[1]);
+  y10 = VMACLO(y10, c[7], d[3]); y10 = VMACLO(y10, c[8], d[2]); y10 = VMACLO(y10, c[9], d[1]);
+  z11 = VMACHI(z11, a[1], b[9]); z11 = VMACHI(z11, a[2], b[8]); z11 = VMACHI(z11, a[3], b[7]); 
+  y11 = VMACHI(y11, c[1], d[9]); y11 = VMACHI(y11, c[2], d[8]); y11 = VMACHI(y11, c[3], d[7]); 
+  z11 = VMACHI(z11, a[4], b[6]); z11 = VMACHI(z11, a[5], b[5]); z11 = VMACHI(z11, a[6], b[4]); 
+  y11 = VMACHI(y11, c[4], d[6]); y11 = VMACHI(y11, c[5], d[5]); y11 = VMACHI(y11, c[6], d[4]); 
+  z11 = VMACHI(z11, a[7], b[3]); z11 = VMACHI(z11, a[8], b[2]); z11 = VMACHI(z11, a[9], b[1]); 
+  y11 = VMACHI(y11, c[7], d[3]); y11 = VMACHI(y11, c[8], d[2]); y11 = VMACHI(y11, c[9], d[1]); 
+
+  u = VMACLO(zero, z1, vw); 
+  v = VMACLO(zero, y1, vw); 
+  z1  = VMACLO(z1,  u, vp0); z2  = VMACHI(z2,  u, vp0); 
+  y1  = VMACLO(y1,  v, vp0); y2  = VMACHI(y2,  v, vp0); 
+  z2  = VMACLO(z2,  u, vp1); z3  = VMACHI(z3,  u, vp1); 
+  y2  = VMACLO(y2,  v, vp1); y3  = VMACHI(y3,  v, vp1); 
+  z3  = VMACLO(z3,  u, vp2); z4  = VMACHI(z4,  u, vp2); 
+  y3  = VMACLO(y3,  v, vp2); y4  = VMACHI(y4,  v, vp2); 
+  z4  = VMACLO(z4,  u, vp3); z5  = VMACHI(z5,  u, vp3); 
+  y4  = VMACLO(y4,  v, vp3); y5  = VMACHI(y5,  v, vp3); 
+  z5  = VMACLO(z5,  u, vp4); z6  = VMACHI(z6,  u, vp4); 
+  y5  = VMACLO(y5,  v, vp4); y6  = VMACHI(y6,  v, vp4); 
+  z6  = VMACLO(z6,  u, vp5); z7  = VMACHI(z7,  u, vp5); 
+  y6  = VMACLO(y6,  v, vp5); y7  = VMACHI(y7,  v, vp5); 
+  z7  = VMACLO(z7,  u, vp6); z8  = VMACHI(z8,  u, vp6); 
+  y7  = VMACLO(y7,  v, vp6); y8  = VMACHI(y8,  v, vp6); 
+  z8  = VMACLO(z8,  u, vp7); z9  = VMACHI(z9,  u, vp7); 
+  y8  = VMACLO(y8,  v, vp7); y9  = VMACHI(y9,  v, vp7); 
+  z9  = VMACLO(z9,  u, vp8); z10 = VMACHI(z10, u, vp8); 
+  y9  = VMACLO(y9,  v, vp8); y10 = VMACHI(y10, v, vp8); 
+  z10 = VMACLO(z10, u, vp9); z11 = VMACHI(z11, u, vp9); 
+  y10 = VMACLO(y10, v, vp9); y11 = VMACHI(y11, v, vp9); 
+  z2 = VADD(z2, VSHR(z1, HT_BRADIX));
+  y2 = VADD(y2, VSHR(y1, HT_BRADIX));
+
+  z11 = VMACLO(z11, a[2], b[9]); z11 = VMACLO(z11, a[3], b[8]); z11 = VMACLO(z11, a[4], b[7]); 
+  y11 = VMACLO(y11, c[2], d[9]); y11 = VMACLO(y11, c[3], d[8]); y11 = VMACLO(y11, c[4], d[7]); 
+  z11 = VMACLO(z11, a[5], b[6]); z11 = VMACLO(z11, a[6], b[5]); z11 = VMACLO(z11, a[7], b[4]); 
+  y11 = VMACLO(y11, c[5], d[6]); y11 = VMACLO(y11, c[6], d[5]); y11 = VMACLO(y11, c[7], d[4]); 
+  z11 = VMACLO(z11, a[8], b[3]); z11 = VMACLO(z11, a[9], b[2]);
+  y11 = VMACLO(y11, c[8], d[3]); y11 = VMACLO(y11, c[9], d[2]);
+  z12 = VMACHI(z12, a[2], b[9]); z12 = VMACHI(z12, a[3], b[8]); z12 = VMACHI(z12, a[4], b[7]); 
+  y12 = VMACHI(y12, c[2], d[9]); y12 = VMACHI(y12, c[3], d[8]); y12 = VMACHI(y12, c[4], d[7]); 
+  z12 = VMACHI(z12, a[5], b[6]); z12 = VMACHI(z12, a[6], b[5]); z12 = VMACHI(z12, a[7], b[4]); 
+  y12 = VMACHI(y12, c[5], d[6]); y12 = VMACHI(y12, c[6], d[5]); y12 = VMACHI(y12, c[7], d[4]); 
+  z12 = VMACHI(z12, a[8], b[3]); z12 = VMACHI(z12, a[9], b[2]);
+  y12 = VMACHI(y12, c[8], d[3]); y12 = VMACHI(y12, c[9], d[2]);
+
+  u = VMACLO(zero, z2, vw); 
+  v = VMACLO(zero, y2, vw); 
+  z2  = VMACLO(z2,  u, vp0); z3  = VMACHI(z3,  u, vp0); 
+  y2  = VMACLO(y2,  v, vp0); y3  = VMACHI(y3,  v, vp0); 
+  z3  = VMACLO(z3,  u, vp1); z4  = VMACHI(z4,  u, vp1); 
+  y3  = VMACLO(y3,  v, vp1); y4  = VMACHI(y4,  v, vp1); 
+  z4  = VMACLO(z4,  u, vp2); z5  = VMACHI(z5,  u, vp2); 
+  y4  = VMACLO(y4,  v, vp2); y5  = VMACHI(y5,  v, vp2); 
+  z5  = VMACLO(z5,  u, vp3); z6  = VMACHI(z6,  u, vp3); 
+  y5  = VMACLO(y5,  v, vp3); y6  = VMACHI(y6,  v, vp3); 
+  z6  = VMACLO(z6,  u, vp4); z7  = VMACHI(z7,  u, vp4); 
+  y6  = VMACLO(y6,  v, vp4); y7  = VMACHI(y7,  v, vp4); 
+  z7  = VMACLO(z7,  u, vp5); z8  = VMACHI(z8,  u, vp5); 
+  y7  = VMACLO(y7,  v, vp5); y8  = VMACHI(y8,  v, vp5); 
+  z8  = VMACLO(z8,  u, vp6); z9  = VMACHI(z9,  u, vp6); 
+  y8  = VMACLO(y8,  v, vp6); y9  = VMACHI(y9,  v, vp6); 
+  z9  = VMACLO(z9,  u, vp7); z10 = VMACHI(z10, u, vp7); 
+  y9  = VMACLO(y9,  v, vp7); y10 = VMACHI(y10, v, vp7); 
+  z10 = VMACLO(z10, u, vp8); z11 = VMACHI(z11, u, vp8); 
+  y10 = VMACLO(y10, v, vp8); y11 = VMACHI(y11, v, vp8); 
+  z11 = VMACLO(z11, u, vp9); z12 = VMACHI(z12, u, vp9); 
+  y11 = VMACLO(y11, v, vp9); y12 = VMACHI(y12, v, vp9); 
+  z3 = VADD(z3, VSHR(z2, HT_BRADIX));
+  y3 = VADD(y3, VSHR(y2, HT_BRADIX));
+
+  z12 = VMACLO(z12, a[3], b[9]); z12 = VMACLO(z12, a[4], b[8]); z12 = VMACLO(z12, a[5], b[7]); 
+  y12 = VMACLO(y12, c[3], d[9]); y12 = VMACLO(y12, c[4], d[8]); y12 = VMACLO(y12, c[5], d[7]); 
+  z12 = VMACLO(z12, a[6], b[6]); z12 = VMACLO(z12, a[7], b[5]); z12 = VMACLO(z12, a[8], b[4]); 
+  y12 = VMACLO(y12, c[6], d[6]); y12 = VMACLO(y12, c[7], d[5]); y12 = VMACLO(y12, c[8], d[4]); 
+  z12 = VMACLO(z12, a[9], b[3]);
+  y12 = VMACLO(y12, c[9], d[3]);
+  z13 = VMACHI(z13, a[3], b[9]); z13 = VMACHI(z13, a[4], b[8]); z13 = VMACHI(z13, a[5], b[7]); 
+  y13 = VMACHI(y13, c[3], d[9]); y13 = VMACHI(y13, c[4], d[8]); y13 = VMACHI(y13, c[5], d[7]); 
+  z13 = VMACHI(z13, a[6], b[6]); z13 = VMACHI(z13, a[7], b[5]); z13 = VMACHI(z13, a[8], b[4]); 
+  y13 = VMACHI(y13, c[6], d[6]); y13 = VMACHI(y13, c[7], d[5]); y13 = VMACHI(y13, c[8], d[4]); 
+  z13 = VMACHI(z13, a[9], b[3]);
+  y13 = VMACHI(y13, c[9], d[3]);
+
+  u = VMACLO(zero, z3, vw); 
+  v = VMACLO(zero, y3, vw); 
+  z3  = VMACLO(z3,  u, vp0); z4  = VMACHI(z4,  u, vp0); 
+  y3  = VMACLO(y3,  v, vp0); y4  = VMACHI(y4,  v, vp0); 
+  z4  = VMACLO(z4,  u, vp1); z5  = VMACHI(z5,  u, vp1); 
+  y4  = VMACLO(y4,  v, vp1); y5  = VMACHI(y5,  v, vp1); 
+  z5  = VMACLO(z5,  u, vp2); z6  = VMACHI(z6,  u, vp2); 
+  y5  = VMACLO(y5,  v, vp2); y6  = VMACHI(y6,  v, vp2); 
+  z6  = VMACLO(z6,  u, vp3); z7  = VMACHI(z7,  u, vp3); 
+  y6  = VMACLO(y6,  v, vp3); y7  = VMACHI(y7,  v, vp3); 
+  z7  = VMACLO(z7,  u, vp4); z8  = VMACHI(z8,  u, vp4); 
+  y7  = VMACLO(y7,  v, vp4); y8  = VMACHI(y8,  v, vp4); 
+  z8  = VMACLO(z8,  u, vp5); z9  = VMACHI(z9,  u, vp5); 
+  y8  = VMACLO(y8,  v, vp5); y9  = VMACHI(y9,  v, vp5); 
+  z9  = VMACLO(z9,  u, vp6); z10 = VMACHI(z10, u, vp6); 
+  y9  = VMACLO(y9,  v, vp6); y10 = VMACHI(y10, v, vp6); 
+  z10 = VMACLO(z10, u, vp7); z11 = VMACHI(z11, u, vp7); 
+  y10 = VMACLO(y10, v, vp7); y11 = VMACHI(y11, v, vp7); 
+  z11 = VMACLO(z11, u, vp8); z12 = VMACHI(z12, u, vp8); 
+  y11 = VMACLO(y11, v, vp8); y12 = VMACHI(y12, v, vp8); 
+  z12 = VMACLO(z12, u, vp9); z13 = VMACHI(z13, u, vp9); 
+  y12 = VMACLO(y12, v, vp9); y13 = VMACHI(y13, v, vp9); 
+  z4 = VADD(z4, VSHR(z3, HT_BRADIX));
+  y4 = VADD(y4, VSHR(y3, HT_BRADIX));
+
+  z13 = VMACLO(z13, a[4], b[9]); z13 = VMACLO(z13, a[5], b[8]); z13 = VMACLO(z13, a[6], b[7]); 
+  y13 = VMACLO(y13, c[4], d[9]); y13 = VMACLO(y13, c[5], d[8]); y13 = VMACLO(y13, c[6], d[7]); 
+  z13 = VMACLO(z13, a[7], b[6]); z13 = VMACLO(z13, a[8], b[5]); z13 = VMACLO(z13, a[9], b[4]);
+  y13 = VMACLO(y13, c[7], d[6]); y13 = VMACLO(y13, c[8], d[5]); y13 = VMACLO(y13, c[9], d[4]);
+  z14 = VMACHI(z14, a[4], b[9]); z14 = VMACHI(z14, a[5], b[8]); z14 = VMACHI(z14, a[6], b[7]); 
+  y14 = VMACHI(y14, c[4], d[9]); y14 = VMACHI(y14, c[5], d[8]); y14 = VMACHI(y14, c[6], d[7]); 
+  z14 = VMACHI(z14, a[7], b[6]); z14 = VMACHI(z14, a[8], b[5]); z14 = VMACHI(z14, a[9], b[4]);
+  y14 = VMACHI(y14, c[7], d[6]); y14 = VMACHI(y14, c[8], d[5]); y14 = VMACHI(y14, c[9], d[4]);
+
+  u = VMACLO(zero, z4, vw); 
+  v = VMACLO(zero, y4, vw); 
+  z4  = VMACLO(z4,  u, vp0); z5  = VMACHI(z5,  u, vp0); 
+  y4  = VMACLO(y4,  v, vp0); y5  = VMACHI(y5,  v, vp0); 
+  z5  = VMACLO(z5,  u, vp1); z6  = VMACHI(z6,  u, vp1); 
+  y5  = VMACLO(y5,  v, vp1); y6  = VMACHI(y6,  v, vp1); 
+  z6  = VMACLO(z6,  u, vp2); z7  = VMACHI(z7,  u, vp2); 
+  y6  = VMACLO(y6,  v, vp2); y7  = VMACHI(y7,  v, vp2); 
+  z7  = VMACLO(z7,  u, vp3); z8  = VMACHI(z8,  u, vp3); 
+  y7  = VMACLO(y7,  v, vp3); y8  = VMACHI(y8,  v, vp3); 
+  z8  = VMACLO(z8,  u, vp4); z9  = VMACHI(z9,  u, vp4); 
+  y8  = VMACLO(y8,  v, vp4); y9  = VMACHI(y9,  v, vp4); 
+  z9  = VMACLO(z9,  u, vp5); z10 = VMACHI(z10, u, vp5); 
+  y9  = VMACLO(y9,  v, vp5); y10 = VMACHI(y10, v, vp5); 
+  z10 = VMACLO(z10, u, vp6); z11 = VMACHI(z11, u, vp6); 
+  y10 = VMACLO(y10, v, vp6); y11 = VMACHI(y11, v, vp6); 
+  z11 = VMACLO(z11, u, vp7); z12 = VMACHI(z12, u, vp7); 
+  y11 = VMACLO(y11, v, vp7); y12 = VMACHI(y12, v, vp7); 
+  z12 = VMACLO(z12, u, vp8); z13 = VMACHI(z13, u, vp8); 
+  y12 = VMACLO(y12, v, vp8); y13 = VMACHI(y13, v, vp8); 
+  z13 = VMACLO(z13, u, vp9); z14 = VMACHI(z14, u, vp9); 
+  y13 = VMACLO(y13, v, vp9); y14 = VMACHI(y14, v, vp9); 
+  z5 = VADD(z5, VSHR(z4, HT_BRADIX)); 
+  y5 = VADD(y5, VSHR(y4, HT_BRADIX)); 
+
+  z14 = VMACLO(z14, a[5], b[9]); z14 = VMACLO(z14, a[6], b[8]); z14 = VMACLO(z14, a[7], b[7]); 
+  y14 = VMACLO(y14, c[5], d[9]); y14 = VMACLO(y14, c[6], d[8]); y14 = VMACLO(y14, c[7], d[7]); 
+  z14 = VMACLO(z14, a[8], b[6]); z14 = VMACLO(z14, a[9], b[5]);
+  y14 = VMACLO(y14, c[8], d[6]); y14 = VMACLO(y14, c[9], d[5]);
+  z15 = VMACHI(z15, a[5], b[9]); z15 = VMACHI(z15, a[6], b[8]); z15 = VMACHI(z15, a[7], b[7]); 
+  y15 = VMACHI(y15, c[5], d[9]); y15 = VMACHI(y15, c[6], d[8]); y15 = VMACHI(y15, c[7], d[7]); 
+  z15 = VMACHI(z15, a[8], b[6]); z15 = VMACHI(z15, a[9], b[5]);
+  y15 = VMACHI(y15, c[8], d[6]); y15 = VMACHI(y15, c[9], d[5]);
+
+  u = VMACLO(zero, z5, vw); 
+  v = VMACLO(zero, y5, vw); 
+  z5  = VMACLO(z5,  u, vp0); z6  = VMACHI(z6,  u, vp0); 
+  y5  = VMACLO(y5,  v, vp0); y6  = VMACHI(y6,  v, vp0); 
+  z6  = VMACLO(z6,  u, vp1); z7  = VMACHI(z7,  u, vp1); 
+  y6  = VMACLO(y6,  v, vp1); y7  = VMACHI(y7,  v, vp1); 
+  z7  = VMACLO(z7,  u, vp2); z8  = VMACHI(z8,  u, vp2); 
+  y7  = VMACLO(y7,  v, vp2); y8  = VMACHI(y8,  v, vp2); 
+  z8  = VMACLO(z8,  u, vp3); z9  = VMACHI(z9,  u, vp3); 
+  y8  = VMACLO(y8,  v, vp3); y9  = VMACHI(y9,  v, vp3); 
+  z9  = VMACLO(z9,  u, vp4); z10 = VMACHI(z10, u, vp4); 
+  y9  = VMACLO(y9,  v, vp4); y10 = VMACHI(y10, v, vp4); 
+  z10 = VMACLO(z10, u, vp5); z11 = VMACHI(z11, u, vp5); 
+  y10 = VMACLO(y10, v, vp5); y11 = VMACHI(y11, v, vp5); 
+  z11 = VMACLO(z11, u, vp6); z12 = VMACHI(z12, u, vp6); 
+  y11 = VMACLO(y11, v, vp6); y12 = VMACHI(y12, v, vp6); 
+  z12 = VMACLO(z12, u, vp7); z13 = VMACHI(z13, u, vp7); 
+  y12 = VMACLO(y12, v, vp7); y13 = VMACHI(y13, v, vp7); 
+  z13 = VMACLO(z13, u, vp8); z14 = VMACHI(z14, u, vp8); 
+  y13 = VMACLO(y13, v, vp8); y14 = VMACHI(y14, v, vp8); 
+  z14 = VMACLO(z14, u, vp9); z15 = VMACHI(z15, u, vp9); 
+  y14 = VMACLO(y14, v, vp9); y15 = VMACHI(y15, v, vp9); 
+  z6 = VADD(z6, VSHR(z5, HT_BRADIX));
+  y6 = VADD(y6, VSHR(y5, HT_BRADIX));
+
+  z15 = VMACLO(z15, a[6], b[9]); z15 = VMACLO(z15, a[7], b[8]); z15 = VMACLO(z15, a[8], b[7]); 
+  y15 = VMACLO(y15, c[6], d[9]); y15 = VMACLO(y15, c[7], d[8]); y15 = VMACLO(y15, c[8], d[7]); 
+  z15 = VMACLO(z15, a[9], b[6]);
+  y15 = VMACLO(y15, c[9], d[6]);
+  z16 = VMACHI(z16, a[6], b[9]); z16 = VMACHI(z16, a[7], b[8]); z16 = VMACHI(z16, a[8], b[7]); 
+  y16 = VMACHI(y16, c[6], d[9]); y16 = VMACHI(y16, c[7], d[8]); y16 = VMACHI(y16, c[8], d[7]); 
+  z16 = VMACHI(z16, a[9], b[6]);
+  y16 = VMACHI(y16, c[9], d[6]);
+
+  u = VMACLO(zero, z6, vw); 
+  v = VMACLO(zero, y6, vw); 
+  z6  = VMACLO(z6,  u, vp0); z7  = VMACHI(z7,  u, vp0); 
+  y6  = VMACLO(y6,  v, vp0); y7  = VMACHI(y7,  v, vp0); 
+  z7  = VMACLO(z7,  u, vp1); z8  = VMACHI(z8,  u, vp1); 
+  y7  = VMACLO(y7,  v, vp1); y8  = VMACHI(y8,  v, vp1); 
+  z8  = VMACLO(z8,  u, vp2); z9  = VMACHI(z9,  u, vp2); 
+  y8  = VMACLO(y8,  v, vp2); y9  = VMACHI(y9,  v, vp2); 
+  z9  = VMACLO(z9,  u, vp3); z10 = VMACHI(z10, u, vp3); 
+  y9  = VMACLO(y9,  v, vp3); y10 = VMACHI(y10, v, vp3); 
+  z10 = VMACLO(z10, u, vp4); z11 = VMACHI(z11, u, vp4); 
+  y10 = VMACLO(y10, v, vp4); y11 = VMACHI(y11, v, vp4); 
+  z11 = VMACLO(z11, u, vp5); z12 = VMACHI(z12, u, vp5); 
+  y11 = VMACLO(y11, v, vp5); y12 = VMACHI(y12, v, vp5); 
+  z12 = VMACLO(z12, u, vp6); z13 = VMACHI(z13, u, vp6); 
+  y12 = VMACLO(y12, v, vp6); y13 = VMACHI(y13, v, vp6); 
+  z13 = VMACLO(z13, u, vp7); z14 = VMACHI(z14, u, vp7); 
+  y13 = VMACLO(y13, v, vp7); y14 = VMACHI(y14, v, vp7); 
+  z14 = VMACLO(z14, u, vp8); z15 = VMACHI(z15, u, vp8); 
+  y14 = VMACLO(y14, v, vp8); y15 = VMACHI(y15, v, vp8); 
+  z15 = VMACLO(z15, u, vp9); z16 = VMACHI(z16, u, vp9); 
+  y15 = VMACLO(y15, v, vp9); y16 = VMACHI(y16, v, vp9); 
+  z7 = VADD(z7, VSHR(z6, HT_BRADIX));  
+  y7 = VADD(y7, VSHR(y6, HT_BRADIX));  
+
+  z16 = VMACLO(z16, a[7], b[9]); z16 = VMACLO(z16, a[8], b[8]); z16 = VMACLO(z16, a[9], b[7]);
+  y16 = VMACLO(y16, c[7], d[9]); y16 = VMACLO(y16, c[8], d[8]); y16 = VMACLO(y16, c[9], d[7]);
+  z17 = VMACHI(z17, a[7], b[9]); z17 = VMACHI(z17, a[8], b[8]); z17 = VMACHI(z17, a[9], b[7]);
+  y17 = VMACHI(y17, c[7], d[9]); y17 = VMACHI(y17, c[8], d[8]); y17 = VMACHI(y17, c[9], d[7]);
+
+  u = VMACLO(zero, z7, vw); 
+  v = VMACLO(zero, y7, vw); 
+  z7  = VMACLO(z7,  u, vp0); z8  = VMACHI(z8,  u, vp0); 
+  y7  = VMACLO(y7,  v, vp0); y8  = VMACHI(y8,  v, vp0); 
+  z8  = VMACLO(z8,  u, vp1); z9  = VMACHI(z9,  u, vp1); 
+  y8  = VMACLO(y8,  v, vp1); y9  = VMACHI(y9,  v, vp1); 
+  z9  = VMACLO(z9,  u, vp2); z10 = VMACHI(z10, u, vp2); 
+  y9  = VMACLO(y9,  v, vp2); y10 = VMACHI(y10, v, vp2); 
+  z10 = VMACLO(z10, u, vp3); z11 = VMACHI(z11, u, vp3); 
+  y10 = VMACLO(y10, v, vp3); y11 = VMACHI(y11, v, vp3); 
+  z11 = VMACLO(z11, u, vp4); z12 = VMACHI(z12, u, vp4); 
+  y11 = VMACLO(y11, v, vp4); y12 = VMACHI(y12, v, vp4); 
+  z12 = VMACLO(z12, u, vp5); z13 = VMACHI(z13, u, vp5); 
+  y12 = VMACLO(y12, v, vp5); y13 = VMACHI(y13, v, vp5); 
+  z13 = VMACLO(z13, u, vp6); z14 = VMACHI(z14, u, vp6); 
+  y13 = VMACLO(y13, v, vp6); y14 = VMACHI(y14, v, vp6); 
+  z14 = VMACLO(z14, u, vp7); z15 = VMACHI(z15, u, vp7); 
+  y14 = VMACLO(y14, v, vp7); y15 = VMACHI(y15, v, vp7); 
+  z15 = VMACLO(z15, u, vp8); z16 = VMACHI(z16, u, vp8); 
+  y15 = VMACLO(y15, v, vp8); y16 = VMACHI(y16, v, vp8); 
+  z16 = VMACLO(z16, u, vp9); z17 = VMACHI(z17, u, vp9); 
+  y16 = VMACLO(y16, v, vp9); y17 = VMACHI(y17, v, vp9); 
+  z8 = VADD(z8, VSHR(z7, HT_BRADIX)); 
+  y8 = VADD(y8, VSHR(y7, HT_BRADIX)); 
+
+  z17 = VMACLO(z17, a[8], b[9]); z17 = VMACLO(z17, a[9], b[8]);
+  y17 = VMACLO(y17, c[8], d[9]); y17 = VMACLO(y17, c[9], d[8]);
+  z18 = VMACHI(z18, a[8], b[9]); z18 = VMACHI(z18, a[9], b[8]);
+  y18 = VMACHI(y18, c[8], d[9]); y18 = VMACHI(y18, c[9], d[8]);
+
+  u = VMACLO(zero, z8, vw); 
+  v = VMACLO(zero, y8, vw); 
+  z8  = VMACLO(z8,  u, vp0); z9  = VMACHI(z9,  u, vp0); 
+  y8  = VMACLO(y8,  v, vp0); y9  = VMACHI(y9,  v, vp0); 
+  z9  = VMACLO(z9,  u, vp1); z10 = VMACHI(z10, u, vp1); 
+  y9  = VMACLO(y9,  v, vp1); y10 = VMACHI(y10, v, vp1); 
+  z10 = VMACLO(z10, u, vp2); z11 = VMACHI(z11, u, vp2); 
+  y10 = VMACLO(y10, v, vp2); y11 = VMACHI(y11, v, vp2); 
+  z11 = VMACLO(z11, u, vp3); z12 = VMACHI(z12, u, vp3); 
+  y11 = VMACLO(y11, v, vp3); y12 = VMACHI(y12, v, vp3); 
+  z12 = VMACLO(z12, u, vp4); z13 = VMACHI(z13, u, vp4); 
+  y12 = VMACLO(y12, v, vp4); y13 = VMACHI(y13, v, vp4); 
+  z13 = VMACLO(z13, u, vp5); z14 = VMACHI(z14, u, vp5); 
+  y13 = VMACLO(y13, v, vp5); y14 = VMACHI(y14, v, vp5); 
+  z14 = VMACLO(z14, u, vp6); z15 = VMACHI(z15, u, vp6); 
+  y14 = VMACLO(y14, v, vp6); y15 = VMACHI(y15, v, vp6); 
+  z15 = VMACLO(z15, u, vp7); z16 = VMACHI(z16, u, vp7); 
+  y15 = VMACLO(y15, v, vp7); y16 = VMACHI(y16, v, vp7); 
+  z16 = VMACLO(z16, u, vp8); z17 = VMACHI(z17, u, vp8); 
+  y16 = VMACLO(y16, v, vp8); y17 = VMACHI(y17, v, vp8); 
+  z17 = VMACLO(z17, u, vp9); z18 = VMACHI(z18, u, vp9); 
+  y17 = VMACLO(y17, v, vp9); y18 = VMACHI(y18, v, vp9); 
+  z9 = VADD(z9, VSHR(z8, HT_BRADIX));  
+  y9 = VADD(y9, VSHR(y8, HT_BRADIX));  
+
+  z18 = VMACLO(z18, a[9], b[9]);
+  y18 = VMACLO(y18, c[9], d[9]);
+  z19 = VMACHI(z19, a[9], b[9]);
+  y19 = VMACHI(y19, c[9], d[9]);
+
+  u = VMACLO(zero, z9, vw); 
+  v = VMACLO(zero, y9, vw); 
+  z9  = VMACLO(z9,  u, vp0); z10 = VMACHI(z10, u, vp0); 
+  y9  = VMACLO(y9,  v, vp0); y10 = VMACHI(y10, v, vp0); 
+  z10 = VMACLO(z10, u, vp1); z11 = VMACHI(z11, u, vp1); 
+  y10 = VMACLO(y10, v, vp1); y11 = VMACHI(y11, v, vp1); 
+  z11 = VMACLO(z11, u, vp2); z12 = VMACHI(z12, u, vp2); 
+  y11 = VMACLO(y11, v, vp2); y12 = VMACHI(y12, v, vp2); 
+  z12 = VMACLO(z12, u, vp3); z13 = VMACHI(z13, u, vp3); 
+  y12 = VMACLO(y12, v, vp3); y13 = VMACHI(y13, v, vp3); 
+  z13 = VMACLO(z13, u, vp4); z14 = VMACHI(z14, u, vp4); 
+  y13 = VMACLO(y13, v, vp4); y14 = VMACHI(y14, v, vp4); 
+  z14 = VMACLO(z14, u, vp5); z15 = VMACHI(z15, u, vp5); 
+  y14 = VMACLO(y14, v, vp5); y15 = VMACHI(y15, v, vp5); 
+  z15 = VMACLO(z15, u, vp6); z16 = VMACHI(z16, u, vp6); 
+  y15 = VMACLO(y15, v, vp6); y16 = VMACHI(y16, v, vp6); 
+  z16 = VMACLO(z16, u, vp7); z17 = VMACHI(z17, u, vp7); 
+  y16 = VMACLO(y16, v, vp7); y17 = VMACHI(y17, v, vp7); 
+  z17 = VMACLO(z17, u, vp8); z18 = VMACHI(z18, u, vp8); 
+  y17 = VMACLO(y17, v, vp8); y18 = VMACHI(y18, v, vp8); 
+  z18 = VMACLO(z18, u, vp9); z19 = VMACHI(z19, u, vp9);
+  y18 = VMACLO(y18, v, vp9); y19 = VMACHI(y19, v, vp9);
+  z10 = VADD(z10, VSHR(z9, HT_BRADIX));
+  y10 = VADD(y10, VSHR(y9, HT_BRADIX));
+
+  // carry propagation
+  z11 = VADD(z11, VSHR(z10, HT_BRADIX)); z10 = VAND(z10, vbmask);
+  y11 = VADD(y11, VSHR(y10, HT_BRADIX)); y10 = VAND(y10, vbmask);
+  z12 = VADD(z12, VSHR(z11, HT_BRADIX)); z11 = VAND(z11, vbmask);
+  y12 = VADD(y12, VSHR(y11, HT_BRADIX)); y11 = VAND(y11, vbmask);
+  z13 = VADD(z13, VSHR(z12, HT_BRADIX)); z12 = VAND(z12, vbmask);
+  y13 = VADD(y13, VSHR(y12, HT_BRADIX)); y12 = VAND(y12, vbmask);
+  z14 = VADD(z14, VSHR(z13, HT_BRADIX)); z13 = VAND(z13, vbmask);
+  y14 = VADD(y14, VSHR(y13, HT_BRADIX)); y13 = VAND(y13, vbmask);
+  z15 = VADD(z15, VSHR(z14, HT_BRADIX)); z14 = VAND(z14, vbmask);
+  y15 = VADD(y15, VSHR(y14, HT_BRADIX)); y14 = VAND(y14, vbmask);
+  z16 = VADD(z16, VSHR(z15, HT_BRADIX)); z15 = VAND(z15, vbmask);
+  y16 = VADD(y16, VSHR(y15, HT_BRADIX)); y15 = VAND(y15, vbmask);
+  z17 = VADD(z17, VSHR(z16, HT_BRADIX)); z16 = VAND(z16, vbmask);
+  y17 = VADD(y17, VSHR(y16, HT_BRADIX)); y16 = VAND(y16, vbmask);
+  z18 = VADD(z18, VSHR(z17, HT_BRADIX)); z17 = VAND(z17, vbmask);
+  y18 = VADD(y18, VSHR(y17, HT_BRADIX)); y17 = VAND(y17, vbmask);
+  z19 = VADD(z19, VSHR(z18, HT_BRADIX)); z18 = VAND(z18, vbmask);
+  y19 = VADD(y19, VSHR(y18, HT_BRADIX)); y18 = VAND(y18, vbmask);
+
+  // ---------------------------------------------------------------------------
+
+  r[0] = z10; r[1] = z11; r[2] = z12; r[3] = z13; r[4] = z14; 
+  s[0] = y10; s[1] = y11; s[2] = y12; s[3] = y13; s[4] = y14; 
+  r[5] = z15; r[6] = z16; r[7] = z17; r[8] = z18; r[9] = z19;  
+  s[5] = y15; s[6] = y16; s[7] = y17; s[8] = y18; s[9] = y19;  
+}
+
+// two independent Montgomery squarings r = a^2, s = c^2 mod 2p
+// interleaved instruction by instruction to overlap their latency chains;
+// the operands are read from memory to leave the registers to the accumulators
+// -> r, s in [0, 2p)
+void gfp_sqr2_8x1w(htfe_t r, const htfe_t a, htfe_t s, const htfe_t c)
+{
+  __m512i  z0 = VZERO,  z1 = VZERO,  z2 = VZERO,  z3 = VZERO,  z4 = VZERO;
+  __m512i  y0 = VZERO,  y1 = VZERO,  y2 = VZERO,  y3 = VZERO,  y4 = VZERO;
+  __m512i  z5 = VZERO,  z6 = VZERO,  z7 = VZERO,  z8 = VZERO,  z9 = VZERO;
+  __m512i  y5 = VZERO,  y6 = VZERO,  y7 = VZERO,  y8 = VZERO,  y9 = VZERO;
+  __m512i z10 = VZERO, z11 = VZERO, z12 = VZERO, z13 = VZERO, z14 = VZERO;
+  __m512i y10 = VZERO, y11 = VZERO, y12 = VZERO, y13 = VZERO, y14 = VZERO;
+  __m512i z15 = VZERO, z16 = VZERO, z17 = VZERO, z18 = VZERO, z19 = VZERO;
+  __m512i y15 = VZERO, y16 = VZERO, y17 = VZERO, y18 = VZERO, y19 = VZERO;
+  __m512i u, v;
+  const __m512i vp0 = VSET1(ht_p[0]), vp1 = VSET1(ht_p[1]);
+  const __m512i vp2 = VSET1(ht_p[2]), vp3 = VSET1(ht_p[3]);
+  const __m512i vp4 = VSET1(ht_p[4]), vp5 = VSET1(ht_p[5]);
+  const __m512i vp6 = VSET1(ht_p[6]), vp7 = VSET1(ht_p[7]);
+  const __m512i vp8 = VSET1(ht_p[8]), vp9 = VSET1(ht_p[9]);
+  const __m512i vbmask = VSET1(HT_BMASK), vw = VSET1(HT_MONTW), zero = VZERO;
+
+  // ---------------------------------------------------------------------------
+  // 1st loop of integer squaring
+
+  z1 = VMACLO(z1, a[0], a[1]);
+  y1 = VMACLO(y1, c[0], c[1]);
+  z2 = VMACHI(z2, a[0], a[1]);
+  y2 = VMACHI(y2, c[0], c[1]);
+  z1 = VADD(z1, z1);
+  y1 = VADD(y1, y1);
+  z0 = VMACLO(z0, a[0], a[0]); z1 = VMACHI(z1, a[0], a[0]);
+  y0 = VMACLO(y0, c[0], c[0]); y1 = VMACHI(y1, c[0], c[0]);
+
+  z2 = VMACLO(z2, a[0], a[2]); 
+  y2 = VMACLO(y2, c[0], c[2]); 
+  z3 = VMACHI(z3, a[0], a[2]);
+  y3 = VMACHI(y3, c[0], c[2]);
+  z2 = VADD(z2, z2);
+  y2 = VADD(y2, y2);
+
+  z3 = VMACLO(z3, a[0], a[3]); z3 = VMACLO(z3, a[1], a[2]); 
+  y3 = VMACLO(y3, c[0], c[3]); y3 = VMACLO(y3, c[1], c[2]); 
+  z4 = VMACHI(z4, a[0], a[3]); z4 = VMACHI(z4, a[1], a[2]); 
+  y4 = VMACHI(y4, c[0], c[3]); y4 = VMACHI(y4, c[1], c[2]); 
+  z3 = VADD(z3, z3);
+  y3 = VADD(y3, y3);
+  z2 = VMACLO(z2, a[1], a[1]); z3 = VMACHI(z3, a[1], a[1]); 
+  y2 = VMACLO(y2, c[1], c[1]); y3 = VMACHI(y3, c[1], c[1]); 
+
+  z4 = VMACLO(z4, a[0], a[4]); z4 = VMACLO(z4, a[1], a[3]); 
+  y4 = VMACLO(y4, c[0], c[4]); y4 = VMACLO(y4, c[1], c[3]); 
+  z5 = VMACHI(z5, a[0], a[4]); z5 = VMACHI(z5, a[1], a[3]); 
+  y5 = VMACHI(y5, c[0], c[4]); y5 = VMACHI(y5, c[1], c[3]); 
+  z4 = VADD(z4, z4);
+  y4 = VADD(y4, y4);
+
+  z5 = VMACLO(z5, a[0], a[5]); z5 = VMACLO(z5, a[1], a[4]); z5 = VMACLO(z5, a[2], a[3]); 
+  y5 = VMACLO(y5, c[0], c[5]); y5 = VMACLO(y5, c[1], c[4]); y5 = VMACLO(y5, c[2], c[3]); 
+  z6 = VMACHI(z6, a[0], a[5]); z6 = VMACHI(z6, a[1], a[4]); z6 = VMACHI(z6, a[2], a[3]); 
+  y6 = VMACHI(y6, c[0], c[5]); y6 = VMACHI(y6, c[1], c[4]); y6 = VMACHI(y6, c[2], c[3]); 
+  z5 = VADD(z5, z5);
+  y5 = VADD(y5, y5);
+  z4 = VMACLO(z4, a[2], a[2]); z5 = VMACHI(z5, a[2], a[2]); 
+  y4 = VMACLO(y4, c[2], c[2]); y5 = VMACHI(y5, c[2], c[2]); 
+
+  z6 = VMACLO(z6, a[0], a[6]); z6 = VMACLO(z6, a[1], a[5]); z6 = VMACLO(z6, a[2], a[4]); 
+  y6 = VMACLO(y6, c[0], c[6]); y6 = VMACLO(y6, c[1], c[5]); y6 = VMACLO(y6, c[2], c[4]); 
+  z7 = VMACHI(z7, a[0], a[6]); z7 = VMACHI(z7, a[1], a[5]); z7 = VMACHI(z7, a[2], a[4]); 
+  y7 = VMACHI(y7, c[0], c[6]); y7 = VMACHI(y7, c[1], c[5]); y7 = VMACHI(y7, c[2], c[4]); 
+  z6 = VADD(z6, z6);
+  y6 = VADD(y6, y6);
+
+  z7 = VMACLO(z7, a[0], a[7]); z7 = VMACLO(z7, a[1], a[6]); z7 = VMACLO(z7, a[2], a[5]); 
+  y7 = VMACLO(y7, c[0], c[7]); y7 = VMACLO(y7, c[1], c[6]); y7 = VMACLO(y7, c[2], c[5]); 
+  z7 = VMACLO(z7, a[3], a[4]); 
+  y7 = VMACLO(y7, c[3], c[4]); 
+  z8 = VMACHI(z8, a[0], a[7]); z8 = VMACHI(z8, a[1], a[6]); z8 = VMACHI(z8, a[2], a[5]); 
+  y8 = VMACHI(y8, c[0], c[7]); y8 = VMACHI(y8, c[1], c[6]); y8 = VMACHI(y8, c[2], c[5]); 
+  z8 = VMACHI(z8, a[3], a[4]); 
+  y8 = VMACHI(y8, c[3], c[4]); 
+  z7 = VADD(z7, z7);
+  y7 = VADD(y7, y7);
+  z6 = VMACLO(z6, a[3], a[3]); z7 = VMACHI(z7, a[3], a[3]); 
+  y6 = VMACLO(y6, c[3], c[3]); y7 = VMACHI(y7, c[3], c[3]); 
+
+  z8 = VMACLO(z8, a[0], a[8]); z8 = VMACLO(z8, a[1], a[7]); z8 = VMACLO(z8, a[2], a[6]); 
+  y8 = VMACLO(y8, c[0], c[8]); y8 = VMACLO(y8, c[1], c[7]); y8 = VMACLO(y8, c[2], c[6]); 
+  z8 = VMACLO(z8, a[3], a[5]);  
+  y8 = VMACLO(y8, c[3], c[5]);  
+  z9 = VMACHI(z9, a[0], a[8]); z9 = VMACHI(z9, a[1], a[7]); z9 = VMACHI(z9, a[2], a[6]); 
+  y9 = VMACHI(y9, c[0], c[8]); y9 = VMACHI(y9, c[1], c[7]); y9 = VMACHI(y9, c[2], c[6]); 
+  z9 = VMACHI(z9, a[3], a[5]); 
+  y9 = VMACHI(y9, c[3], c[5]); 
+  z8 = VADD(z8, z8);
+  y8 = VADD(y8, y8);
+
+  z9 = VMACLO(z9, a[0], a[9]); z9 = VMACLO(z9, a[1], a[8]); z9 = VMACLO(z9, a[2], a[7]); 
+  y9 = VMACLO(y9, c[0], c[9]); y9 = VMACLO(y9, c[1], c[8]); y9 = VMACLO(y9, c[2], c[7]); 
+  z9 = VMACLO(z9, a[3], a[6]); z9 = VMACLO(z9, a[4], a[5]); 
+  y9 = VMACLO(y9, c[3], c[6]); y9 = VMACLO(y9, c[4], c[5]); 
+  z10 = VMACHI(z10, a[0], a[9]); z10 = VMACHI(z10, a[1], a[8]); z10 = VMACHI(z10, a[2], a[7]); 
+  y10 = VMACHI(y10, c[0], c[9]); y10 = VMACHI(y10, c[1], c[8]); y10 = VMACHI(y10, c[2], c[7]); 
+  z10 = VMACHI(z10, a[3], a[6]); z10 = VMACHI(z10, a[4], a[5]);
+  y10 = VMACHI(y10, c[3], c[6]); y10 = VMACHI(y10, c[4], c[5]);
+  z9 = VADD(z9, z9);
+  y9 = VADD(y9, y9);
+  z8 = VMACLO(z8, a[4], a[4]); z9 = VMACHI(z9, a[4], a[4]); 
+  y8 = VMACLO(y8, c[4], c[4]); y9 = VMACHI(y9, c[4], c[4]); 
+
+  // ---------------------------------------------------------------------------
+  // 2nd loop of integer squaring + Montgomery reduction
+
+  z10 = VMACLO(z10, a[1], a[9]); z10 = VMACLO(z10, a[2], a[8]); z10 = VMACLO(z10, a[3], a[7]); 
+  y10 = VMACLO(y10, c[1], c[9]); y10 = VMACLO(y10, c[2], c[8]); y10 = VMACLO(y10, c[3], c[7]); 
+  z10 = VMACLO(z10, a[4], a[6]); 
+  y10 = VMACLO(y10, c[4], c[6]); 
+  z11 = VMACHI(z11, a[1], a[9]); z11 = VMACHI(z11, a[2], a[8]); z11 = VMACHI(z11, a[3], a[7]); 
+  y11 = VMACHI(y11, c[1], c[9]); y11 = VMACHI(y11, c[2], c[8]); y11 = VMACHI(y11, c[3], c[7]); 
+  z11 = VMACHI(z11, a[4], a[6]);
+  y11 = VMACHI(y11, c[4], c[6]);
+  z10 = VADD(z10, z10);
+  y10 = VADD(y10, y10);
+
+  u = VMACLO(zero, z0, vw); 
+  v = VMACLO(zero, y0, vw); 
+  z0 = VMACLO(z0, u, vp0); z1  = VMACHI(z1,  u, vp0); 
+  y0 = VMACLO(y0, v, vp0); y1  = VMACHI(y1,  v, vp0); 
+  z1 = VMACLO(z1, u, vp1); z2  = VMACHI(z2,  u, vp1); 
+  y1 = VMACLO(y1, v, vp1); y2  = VMACHI(y2,  v, vp1); 
+  z2 = VMACLO(z2, u, vp2); z3  = VMACHI(z3,  u, vp2); 
+  y2 = VMACLO(y2, v, vp2); y3  = VMACHI(y3,  v, vp2); 
+  z3 = VMACLO(z3, u, vp3); z4  = VMACHI(z4,  u, vp3); 
+  y3 = VMACLO(y3, v, vp3); y4  = VMACHI(y4,  v, vp3); 
+  z4 = VMACLO(z4, u, vp4); z5  = VMACHI(z5,  u, vp4); 
+  y4 = VMACLO(y4, v, vp4); y5  = VMACHI(y5,  v, vp4); 
+  z5 = VMACLO(z5, u, vp5); z6  = VMACHI(z6,  u, vp5); 
+  y5 = VMACLO(y5, v, vp5); y6  = VMACHI(y6,  v, vp5); 
+  z6 = VMACLO(z6, u, vp6); z7  = VMACHI(z7,  u, vp6); 
+  y6 = VMACLO(y6, v, vp6); y7  = VMACHI(y7,  v, vp6); 
+  z7 = VMACLO(z7, u, vp7); z8  = VMACHI(z8,  u, vp7); 
+  y7 = VMACLO(y7, v, vp7); y8  = VMACHI(y8,  v, vp7); 
+  z8 = VMACLO(z8, u, vp8); z9  = VMACHI(z9,  u, vp8); 
+  y8 = VMACLO(y8, v, vp8); y9  = VMACHI(y9,  v, vp8); 
+  z9 = VMACLO(z9, u, vp9); z10 = VMACHI(z10, u, vp9); 
+  y9 = VMACLO(y9, v, vp9); y10 = VMACHI(y10, v, vp9); 
+  z1 = VADD(z1, VSHR(z0, HT_BRADIX));
+  y1 = VADD(y1, VSHR(y0, HT_BRADIX));
+
+  z11 = VMACLO(z11, a[2], a[9]); z11 = VMACLO(z11, a[3], a[8]); z11 = VMACLO(z11, a[4], a[7]); 
+  y11 = VMACLO(y11, c[2], c[9]); y11 = VMACLO(y11, c[3], c[8]); y11 = VMACLO(y11, c[4], c[7]); 
+  z11 = VMACLO(z11, a[5], a[6]); 
+  y11 = VMACLO(y11, c[5], c[6]); 
+  z12 = VMACHI(z12, a[2], a[9]); z12 = VMACHI(z12, a[3], a[8]); z12 = VMACHI(z12, a[4], a[7]); 
+  y12 = VMACHI(y12, c[2], c[9]); y12 = VMACHI(y12, c[3], c[8]); y12 = VMACHI(y12, c[4], c[7]); 
+  z12 = VMACHI(z12, a[5], a[6]);
+  y12 = VMACHI(y12, c[5], c[6]);
+  z11 = VADD(z11, z11);
+  y11 = VADD(y11, y11);
+  z10 = VMACLO(z10, a[5], a[5]); z11 = VMACHI(z11, a[5], a[5]); 
+  y10 = VMACLO(y10, c[5], c[5]); y11 = VMACHI(y11, c[5], c[5]); 
+
+  u = VMACLO(zero, z1, vw); 
+  v = VMACLO(zero, y1, vw); 
+  z1  = VMACLO(z1,  u, vp0); z2  = VMACHI(z2,  u, vp0); 
+  y1  = VMACLO(y1,  v, vp0); y2  = VMACHI(y2,  v, vp0); 
+  z2  = VMACLO(z2,  u, vp1); z3  = VMACHI(z3,  u, vp1); 
+  y2  = VMACLO(y2,  v, vp1); y3  = VMACHI(y3,  v, vp1); 
+  z3  = VMACLO(z3,  u, vp2); z4  = VMACHI(z4,  u, vp2); 
+  y3  = VMACLO(y3,  v, vp2); y4  = VMACHI(y4,  v, vp2); 
+  z4  = VMACLO(z4,  u, vp3); z5  = VMACHI(z5,  u, vp3); 
+  y4  = VMACLO(y4,  v, vp3); y5  = VMACHI(y5,  v, vp3); 
+  z5  = VMACLO(z5,  u, vp4); z6  = VMACHI(z6,  u, vp4); 
+  y5  = VMACLO(y5,  v, vp4); y6  = VMACHI(y6,  v, vp4); 
+  z6  = VMACLO(z6,  u, vp5); z7  = VMACHI(z7,  u, vp5); 
+  y6  = VMACLO(y6,  v, vp5); y7  = VMACHI(y7,  v, vp5); 
+  z7  = VMACLO(z7,  u, vp6); z8  = VMACHI(z8,  u, vp6); 
+  y7  = VMACLO(y7,  v, vp6); y8  = VMACHI(y8,  v, vp6); 
+  z8  = VMACLO(z8,  u, vp7); z9  = VMACHI(z9,  u, vp7); 
+  y8  = VMACLO(y8,  v, vp7); y9  = VMACHI(y9,  v, vp7); 
+  z9  = VMACLO(z9,  u, vp8); z10 = VMACHI(z10, u, vp8); 
+  y9  = VMACLO(y9,  v, vp8); y10 = VMACHI(y10, v, vp8); 
+  z10 = VMACLO(z10, u, vp9); z11 = VMACHI(z11, u, vp9); 
+  y10 = VMACLO(y10, v, vp9); y11 = VMACHI(y11, v, vp9); 
+  z2 = VADD(z2, VSHR(z1, HT_BRADIX));  
+  y2 = VADD(y2, VSHR(y1, HT_BRADIX));  
+
+  z12 = VMACLO(z12, a[3], a[9]); z12 = VMACLO(z12, a[4], a[8]); z12 = VMACLO(z12, a[5], a[7]); 
+  y12 = VMACLO(y12, c[3], c[9]); y12 = VMACLO(y12, c[4], c[8]); y12 = VMACLO(y12, c[5], c[7]); 
+  z13 = VMACHI(z13, a[3], a[9]); z13 = VMACHI(z13, a[4], a[8]); z13 = VMACHI(z13, a[5], a[7]); 
+  y13 = VMACHI(y13, c[3], c[9]); y13 = VMACHI(y13, c[4], c[8]); y13 = VMACHI(y13, c[5], c[7]); 
+  z12 = VADD(z12, z12);
+  y12 = VADD(y12, y12);
+
+  u = VMACLO(zero, z2, vw); 
+  v = VMACLO(zero, y2, vw); 
+  z2  = VMACLO(z2,  u, vp0); z3  = VMACHI(z3,  u, vp0); 
+  y2  = VMACLO(y2,  v, vp0); y3  = VMACHI(y3,  v, vp0); 
+  z3  = VMACLO(z3,  u, vp1); z4  = VMACHI(z4,  u, vp1); 
+  y3  = VMACLO(y3,  v, vp1); y4  = VMACHI(y4,  v, vp1); 
+  z4  = VMACLO(z4,  u, vp2); z5  = VMACHI(z5,  u, vp2); 
+  y4  = VMACLO(y4,  v, vp2); y5  = VMACHI(y5,  v, vp2); 
+  z5  = VMACLO(z5,  u, vp3); z6  = VMACHI(z6,  u, vp3); 
+  y5  = VMACLO(y5,  v, vp3); y6  = VMACHI(y6,  v, vp3); 
+  z6  = VMACLO(z6,  u, vp4); z7  = VMACHI(z7,  u, vp4); 
+  y6  = VMACLO(y6,  v, vp4); y7  = VMACHI(y7,  v, vp4); 
+  z7  = VMACLO(z7,  u, vp5); z8  = VMACHI(z8,  u, vp5); 
+  y7  = VMACLO(y7,  v, vp5); y8  = VMACHI(y8,  v, vp5); 
+  z8  = VMACLO(z8,  u, vp6); z9  = VMACHI(z9,  u, vp6); 
+  y8  = VMACLO(y8,  v, vp6); y9  = VMACHI(y9,  v, vp6); 
+  z9  = VMACLO(z9,  u, vp7); z10 = VMACHI(z10, u, vp7); 
+  y9  = VMACLO(y9,  v, vp7); y10 = VMACHI(y10, v, vp7); 
+  z10 = VMACLO(z10, u, vp8); z11 = VMACHI(z11, u, vp8); 
+  y10 = VMACLO(y10, v, vp8); y11 = VMACHI(y11, v, vp8); 
+  z11 = VMACLO(z11, u, vp9); z12 = VMACHI(z12, u, vp9); 
+  y11 = VMACLO(y11, v, vp9); y12 = VMACHI(y12, v, vp9); 
+  z3 = VADD(z3, VSHR(z2, HT_BRADIX));
+  y3 = VADD(y3, VSHR(y2, HT_BRADIX));
+
+  z13 = VMACLO(z13, a[4], a[9]); z13 = VMACLO(z13, a[5], a[8]); z13 = VMACLO(z13, a[6], a[7]); 
+  y13 = VMACLO(y13, c[4], c[9]); y13 = VMACLO(y13, c[5], c[8]); y13 = VMACLO(y13, c[6], c[7]); 
+  z14 = VMACHI(z14, a[4], a[9]); z14 = VMACHI(z14, a[5], a[8]); z14 = VMACHI(z14, a[6], a[7]); 
+  y14 = VMACHI(y14, c[4], c[9]); y14 = VMACHI(y14, c[5], c[8]); y14 = VMACHI(y14, c[6], c[7]); 
+  z13 = VADD(z13, z13);
+  y13 = VADD(y13, y13);
+  z12 = VMACLO(z12, a[6], a[6]); z13 = VMACHI(z13, a[6], a[6]); 
+  y12 = VMACLO(y12, c[6], c[6]); y13 = VMACHI(y13, c[6], c[6]); 
+
+  u = VMACLO(zero, z3, vw); 
+  v = VMACLO(zero, y3, vw); 
+  z3  = VMACLO(z3,  u, vp0); z4  = VMACHI(z4,  u, vp0); 
+  y3  = VMACLO(y3,  v, vp0); y4  = VMACHI(y4,  v, vp0); 
+  z4  = VMACLO(z4,  u, vp1); z5  = VMACHI(z5,  u, vp1); 
+  y4  = VMACLO(y4,  v, vp1); y5  = VMACHI(y5,  v, vp1); 
+  z5  = VMACLO(z5,  u, vp2); z6  = VMACHI(z6,  u, vp2); 
+  y5  = VMACLO(y5,  v, vp2); y6  = VMACHI(y6,  v, vp2); 
+  z6  = VMACLO(z6,  u, vp3); z7  = VMACHI(z7,  u, vp3); 
+  y6  = VMACLO(y6,  v, vp3); y7  = VMACHI(y7,  v, vp3); 
+  z7  = VMACLO(z7,  u, vp4); z8  = VMACHI(z8,  u, vp4); 
+  y7  = VMACLO(y7,  v, vp4); y8  = VMACHI(y8,  v, vp4); 
+  z8  = VMACLO(z8,  u, vp5); z9  = VMACHI(z9,  u, vp5); 
+  y8  = VMACLO(y8,  v, vp5); y9  = VMACHI(y9,  v, vp5); 
+  z9  = VMACLO(z9,  u, vp6); z10 = VMACHI(z10, u, vp6); 
+  y9  = VMACLO(y9,  v, vp6); y10 = VMACHI(y10, v, vp6); 
+  z10 = VMACLO(z10, u, vp7); z11 = VMACHI(z11, u, vp7); 
+  y10 = VMACLO(y10, v, vp7); y11 = VMACHI(y11, v, vp7); 
+  z11 = VMACLO(z11, u, vp8); z12 = VMACHI(z12, u, vp8); 
+  y11 = VMACLO(y11, v, vp8); y12 = VMACHI(y12, v, vp8); 
+  z12 = VMACLO(z12, u, vp9); z13 = VMACHI(z13, u, vp9); 
+  y12 = VMACLO(y12, v, vp9); y13 = VMACHI(y13, v, vp9); 
+  z4 = VADD(z4, VSHR(z3, HT_BRADIX));
+  y4 = VADD(y4, VSHR(y3, HT_BRADIX));
+
+  z14 = VMACLO(z14, a[5], a[9]); z14 = VMACLO(z14, a[6], a[8]); 
+  y14 = VMACLO(y14, c[5], c[9]); y14 = VMACLO(y14, c[6], c[8]); 
+  z15 = VMACHI(z15, a[5], a[9]); z15 = VMACHI(z15, a[6], a[8]); 
+  y15 = VMACHI(y15, c[5], c[9]); y15 = VMACHI(y15, c[6], c[8]); 
+  z14 = VADD(z14, z14);
+  y14 = VADD(y14, y14);
+
+  u = VMACLO(zero, z4, vw); 
+  v = VMACLO(zero, y4, vw); 
+  z4  = VMACLO(z4,  u, vp0); z5  = VMACHI(z5,  u, vp0); 
+  y4  = VMACLO(y4,  v, vp0); y5  = VMACHI(y5,  v, vp0); 
+  z5  = VMACLO(z5,  u, vp1); z6  = VMACHI(z6,  u, vp1); 
+  y5  = VMACLO(y5,  v, vp1); y6  = VMACHI(y6,  v, vp1); 
+  z6  = VMACLO(z6,  u, vp2); z7  = VMACHI(z7,  u, vp2); 
+  y6  = VMACLO(y6,  v, vp2); y7  = VMACHI(y7,  v, vp2); 
+  z7  = VMACLO(z7,  u, vp3); z8  = VMACHI(z8,  u, vp3); 
+  y7  = VMACLO(y7,  v, vp3); y8  = VMACHI(y8,  v, vp3); 
+  z8  = VMACLO(z8,  u, vp4); z9  = VMACHI(z9,  u, vp4); 
+  y8  = VMACLO(y8,  v, vp4); y9  = VMACHI(y9,  v, vp4); 
+  z9  = VMACLO(z9,  u, vp5); z10 = VMACHI(z10, u, vp5); 
+  y9  = VMACLO(y9,  v, vp5); y10 = VMACHI(y10, v, vp5); 
+  z10 = VMACLO(z10, u, vp6); z11 = VMACHI(z11, u, vp6); 
+  y10 = VMACLO(y10, v, vp6); y11 = VMACHI(y11, v, vp6); 
+  z11 = VMACLO(z11, u, vp7); z12 = VMACHI(z12, u, vp7); 
+  y11 = VMACLO(y11, v, vp7); y12 = VMACHI(y12, v, vp7); 
+  z12 = VMACLO(z12, u, vp8); z13 = VMACHI(z13, u, vp8); 
+  y12 = VMACLO(y12, v, vp8); y13 = VMACHI(y13, v, vp8); 
+  z13 = VMACLO(z13, u, vp9); z14 = VMACHI(z14, u, vp9); 
+  y13 = VMACLO(y13, v, vp9); y14 = VMACHI(y14, v, vp9); 
+  z5 = VADD(z5, VSHR(z4, HT_BRADIX));
+  y5 = VADD(y5, VSHR(y4, HT_BRADIX));
+
+  z15 = VMACLO(z15, a[6], a[9]); z15 = VMACLO(z15, a[7], a[8]); 
+  y15 = VMACLO(y15, c[6], c[9]); y15 = VMACLO(y15, c[7], c[8]); 
+  z16 = VMACHI(z16, a[6], a[9]); z16 = VMACHI(z16, a[7], a[8]);
+  y16 = VMACHI(y16, c[6], c[9]); y16 = VMACHI(y16, c[7], c[8]);
+  z15 = VADD(z15, z15);
+  y15 = VADD(y15, y15);
+  z14 = VMACLO(z14, a[7], a[7]); z15 = VMACHI(z15, a[7], a[7]);
+  y14 = VMACLO(y14, c[7], c[7]); y15 = VMACHI(y15, c[7], c[7]);
+
+  u = VMACLO(zero, z5, vw); 
+  v = VMACLO(zero, y5, vw); 
+  z5  = VMACLO(z5,  u, vp0); z6  = VMACHI(z6,  u, vp0); 
+  y5  = VMACLO(y5,  v, vp0); y6  = VMACHI(y6,  v, vp0); 
+  z6  = VMACLO(z6,  u, vp1); z7  = VMACHI(z7,  u, vp1); 
+  y6  = VMACLO(y6,  v, vp1); y7  = VMACHI(y7,  v, vp1); 
+  z7  = VMACLO(z7,  u, vp2); z8  = VMACHI(z8,  u, vp2); 
+  y7  = VMACLO(y7,  v, vp2); y8  = VMACHI(y8,  v, vp2); 
+  z8  = VMACLO(z8,  u, vp3); z9  = VMACHI(z9,  u, vp3); 
+  y8  = VMACLO(y8,  v, vp3); y9  = VMACHI(y9,  v, vp3); 
+  z9  = VMACLO(z9,  u, vp4); z10 = VMACHI(z10, u, vp4); 
+  y9  = VMACLO(y9,  v, vp4); y10 = VMACHI(y10, v, vp4); 
+  z10 = VMACLO(z10, u, vp5); z11 = VMACHI(z11, u, vp5); 
+  y10 = VMACLO(y10, v, vp5); y11 = VMACHI(y11, v, vp5); 
+  z11 = VMACLO(z11, u, vp6); z12 = VMACHI(z12, u, vp6); 
+  y11 = VMACLO(y11, v, vp6); y12 = VMACHI(y12, v, vp6); 
+  z12 = VMACLO(z12, u, vp7); z13 = VMACHI(z13, u, vp7); 
+  y12 = VMACLO(y12, v, vp7); y13 = VMACHI(y13, v, vp7); 
+  z13 = VMACLO(z13, u, vp8); z14 = VMACHI(z14, u, vp8); 
+  y13 = VMACLO(y13, v, vp8); y14 = VMACHI(y14, v, vp8); 
+  z14 = VMACLO(z14, u, vp9); z15 = VMACHI(z15, u, vp9); 
+  y14 = VMACLO(y14, v, vp9); y15 = VMACHI(y15, v, vp9); 
+  z6 = VADD(z6, VSHR(z5, HT_BRADIX));
+  y6 = VADD(y6, VSHR(y5, HT_BRADIX));
+
+  z16 = VMACLO(z16, a[7], a[9]);  
+  y16 = VMACLO(y16, c[7], c[9]);  
+  z17 = VMACHI(z17, a[7], a[9]); 
+  y17 = VMACHI(y17, c[7], c[9]); 
+  z16 = VADD(z16, z16);
+  y16 = VADD(y16, y16);
+
+  u = VMACLO(zero, z6, vw); 
+  v = VMACLO(zero, y6, vw); 
+  z6  = VMACLO(z6,  u, vp0); z7  = VMACHI(z7,  u, vp0); 
+  y6  = VMACLO(y6,  v, vp0); y7  = VMACHI(y7,  v, vp0); 
+  z7  = VMACLO(z7,  u, vp1); z8  = VMACHI(z8,  u, vp1); 
+  y7  = VMACLO(y7,  v, vp1); y8  = VMACHI(y8,  v, vp1); 
+  z8  = VMACLO(z8,  u, vp2); z9  = VMACHI(z9,  u, vp2); 
+  y8  = VMACLO(y8,  v, vp2); y9  = VMACHI(y9,  v, vp2); 
+  z9  = VMACLO(z9,  u, vp3); z10 = VMACHI(z10, u, vp3); 
+  y9  = VMACLO(y9,  v, vp3); y10 = VMACHI(y10, v, vp3); 
+  z10 = VMACLO(z10, u, vp4); z11 = VMACHI(z11, u, vp4); 
+  y10 = VMACLO(y10, v, vp4); y11 = VMACHI(y11, v, vp4); 
+  z11 = VMACLO(z11, u, vp5); z12 = VMACHI(z12, u, vp5); 
+  y11 = VMACLO(y11, v, vp5); y12 = VMACHI(y12, v, vp5); 
+  z12 = VMACLO(z12, u, vp6); z13 = VMACHI(z13, u, vp6); 
+  y12 = VMACLO(y12, v, vp6); y13 = VMACHI(y13, v, vp6); 
+  z13 = VMACLO(z13, u, vp7); z14 = VMACHI(z14, u, vp7); 
+  y13 = VMACLO(y13, v, vp7); y14 = VMACHI(y14, v, vp7); 
+  z14 = VMACLO(z14, u, vp8); z15 = VMACHI(z15, u, vp8); 
+  y14 = VMACLO(y14, v, vp8); y15 = VMACHI(y15, v, vp8); 
+  z15 = VMACLO(z15, u, vp9); z16 = VMACHI(z16, u, vp9); 
+  y15 = VMACLO(y15, v, vp9); y16 = VMACHI(y16, v, vp9); 
+  z7 = VADD(z7, VSHR(z6, HT_BRADIX)); 
+  y7 = VADD(y7, VSHR(y6, HT_BRADIX)); 
+
+  z17 = VMACLO(z17, a[8], a[9]); 
+  y17 = VMACLO(y17, c[8], c[9]); 
+  z18 = VMACHI(z18, a[8], a[9]);
+  y18 = VMACHI(y18, c[8], c[9]);
+  z17 = VADD(z17, z17);
+  y17 = VADD(y17, y17);
+  z16 = VMACLO(z16, a[8], a[8]); z17 = VMACHI(z17, a[8], a[8]); 
+  y16 = VMACLO(y16, c[8], c[8]); y17 = VMACHI(y17, c[8], c[8]); 
+
+  u = VMACLO(zero, z7, vw); 
+  v = VMACLO(zero, y7, vw); 
+  z7  = VMACLO(z7,  u, vp0); z8  = VMACHI(z8,  u, vp0); 
+  y7  = VMACLO(y7,  v, vp0); y8  = VMACHI(y8,  v, vp0); 
+  z8  = VMACLO(z8,  u, vp1); z9  = VMACHI(z9,  u, vp1); 
+  y8  = VMACLO(y8,  v, vp1); y9  = VMACHI(y9,  v, vp1); 
+  z9  = VMACLO(z9,  u, vp2); z10 = VMACHI(z10, u, vp2); 
+  y9  = VMACLO(y9,  v, vp2); y10 = VMACHI(y10, v, vp2); 
+  z10 = VMACLO(z10, u, vp3); z11 = VMACHI(z11, u, vp3); 
+  y10 = VMACLO(y10, v, vp3); y11 = VMACHI(y11, v, vp3); 
+  z11 = VMACLO(z11, u, vp4); z12 = VMACHI(z12, u, vp4); 
+  y11 = VMACLO(y11, v, vp4); y12 = VMACHI(y12, v, vp4); 
+  z12 = VMACLO(z12, u, vp5); z13 = VMACHI(z13, u, vp5); 
+  y12 = VMACLO(y12, v, vp5); y13 = VMACHI(y13, v, vp5); 
+  z13 = VMACLO(z13, u, vp6); z14 = VMACHI(z14, u, vp6); 
+  y13 = VMACLO(y13, v, vp6); y14 = VMACHI(y14, v, vp6); 
+  z14 = VMACLO(z14, u, vp7); z15 = VMACHI(z15, u, vp7); 
+  y14 = VMACLO(y14, v, vp7); y15 = VMACHI(y15, v, vp7); 
+  z15 = VMACLO(z15, u, vp8); z16 = VMACHI(z16, u, vp8); 
+  y15 = VMACLO(y15, v, vp8); y16 = VMACHI(y16, v, vp8); 
+  z16 = VMACLO(z16, u, vp9); z17 = VMACHI(z17, u, vp9); 
+  y16 = VMACLO(y16, v, vp9); y17 = VMACHI(y17, v, vp9); 
+  z8 = VADD(z8, VSHR(z7, HT_BRADIX)); 
+  y8 = VADD(y8, VSHR(y7, HT_BRADIX)); 
+
+  z18 = VADD(z18, z18);
+  y18 = VADD(y18, y18);
+
+  u = VMACLO(zero, z8, vw); 
+  v = VMACLO(zero, y8, vw); 
+  z8  = VMACLO(z8,  u, vp0); z9  = VMACHI(z9,  u, vp0); 
+  y8  = VMACLO(y8,  v, vp0); y9  = VMACHI(y9,  v, vp0); 
+  z9  = VMACLO(z9,  u, vp1); z10 = VMACHI(z10, u, vp1); 
+  y9  = VMACLO(y9,  v, vp1); y10 = VMACHI(y10, v, vp1); 
+  z10 = VMACLO(z10, u, vp2); z11 = VMACHI(z11, u, vp2); 
+  y10 = VMACLO(y10, v, vp2); y11 = VMACHI(y11, v, vp2); 
+  z11 = VMACLO(z11, u, vp3); z12 = VMACHI(z12, u, vp3); 
+  y11 = VMACLO(y11, v, vp3); y12 = VMACHI(y12, v, vp3); 
+  z12 = VMACLO(z12, u, vp4); z13 = VMACHI(z13, u, vp4); 
+  y12 = VMACLO(y12, v, vp4); y13 = VMACHI(y13, v, vp4); 
+  z13 = VMACLO(z13, u, vp5); z14 = VMACHI(z14, u, vp5); 
+  y13 = VMACLO(y13, v, vp5); y14 = VMACHI(y14, v, vp5); 
+  z14 = VMACLO(z14, u, vp6); z15 = VMACHI(z15, u, vp6); 
+  y14 = VMACLO(y14, v, vp6); y15 = VMACHI(y15, v, vp6); 
+  z15 = VMACLO(z15, u, vp7); z16 = VMACHI(z16, u, vp7); 
+  y15 = VMACLO(y15, v, vp7); y16 = VMACHI(y16, v, vp7); 
+  z16 = VMACLO(z16, u, vp8); z17 = VMACHI(z17, u, vp8); 
+  y16 = VMACLO(y16, v, vp8); y17 = VMACHI(y17, v, vp8); 
+  z17 = VMACLO(z17, u, vp9); z18 = VMACHI(z18, u, vp9); 
+  y17 = VMACLO(y17, v, vp9); y18 = VMACHI(y18, v, vp9); 
+  z9 = VADD(z9, VSHR(z8, HT_BRADIX)); 
+  y9 = VADD(y9, VSHR(y8, HT_BRADIX)); 
+
+  z18 = VMACLO(z18, a[9], a[9]);
+  y18 = VMACLO(y18, c[9], c[9]);
+  z19 = VMACHI(z19, a[9], a[9]);
+  y19 = VMACHI(y19, c[9], c[9]);
+
+  u = VMACLO(zero, z9, vw); 
+  v = VMACLO(zero, y9, vw); 
+  z9  = VMACLO(z9,  u, vp0); z10 = VMACHI(z10, u, vp0); 
+  y9  = VMACLO(y9,  v, vp0); y10 = VMACHI(y10, v, vp0); 
+  z10 = VMACLO(z10, u, vp1); z11 = VMACHI(z11, u, vp1); 
+  y10 = VMACLO(y10, v, vp1); y11 = VMACHI(y11, v, vp1); 
+  z11 = VMACLO(z11, u, vp2); z12 = VMACHI(z12, u, vp2); 
+  y11 = VMACLO(y11, v, vp2); y12 = VMACHI(y12, v, vp2); 
+  z12 = VMACLO(z12, u, vp3); z13 = VMACHI(z13, u, vp3); 
+  y12 = VMACLO(y12, v, vp3); y13 = VMACHI(y13, v, vp3); 
+  z13 = VMACLO(z13, u, vp4); z14 = VMACHI(z14, u, vp4); 
+  y13 = VMACLO(y13, v, vp4); y14 = VMACHI(y14, v, vp4); 
+  z14 = VMACLO(z14, u, vp5); z15 = VMACHI(z15, u, vp5); 
+  y14 = VMACLO(y14, v, vp5); y15 = VMACHI(y15, v, vp5); 
+  z15 = VMACLO(z15, u, vp6); z16 = VMACHI(z16, u, vp6); 
+  y15 = VMACLO(y15, v, vp6); y16 = VMACHI(y16, v, vp6); 
+  z16 = VMACLO(z16, u, vp7); z17 = VMACHI(z17, u, vp7); 
+  y16 = VMACLO(y16, v, vp7); y17 = VMACHI(y17, v, vp7); 
+  z17 = VMACLO(z17, u, vp8); z18 = VMACHI(z18, u, vp8); 
+  y17 = VMACLO(y17, v, vp8); y18 = VMACHI(y18, v, vp8); 
+  z18 = VMACLO(z18, u, vp9); z19 = VMACHI(z19, u, vp9);
+  y18 = VMACLO(y18, v, vp9); y19 = VMACHI(y19, v, vp9);
+  z10 = VADD(z10, VSHR(z9, HT_BRADIX));
+  y10 = VADD(y10, VSHR(y9, HT_BRADIX));
+
+  z11 = VADD(z11, VSHR(z10, HT_BRADIX)); z10 = VAND(z10, vbmask);
+  y11 = VADD(y11, VSHR(y10, HT_BRADIX)); y10 = VAND(y10, vbmask);
+  z12 = VADD(z12, VSHR(z11, HT_BRADIX)); z11 = VAND(z11, vbmask);
+  y12 = VADD(y12, VSHR(y11, HT_BRADIX)); y11 = VAND(y11, vbmask);
+  z13 = VADD(z13, VSHR(z12, HT_BRADIX)); z12 = VAND(z12, vbmask);
+  y13 = VADD(y13, VSHR(y12, HT_BRADIX)); y12 = VAND(y12, vbmask);
+  z14 = VADD(z14, VSHR(z13, HT_BRADIX)); z13 = VAND(z13, vbmask);
+  y14 = VADD(y14, VSHR(y13, HT_BRADIX)); y13 = VAND(y13, vbmask);
+  z15 = VADD(z15, VSHR(z14, HT_BRADIX)); z14 = VAND(z14, vbmask);
+  y15 = VADD(y15, VSHR(y14, HT_BRADIX)); y14 = VAND(y14, vbmask);
+  z16 = VADD(z16, VSHR(z15, HT_BRADIX)); z15 = VAND(z15, vbmask);
+  y16 = VADD(y16, VSHR(y15, HT_BRADIX)); y15 = VAND(y15, vbmask);
+  z17 = VADD(z17, VSHR(z16, HT_BRADIX)); z16 = VAND(z16, vbmask);
+  y17 = VADD(y17, VSHR(y16, HT_BRADIX)); y16 = VAND(y16, vbmask);
+  z18 = VADD(z18, VSHR(z17, HT_BRADIX)); z17 = VAND(z17, vbmask);
+  y18 = VADD(y18, VSHR(y17, HT_BRADIX)); y17 = VAND(y17, vbmask);
+  z19 = VADD(z19, VSHR(z18, HT_BRADIX)); z18 = VAND(z18, vbmask);
+  y19 = VADD(y19, VSHR(y18, HT_BRADIX)); y18 = VAND(y18, vbmask);
+
+  // ---------------------------------------------------------------------------
+
+  r[0] = z10; r[1] = z11; r[2] = z12; r[3] = z13; r[4] = z14; 
+  s[0] = y10; s[1] = y11; s[2] = y12; s[3] = y13; s[4] = y14; 
+  r[5] = z15; r[6] = z16; r[7] = z17; r[8] = z18; r[9] = z19; 
+  s[5] = y15; s[6] = y16; s[7] = y17; s[8] = y18; s[9] = y19; 
+}
+
+#else
+
+// MUL=KARATSUBA: the (8x1)-way multiplications and squarings use the Karatsuba kernels 
+
+void gfp_mul_8x1w(htfe_t r, const htfe_t a, const htfe_t b)
+{
+  gfp_mulka_8x1w(r, a, b);
+}
+
+void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
+{
+  gfp_sqrka_8x1w(r, a);
+}
+
+void gfp_mul2_8x1w(htfe_t r, const htfe_t a, const htfe_t b, htfe_t s, const htfe_t c, const htfe_t d)
+{
+  gfp_mulka_8x1w(r, a, b);
+  gfp_mulka_8x1w(s, c, d);
+}
+
+void gfp_sqr2_8x1w(htfe_t r, const htfe_t a, htfe_t s, const htfe_t c)
+{
+  gfp_sqrka_8x1w(r, a);
+  gfp_sqrka_8x1w(s, c);
+}
+
+#endif
+
+// Montgomery multiplication r = a * b mod 2p
+// one-level Karatsuba (5+5 limbs) multiplication followed by reduction (operand-scanning)
+// a = aL + aH * 2^260, b = bL + bH * 2^260, a * b = L + (M - L - H) * 2^260 + H * 2^520
+// with L = aL * bL, H = aH * bH, M = (aL + aH) * (bL + bH)
+// -> r in [0, 2p)
+void gfp_mulka_8x1w(htfe_t r, const htfe_t a, const htfe_t b)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9]; 
+  __m512i b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4];
+  __m512i b5 = b[5], b6 = b[6], b7 = b[7], b8 = b[8], b9 = b[9]; 
+  __m512i l0 = VZERO, l1 = VZERO, l2 = VZERO, l3 = VZERO, l4 = VZERO;
+  __m512i l5 = VZERO, l6 = VZERO, l7 = VZERO, l8 = VZERO, l9 = VZERO;
+  __m512i h0 = VZERO, h1 = VZERO, h2 = VZERO, h3 = VZERO, h4 = VZERO;
+  __m512i h5 = VZERO, h6 = VZERO, h7 = VZERO, h8 = VZERO, h9 = VZERO;
+  __m512i m0 = VZERO, m1 = VZERO, m2 = VZERO, m3 = VZERO, m4 = VZERO;
+  __m512i m5 = VZERO, m6 = VZERO, m7 = VZERO, m8 = VZERO, m9 = VZERO, m10;
+  __m512i sa0, sa1, sa2, sa3, sa4, sb0, sb1, sb2, sb3, sb4, ca, cb;
+  __m512i  z0,  z1,  z2,  z3,  z4,  z5,  z6,  z7,  z8,  z9;
+  __m512i z10, z11, z12, z13, z14, z15, z16, z17, z18, z19, u;
+  __mmask8 mca, mcb;
+  const __m512i vp0 = VSET1(ht_p[0]), vp1 = VSET1(ht_p[1]);
+  const __m512i vp2 = VSET1(ht_p[2]), vp3 = VSET1(ht_p[3]);
+  const __m512i vp4 = VSET1(ht_p[4]), vp5 = VSET1(ht_p[5]);
+  const __m512i vp6 = VSET1(ht_p[6]), vp7 = VSET1(ht_p[7]);
+  const __m512i vp8 = VSET1(ht_p[8]), vp9 = VSET1(ht_p[9]);
+  const __m512i vbmask = VSET1(HT_BMASK), vw = VSET1(HT_MONTW), zero = VZERO;
+
+  // vpmadd52 only reads the low 52 bits of a limb, but the sums below carry the 
+  // full 64 bits: drop the bits above 2^52 first, so that the result is the same
+  // as that of the schoolbook multiplication for every input  
+  a0 = VAND(a0, vbmask); a1 = VAND(a1, vbmask); a2 = VAND(a2, vbmask);
+  a3 = VAND(a3, vbmask); a4 = VAND(a4, vbmask); a5 = VAND(a5, vbmask);
+  a6 = VAND(a6, vbmask); a7 = VAND(a7, vbmask); a8 = VAND(a8, vbmask);
+  a9 = VAND(a9, vbmask);
+  b0 = VAND(b0, vbmask); b1 = VAND(b1, vbmask); b2 = VAND(b2, vbmask);
+  b3 = VAND(b3, vbmask); b4 = VAND(b4, vbmask); b5 = VAND(b5, vbmask);
+  b6 = VAND(b6, vbmask); b7 = VAND(b7, vbmask); b8 = VAND(b8, vbmask);
+  b9 = VAND(b9, vbmask);
+
+  // sa = aL + aH, sb = bL + bH in 5 radix-52 limbs plus a carry bit ca, cb
+  sa0 = VADD(a0, a5); sa1 = VADD(a1, a6); sa2 = VADD(a2, a7);
+  sa3 = VADD(a3, a8); sa4 = VADD(a4, a9);
+  sa1 = VADD(sa1, VSHR(sa0, HT_BRADIX)); sa0 = VAND(sa0, vbmask);
+  sa2 = VADD(sa2, VSHR(sa1, HT_BRADIX)); sa1 = VAND(sa1, vbmask);
+  sa3 = VADD(sa3, VSHR(sa2, HT_BRADIX)); sa2 = VAND(sa2, vbmask);
+  sa4 = VADD(sa4, VSHR(sa3, HT_BRADIX)); sa3 = VAND(sa3, vbmask);
+  ca = VSHR(sa4, HT_BRADIX); sa4 = VAND(sa4, vbmask);
+  sb0 = VADD(b0, b5); sb1 = VADD(b1, b6); sb2 = VADD(b2, b7);
+  sb3 = VADD(b3, b8); sb4 = VADD(b4, b9);
+  sb1 = VADD(sb1, VSHR(sb0, HT_BRADIX)); sb0 = VAND(sb0, vbmask);
+  sb2 = VADD(sb2, VSHR(sb1, HT_BRADIX)); sb1 = VAND(sb1, vbmask);
+  sb3 = VADD(sb3, VSHR(sb2, HT_BRADIX)); sb2 = VAND(sb2, vbmask);
+  sb4 = VADD(sb4, VSHR(sb3, HT_BRADIX)); sb3 = VAND(sb3, vbmask);
+  cb = VSHR(sb4, HT_BRADIX); sb4 = VAND(sb4, vbmask);
+
+  // L = aL * bL
+  l0 = VMACLO(l0, a0, b0);
+  l1 = VMACHI(l1, a0, b0);
+  l1 = VMACLO(l1, a0, b1); l1 = VMACLO(l1, a1, b0);
+  l2 = VMACHI(l2, a0, b1); l2 = VMACHI(l2, a1, b0);
+  l2 = VMACLO(l2, a0, b2); l2 = VMACLO(l2, a1, b1); l2 = VMACLO(l2, a2, b0);
+  l3 = VMACHI(l3, a0, b2); l3 = VMACHI(l3, a1, b1); l3 = VMACHI(l3, a2, b0);
+  l3 = VMACLO(l3, a0, b3); l3 = VMACLO(l3, a1, b2); l3 = VMACLO(l3, a2, b1);
+  l3 = VMACLO(l3, a3, b0);
+  l4 = VMACHI(l4, a0, b3); l4 = VMACHI(l4, a1, b2); l4 = VMACHI(l4, a2, b1);
+  l4 = VMACHI(l4, a3, b0);
+  l4 = VMACLO(l4, a0, b4); l4 = VMACLO(l4, a1, b3); l4 = VMACLO(l4, a2, b2);
+  l4 = VMACLO(l4, a3, b1); l4 = VMACLO(l4, a4, b0);
+  l5 = VMACHI(l5, a0, b4); l5 = VMACHI(l5, a1, b3); l5 = VMACHI(l5, a2, b2);
+  l5 = VMACHI(l5, a3, b1); l5 = VMACHI(l5, a4, b0);
+  l5 = VMACLO(l5, a1, b4); l5 = VMACLO(l5, a2, b3); l5 = VMACLO(l5, a3, b2);
+  l5 = VMACLO(l5, a4, b1);
+  l6 = VMACHI(l6, a1, b4); l6 = VMACHI(l6, a2, b3); l6 = VMACHI(l6, a3, b2);
+  l6 = VMACHI(l6, a4, b1);
+  l6 = VMACLO(l6, a2, b4); l6 = VMACLO(l6, a3, b3); l6 = VMACLO(l6, a4, b2);
+  l7 = VMACHI(l7, a2, b4); l7 = VMACHI(l7, a3, b3); l7 = VMACHI(l7, a4, b2);
+  l7 = VMACLO(l7, a3, b4); l7 = VMACLO(l7, a4, b3);
+  l8 = VMACHI(l8, a3, b4); l8 = VMACHI(l8, a4, b3);
+  l8 = VMACLO(l8, a4, b4);
+  l9 = VMACHI(l9, a4, b4);
+
+  // H = aH * bH
+  h0 = VMACLO(h0, a5, b5);
+  h1 = VMACHI(h1, a5, b5);
+  h1 = VMACLO(h1, a5, b6); h1 = VMACLO(h1, a6, b5);
+  h2 = VMACHI(h2, a5, b6); h2 = VMACHI(h2, a6, b5);
+  h2 = VMACLO(h2, a5, b7); h2 = VMACLO(h2, a6, b6); h2 = VMACLO(h2, a7, b5);
+  h3 = VMACHI(h3, a5, b7); h3 = VMACHI(h3, a6, b6); h3 = VMACHI(h3, a7, b5);
+  h3 = VMACLO(h3, a5, b8); h3 = VMACLO(h3, a6, b7); h3 = VMACLO(h3, a7, b6);
+  h3 = VMACLO(h3, a8, b5);
+  h4 = VMACHI(h4, a5, b8); h4 = VMACHI(h4, a6, b7); h4 = VMACHI(h4, a7, b6);
+  h4 = VMACHI(h4, a8, b5);
+  h4 = VMACLO(h4, a5, b9); h4 = VMACLO(h4, a6, b8); h4 = VMACLO(h4, a7, b7);
+  h4 = VMACLO(h4, a8, b6); h4 = VMACLO(h4, a9, b5);
+  h5 = VMACHI(h5, a5, b9); h5 = VMACHI(h5, a6, b8); h5 = VMACHI(h5, a7, b7);
+  h5 = VMACHI(h5, a8, b6); h5 = VMACHI(h5, a9, b5);
+  h5 = VMACLO(h5, a6, b9); h5 = VMACLO(h5, a7, b8); h5 = VMACLO(h5, a8, b7);
+  h5 = VMACLO(h5, a9, b6);
+  h6 = VMACHI(h6, a6, b9); h6 = VMACHI(h6, a7, b8); h6 = VMACHI(h6, a8, b7);
+  h6 = VMACHI(h6, a9, b6);
+  h6 = VMACLO(h6, a7, b9); h6 = VMACLO(h6, a8, b8); h6 = VMACLO(h6, a9, b7);
+  h7 = VMACHI(h7, a7, b9); h7 = VMACHI(h7, a8, b8); h7 = VMACHI(h7, a9, b7);
+  h7 = VMACLO(h7, a8, b9); h7 = VMACLO(h7, a9, b8);
+  h8 = VMACHI(h8, a8, b9); h8 = VMACHI(h8, a9, b8);
+  h8 = VMACLO(h8, a9, b9);
+  h9 = VMACHI(h9, a9, b9);
+
+  // M = sa * sb
+  m0 = VMACLO(m0, sa0, sb0);
+  m1 = VMACHI(m1, sa0, sb0);
+  m1 = VMACLO(m1, sa0, sb1); m1 = VMACLO(m1, sa1, sb0);
+  m2 = VMACHI(m2, sa0, sb1); m2 = VMACHI(m2, sa1, sb0);
+  m2 = VMACLO(m2, sa0, sb2); m2 = VMACLO(m2, sa1, sb1); m2 = VMACLO(m2, sa2, sb0);
+  m3 = VMACHI(m3, sa0, sb2); m3 = VMACHI(m3, sa1, sb1); m3 = VMACHI(m3, sa2, sb0);
+  m3 = VMACLO(m3, sa0, sb3); m3 = VMACLO(m3, sa1, sb2); m3 = VMACLO(m3, sa2, sb1);
+  m3 = VMACLO(m3, sa3, sb0);
+  m4 = VMACHI(m4, sa0, sb3); m4 = VMACHI(m4, sa1, sb2); m4 = VMACHI(m4, sa2, sb1);
+  m4 = VMACHI(m4, sa3, sb0);
+  m4 = VMACLO(m4, sa0, sb4); m4 = VMACLO(m4, sa1, sb3); m4 = VMACLO(m4, sa2, sb2);
+  m4 = VMACLO(m4, sa3, sb1); m4 = VMACLO(m4, sa4, sb0);
+  m5 = VMACHI(m5, sa0, sb4); m5 = VMACHI(m5, sa1, sb3); m5 = VMACHI(m5, sa2, sb2);
+  m5 = VMACHI(m5, sa3, sb1); m5 = VMACHI(m5, sa4, sb0);
+  m5 = VMACLO(m5, sa1, sb4); m5 = VMACLO(m5, sa2, sb3); m5 = VMACLO(m5, sa3, sb2);
+  m5 = VMACLO(m5, sa4, sb1);
+  m6 = VMACHI(m6, sa1, sb4); m6 = VMACHI(m6, sa2, sb3); m6 = VMACHI(m6, sa3, sb2);
+  m6 = VMACHI(m6, sa4, sb1);
+  m6 = VMACLO(m6, sa2, sb4); m6 = VMACLO(m6, sa3, sb3); m6 = VMACLO(m6, sa4, sb2);
+  m7 = VMACHI(m7, sa2, sb4); m7 = VMACHI(m7, sa3, sb3); m7 = VMACHI(m7, sa4, sb2);
+  m7 = VMACLO(m7, sa3, sb4); m7 = VMACLO(m7, sa4, sb3);
+  m8 = VMACHI(m8, sa3, sb4); m8 = VMACHI(m8, sa4, sb3);
+  m8 = VMACLO(m8, sa4, sb4);
+  m9 = VMACHI(m9, sa4, sb4);
+
+  // M += (ca * sb + cb * sa) * 2^260 + ca * cb * 2^520
+  mca = VTEST(ca, ca); mcb = VTEST(cb, cb);
+  m5 = VMADD(m5, mca, m5, sb0); m6 = VMADD(m6, mca, m6, sb1);
+  m7 = VMADD(m7, mca, m7, sb2); m8 = VMADD(m8, mca, m8, sb3);
+  m9 = VMADD(m9, mca, m9, sb4);
+  m5 = VMADD(m5, mcb, m5, sa0); m6 = VMADD(m6, mcb, m6, sa1);
+  m7 = VMADD(m7, mcb, m7, sa2); m8 = VMADD(m8, mcb, m8, sa3);
+  m9 = VMADD(m9, mcb, m9, sa4);
+  m10 = VAND(ca, cb);
+
+  // z = L + (M - L - H) * 2^260 + H * 2^520, the columns may be negative
+  m0 = VSUB(m0, VADD(l0, h0)); m1 = VSUB(m1, VADD(l1, h1));
+  m2 = VSUB(m2, VADD(l2, h2)); m3 = VSUB(m3, VADD(l3, h3));
+  m4 = VSUB(m4, VADD(l4, h4)); m5 = VSUB(m5, VADD(l5, h5));
+  m6 = VSUB(m6, VADD(l6, h6)); m7 = VSUB(m7, VADD(l7, h7));
+  m8 = VSUB(m8, VADD(l8, h8)); m9 = VSUB(m9, VADD(l9, h9));
+  z0 = l0; z1 = l1; z2 = l2; z3 = l3;
+  z4 = l4; z5 = VADD(l5, m0); z6 = VADD(l6, m1); z7 = VADD(l7, m2);
+  z8 = VADD(l8, m3); z9 = VADD(l9, m4); z10 = VADD(m5, h0); z11 = VADD(m6, h1);
+  z12 = VADD(m7, h2); z13 = VADD(m8, h3); z14 = VADD(m9, h4); z15 = VADD(m10, h5);
+  z16 = h6; z17 = h7; z18 = h8; z19 = h9;
+
+  // Montgomery reduction (signed carries)
+  u = VMACLO(zero, z0, vw); 
+  z0  = VMACLO(z0,  u, vp0); z1  = VMACHI(z1,  u, vp0); 
+  z1  = VMACLO(z1,  u, vp1); z2  = VMACHI(z2,  u, vp1); 
+  z2  = VMACLO(z2,  u, vp2); z3  = VMACHI(z3,  u, vp2); 
+  z3  = VMACLO(z3,  u, vp3); z4  = VMACHI(z4,  u, vp3); 
+  z4  = VMACLO(z4,  u, vp4); z5  = VMACHI(z5,  u, vp4); 
+  z5  = VMACLO(z5,  u, vp5); z6  = VMACHI(z6,  u, vp5); 
+  z6  = VMACLO(z6,  u, vp6); z7  = VMACHI(z7,  u, vp6); 
+  z7  = VMACLO(z7,  u, vp7); z8  = VMACHI(z8,  u, vp7); 
+  z8  = VMACLO(z8,  u, vp8); z9  = VMACHI(z9,  u, vp8); 
+  z9  = VMACLO(z9,  u, vp9); z10 = VMACHI(z10, u, vp9); 
+  z1 = VADD(z1, VSRA(z0, HT_BRADIX));
+
+  u = VMACLO(zero, z1, vw); 
+  z1  = VMACLO(z1,  u, vp0); z2  = VMACHI(z2,  u, vp0); 
+  z2  = VMACLO(z2,  u, vp1); z3  = VMACHI(z3,  u, vp1); 
+  z3  = VMACLO(z3,  u, vp2); z4  = VMACHI(z4,  u, vp2); 
+  z4  = VMACLO(z4,  u, vp3); z5  = VMACHI(z5,  u, vp3); 
+  z5  = VMACLO(z5,  u, vp4); z6  = VMACHI(z6,  u, vp4); 
+  z6  = VMACLO(z6,  u, vp5); z7  = VMACHI(z7,  u, vp5); 
+  z7  = VMACLO(z7,  u, vp6); z8  = VMACHI(z8,  u, vp6); 
+  z8  = VMACLO(z8,  u, vp7); z9  = VMACHI(z9,  u, vp7); 
+  z9  = VMACLO(z9,  u, vp8); z10 = VMACHI(z10, u, vp8); 
+  z10 = VMACLO(z10, u, vp9); z11 = VMACHI(z11, u, vp9); 
+  z2 = VADD(z2, VSRA(z1, HT_BRADIX));
+
+  u = VMACLO(zero, z2, vw); 
+  z2  = VMACLO(z2,  u, vp0); z3  = VMACHI(z3,  u, vp0); 
+  z3  = VMACLO(z3,  u, vp1); z4  = VMACHI(z4,  u, vp1); 
+  z4  = VMACLO(z4,  u, vp2); z5  = VMACHI(z5,  u, vp2); 
+  z5  = VMACLO(z5,  u, vp3); z6  = VMACHI(z6,  u, vp3); 
+  z6  = VMACLO(z6,  u, vp4); z7  = VMACHI(z7,  u, vp4); 
+  z7  = VMACLO(z7,  u, vp5); z8  = VMACHI(z8,  u, vp5); 
+  z8  = VMACLO(z8,  u, vp6); z9  = VMACHI(z9,  u, vp6); 
+  z9  = VMACLO(z9,  u, vp7); z10 = VMACHI(z10, u, vp7); 
+  z10 = VMACLO(z10, u, vp8); z11 = VMACHI(z11, u, vp8); 
+  z11 = VMACLO(z11, u, vp9); z12 = VMACHI(z12, u, vp9); 
+  z3 = VADD(z3, VSRA(z2, HT_BRADIX));
+
+  u = VMACLO(zero, z3, vw); 
+  z3  = VMACLO(z3,  u, vp0); z4  = VMACHI(z4,  u, vp0); 
+  z4  = VMACLO(z4,  u, vp1); z5  = VMACHI(z5,  u, vp1); 
+  z5  = VMACLO(z5,  u, vp2); z6  = VMACHI(z6,  u, vp2); 
+  z6  = VMACLO(z6,  u, vp3); z7  = VMACHI(z7,  u, vp3); 
+  z7  = VMACLO(z7,  u, vp4); z8  = VMACHI(z8,  u, vp4); 
+  z8  = VMACLO(z8,  u, vp5); z9  = VMACHI(z9,  u, vp5); 
+  z9  = VMACLO(z9,  u, vp6); z10 = VMACHI(z10, u, vp6); 
+  z10 = VMACLO(z10, u, vp7); z11 = VMACHI(z11, u, vp7); 
+  z11 = VMACLO(z11, u, vp8); z12 = VMACHI(z12, u, vp8); 
+  z12 = VMACLO(z12, u, vp9); z13 = VMACHI(z13, u, vp9); 
+  z4 = VADD(z4, VSRA(z3, HT_BRADIX));
+
+  u = VMACLO(zero, z4, vw); 
+  z4  = VMACLO(z4,  u, vp0); z5  = VMACHI(z5,  u, vp0); 
+  z5  = VMACLO(z5,  u, vp1); z6  = VMACHI(z6,  u, vp1); 
+  z6  = VMACLO(z6,  u, vp2); z7  = VMACHI(z7,  u, vp2); 
+  z7  = VMACLO(z7,  u, vp3); z8  = VMACHI(z8,  u, vp3); 
+  z8  = VMACLO(z8,  u, vp4); z9  = VMACHI(z9,  u, vp4); 
+  z9  = VMACLO(z9,  u, vp5); z10 = VMACHI(z10, u, vp5); 
+  z10 = VMACLO(z10, u, vp6); z11 = VMACHI(z11, u, vp6); 
+  z11 = VMACLO(z11, u, vp7); z12 = VMACHI(z12, u, vp7); 
+  z12 = VMACLO(z12, u, vp8); z13 = VMACHI(z13, u, vp8); 
+  z13 = VMACLO(z13, u, vp9); z14 = VMACHI(z14, u, vp9); 
+  z5 = VADD(z5, VSRA(z4, HT_BRADIX));
+
+  u = VMACLO(zero, z5, vw); 
+  z5  = VMACLO(z5,  u, vp0); z6  = VMACHI(z6,  u, vp0); 
+  z6  = VMACLO(z6,  u, vp1); z7  = VMACHI(z7,  u, vp1); 
+  z7  = VMACLO(z7,  u, vp2); z8  = VMACHI(z8,  u, vp2); 
+  z8  = VMACLO(z8,  u, vp3); z9  = VMACHI(z9,  u, vp3); 
+  z9  = VMACLO(z9,  u, vp4); z10 = VMACHI(z10, u, vp4); 
+  z10 = VMACLO(z10, u, vp5); z11 = VMACHI(z11, u, vp5); 
+  z11 = VMACLO(z11, u, vp6); z12 = VMACHI(z12, u, vp6); 
+  z12 = VMACLO(z12, u, vp7); z13 = VMACHI(z13, u, vp7); 
+  z13 = VMACLO(z13, u, vp8); z14 = VMACHI(z14, u, vp8); 
+  z14 = VMACLO(z14, u, vp9); z15 = VMACHI(z15, u, vp9); 
+  z6 = VADD(z6, VSRA(z5, HT_BRADIX));
+
+  u = VMACLO(zero, z6, vw); 
+  z6  = VMACLO(z6,  u, vp0); z7  = VMACHI(z7,  u, vp0); 
+  z7  = VMACLO(z7,  u, vp1); z8  = VMACHI(z8,  u, vp1); 
+  z8  = VMACLO(z8,  u, vp2); z9  = VMACHI(z9,  u, vp2); 
+  z9  = VMACLO(z9,  u, vp3); z10 = VMACHI(z10, u, vp3); 
+  z10 = VMACLO(z10, u, vp4); z11 = VMACHI(z11, u, vp4); 
+  z11 = VMACLO(z11, u, vp5); z12 = VMACHI(z12, u, vp5); 
+  z12 = VMACLO(z12, u, vp6); z13 = VMACHI(z13, u, vp6); 
+  z13 = VMACLO(z13, u, vp7); z14 = VMACHI(z14, u, vp7); 
+  z14 = VMACLO(z14, u, vp8); z15 = VMACHI(z15, u, vp8); 
+  z15 = VMACLO(z15, u, vp9); z16 = VMACHI(z16, u, vp9); 
+  z7 = VADD(z7, VSRA(z6, HT_BRADIX));
+
+  u = VMACLO(zero, z7, vw); 
+  z7  = VMACLO(z7,  u, vp0); z8  = VMACHI(z8,  u, vp0); 
+  z8  = VMACLO(z8,  u, vp1); z9  = VMACHI(z9,  u, vp1); 
+  z9  = VMACLO(z9,  u, vp2); z10 = VMACHI(z10, u, vp2); 
+  z10 = VMACLO(z10, u, vp3); z11 = VMACHI(z11, u, vp3); 
+  z11 = VMACLO(z11, u, vp4); z12 = VMACHI(z12, u, vp4); 
+  z12 = VMACLO(z12, u, vp5); z13 = VMACHI(z13, u, vp5); 
+  z13 = VMACLO(z13, u, vp6); z14 = VMACHI(z14, u, vp6); 
+  z14 = VMACLO(z14, u, vp7); z15 = VMACHI(z15, u, vp7); 
+  z15 = VMACLO(z15, u, vp8); z16 = VMACHI(z16, u, vp8); 
+  z16 = VMACLO(z16, u, vp9); z17 = VMACHI(z17, u, vp9); 
+  z8 = VADD(z8, VSRA(z7, HT_BRADIX));
+
+  u = VMACLO(zero, z8, vw); 
+  z8  = VMACLO(z8,  u, vp0); z9  = VMACHI(z9,  u, vp0); 
+  z9  = VMACLO(z9,  u, vp1); z10 = VMACHI(z10, u, vp1); 
+  z10 = VMACLO(z10, u, vp2); z11 = VMACHI(z11, u, vp2); 
+  z11 = VMACLO(z11, u, vp3); z12 = VMACHI(z12, u, vp3); 
+  z12 = VMACLO(z12, u, vp4); z13 = VMACHI(z13, u, vp4); 
+  z13 = VMACLO(z13, u, vp5); z14 = VMACHI(z14, u, vp5); 
+  z14 = VMACLO(z14, u, vp6); z15 = VMACHI(z15, u, vp6); 
+  z15 = VMACLO(z15, u, vp7); z16 = VMACHI(z16, u, vp7); 
+  z16 = VMACLO(z16, u, vp8); z17 = VMACHI(z17, u, vp8); 
+  z17 = VMACLO(z17, u, vp9); z18 = VMACHI(z18, u, vp9); 
+  z9 = VADD(z9, VSRA(z8, HT_BRADIX));
+
+  u = VMACLO(zero, z9, vw); 
+  z9  = VMACLO(z9,  u, vp0); z10 = VMACHI(z10, u, vp0); 
+  z10 = VMACLO(z10, u, vp1); z11 = VMACHI(z11, u, vp1); 
+  z11 = VMACLO(z11, u, vp2); z12 = VMACHI(z12, u, vp2); 
+  z12 = VMACLO(z12, u, vp3); z13 = VMACHI(z13, u, vp3); 
+  z13 = VMACLO(z13, u, vp4); z14 = VMACHI(z14, u, vp4); 
+  z14 = VMACLO(z14, u, vp5); z15 = VMACHI(z15, u, vp5); 
+  z15 = VMACLO(z15, u, vp6); z16 = VMACHI(z16, u, vp6); 
+  z16 = VMACLO(z16, u, vp7); z17 = VMACHI(z17, u, vp7); 
+  z17 = VMACLO(z17, u, vp8); z18 = VMACHI(z18, u, vp8); 
+  z18 = VMACLO(z18, u, vp9); z19 = VMACHI(z19, u, vp9); 
+  z10 = VADD(z10, VSRA(z9, HT_BRADIX));
+
+  // carry propagation
+  z11 = VADD(z11, VSRA(z10, HT_BRADIX)); z10 = VAND(z10, vbmask);
+  z12 = VADD(z12, VSRA(z11, HT_BRADIX)); z11 = VAND(z11, vbmask);
+  z13 = VADD(z13, VSRA(z12, HT_BRADIX)); z12 = VAND(z12, vbmask);
+  z14 = VADD(z14, VSRA(z13, HT_BRADIX)); z13 = VAND(z13, vbmask);
+  z15 = VADD(z15, VSRA(z14, HT_BRADIX)); z14 = VAND(z14, vbmask);
+  z16 = VADD(z16, VSRA(z15, HT_BRADIX)); z15 = VAND(z15, vbmask);
+  z17 = VADD(z17, VSRA(z16, HT_BRADIX)); z16 = VAND(z16, vbmask);
+  z18 = VADD(z18, VSRA(z17, HT_BRADIX)); z17 = VAND(z17, vbmask);
+  z19 = VADD(z19, VSRA(z18, HT_BRADIX)); z18 = VAND(z18, vbmask);
+
+  r[0] = z10; r[1] = z11; r[2] = z12; r[3] = z13; r[4] = z14; 
+  r[5] = z15; r[6] = z16; r[7] = z17; r[8] = z18; r[9] = z19;  
+}
+
+// Montgomery squaring r = a^2 mod 2p
+// one-level Karatsuba (5+5 limbs) squaring followed by reduction (operand-scanning)
+// a = aL + aH * 2^260, a^2 = L + (M - L - H) * 2^260 + H * 2^520
+// with L = aL^2, H = aH^2, M = (aL + aH)^2
+// -> r in [0, 2p)
+void gfp_sqrka_8x1w(htfe_t r, const htfe_t a)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9]; 
+  __m512i l0 = VZERO, l1 = VZERO, l2 = VZERO, l3 = VZERO, l4 = VZERO;
+  __m512i l5 = VZERO, l6 = VZERO, l7 = VZERO, l8 = VZERO, l9 = VZERO;
+  __m512i h0 = VZERO, h1 = VZERO, h2 = VZERO, h3 = VZERO, h4 = VZERO;
+  __m512i h5 = VZERO, h6 = VZERO, h7 = VZERO, h8 = VZERO, h9 = VZERO;
+  __m512i m0 = VZERO, m1 = VZERO, m2 = VZERO, m3 = VZERO, m4 = VZERO;
+  __m512i m5 = VZERO, m6 = VZERO, m7 = VZERO, m8 = VZERO, m9 = VZERO, m10;
+  __m512i sa0, sa1, sa2, sa3, sa4, ca;
+  __m512i  z0,  z1,  z2,  z3,  z4,  z5,  z6,  z7,  z8,  z9;
+  __m512i z10, z11, z12, z13, z14, z15, z16, z17, z18, z19, u;
+  __mmask8 mca;
+  const __m512i vp0 = VSET1(ht_p[0]), vp1 = VSET1(ht_p[1]);
+  const __m512i vp2 = VSET1(ht_p[2]), vp3 = VSET1(ht_p[3]);
+  const __m512i vp4 = VSET1(ht_p[4]), vp5 = VSET1(ht_p[5]);
+  const __m512i vp6 = VSET1(ht_p[6]), vp7 = VSET1(ht_p[7]);
+  const __m512i vp8 = VSET1(ht_p[8]), vp9 = VSET1(ht_p[9]);
+  const __m512i vbmask = VSET1(HT_BMASK), vw = VSET1(HT_MONTW), zero = VZERO;
+
+  // only the low 52 bits of a limb count, as in gfp_mulka_8x1w()
+  a0 = VAND(a0, vbmask); a1 = VAND(a1, vbmask); a2 = VAND(a2, vbmask);
+  a3 = VAND(a3, vbmask); a4 = VAND(a4, vbmask); a5 = VAND(a5, vbmask);
+  a6 = VAND(a6, vbmask); a7 = VAND(a7, vbmask); a8 = VAND(a8, vbmask);
+  a9 = VAND(a9, vbmask);
+
+  // sa = aL + aH in 5 radix-52 limbs plus a carry bit ca
+  sa0 = VADD(a0, a5); sa1 = VADD(a1, a6); sa2 = VADD(a2, a7);
+  sa3 = VADD(a3, a8); sa4 = VADD(a4, a9);
+  sa1 = VADD(sa1, VSHR(sa0, HT_BRADIX)); sa0 = VAND(sa0, vbmask);
+  sa2 = VADD(sa2, VSHR(sa1, HT_BRADIX)); sa1 = VAND(sa1, vbmask);
+  sa3 = VADD(sa3, VSHR(sa2, HT_BRADIX)); sa2 = VAND(sa2, vbmask);
+  sa4 = VADD(sa4, VSHR(sa3, HT_BRADIX)); sa3 = VAND(sa3, vbmask);
+  ca = VSHR(sa4, HT_BRADIX); sa4 = VAND(sa4, vbmask);
+
+  // L = aL^2
+  l1 = VMACLO(l1, a0, a1);
+  l2 = VMACHI(l2, a0, a1);
+  l2 = VMACLO(l2, a0, a2);
+  l3 = VMACHI(l3, a0, a2);
+  l3 = VMACLO(l3, a0, a3); l3 = VMACLO(l3, a1, a2);
+  l4 = VMACHI(l4, a0, a3); l4 = VMACHI(l4, a1, a2);
+  l4 = VMACLO(l4, a0, a4); l4 = VMACLO(l4, a1, a3);
+  l5 = VMACHI(l5, a0, a4); l5 = VMACHI(l5, a1, a3);
+  l5 = VMACLO(l5, a1, a4); l5 = VMACLO(l5, a2, a3);
+  l6 = VMACHI(l6, a1, a4); l6 = VMACHI(l6, a2, a3);
+  l6 = VMACLO(l6, a2, a4);
+  l7 = VMACHI(l7, a2, a4);
+  l7 = VMACLO(l7, a3, a4);
+  l8 = VMACHI(l8, a3, a4);
+  l1 = VADD(l1, l1); l2 = VADD(l2, l2); l3 = VADD(l3, l3); l4 = VADD(l4, l4); l5 = VADD(l5, l5);
+  l6 = VADD(l6, l6); l7 = VADD(l7, l7); l8 = VADD(l8, l8); l9 = VADD(l9, l9);
+  l0 = VMACLO(l0, a0, a0); l1 = VMACHI(l1, a0, a0);
+  l2 = VMACLO(l2, a1, a1); l3 = VMACHI(l3, a1, a1);
+  l4 = VMACLO(l4, a2, a2); l5 = VMACHI(l5, a2, a2);
+  l6 = VMACLO(l6, a3, a3); l7 = VMACHI(l7, a3, a3);
+  l8 = VMACLO(l8, a4, a4); l9 = VMACHI(l9, a4, a4);
+
+  // H = aH^2
+  h1 = VMACLO(h1, a5, a6);
+  h2 = VMACHI(h2, a5, a6);
+  h2 = VMACLO(h2, a5, a7);
+  h3 = VMACHI(h3, a5, a7);
+  h3 = VMACLO(h3, a5, a8); h3 = VMACLO(h3, a6, a7);
+  h4 = VMACHI(h4, a5, a8); h4 = VMACHI(h4, a6, a7);
+  h4 = VMACLO(h4, a5, a9); h4 = VMACLO(h4, a6, a8);
+  h5 = VMACHI(h5, a5, a9); h5 = VMACHI(h5, a6, a8);
+  h5 = VMACLO(h5, a6, a9); h5 = VMACLO(h5, a7, a8);
+  h6 = VMACHI(h6, a6, a9); h6 = VMACHI(h6, a7, a8);
+  h6 = VMACLO(h6, a7, a9);
+  h7 = VMACHI(h7, a7, a9);
+  h7 = VMACLO(h7, a8, a9);
+  h8 = VMACHI(h8, a8, a9);
+  h1 = VADD(h1, h1); h2 = VADD(h2, h2); h3 = VADD(h3, h3); h4 = VADD(h4, h4); h5 = VADD(h5, h5);
+  h6 = VADD(h6, h6); h7 = VADD(h7, h7); h8 = VADD(h8, h8); h9 = VADD(h9, h9);
+  h0 = VMACLO(h0, a5, a5); h1 = VMACHI(h1, a5, a5);
+  h2 = VMACLO(h2, a6, a6); h3 = VMACHI(h3, a6, a6);
+  h4 = VMACLO(h4, a7, a7); h5 = VMACHI(h5, a7, a7);
+  h6 = VMACLO(h6, a8, a8); h7 = VMACHI(h7, a8, a8);
+  h8 = VMACLO(h8, a9, a9); h9 = VMACHI(h9, a9, a9);
+
+  // M = sa^2
+  m1 = VMACLO(m1, sa0, sa1);
+  m2 = VMACHI(m2, sa0, sa1);
+  m2 = VMACLO(m2, sa0, sa2);
+  m3 = VMACHI(m3, sa0, sa2);
+  m3 = VMACLO(m3, sa0, sa3); m3 = VMACLO(m3, sa1, sa2);
+  m4 = VMACHI(m4, sa0, sa3); m4 = VMACHI(m4, sa1, sa2);
+  m4 = VMACLO(m4, sa0, sa4); m4 = VMACLO(m4, sa1, sa3);
+  m5 = VMACHI(m5, sa0, sa4); m5 = VMACHI(m5, sa1, sa3);
+  m5 = VMACLO(m5, sa1, sa4); m5 = VMACLO(m5, sa2, sa3);
+  m6 = VMACHI(m6, sa1, sa4); m6 = VMACHI(m6, sa2, sa3);
+  m6 = VMACLO(m6, sa2, sa4);
+  m7 = VMACHI(m7, sa2, sa4);
+  m7 = VMACLO(m7, sa3, sa4);
+  m8 = VMACHI(m8, sa3, sa4);
+  m1 = VADD(m1, m1); m2 = VADD(m2, m2); m3 = VADD(m3, m3); m4 = VADD(m4, m4); m5 = VADD(m5, m5);
+  m6 = VADD(m6, m6); m7 = VADD(m7, m7); m8 = VADD(m8, m8); m9 = VADD(m9, m9);
+  m0 = VMACLO(m0, sa0, sa0); m1 = VMACHI(m1, sa0, sa0);
+  m2 = VMACLO(m2, sa1, sa1); m3 = VMACHI(m3, sa1, sa1);
+  m4 = VMACLO(m4, sa2, sa2); m5 = VMACHI(m5, sa2, sa2);
+  m6 = VMACLO(m6, sa3, sa3); m7 = VMACHI(m7, sa3, sa3);
+  m8 = VMACLO(m8, sa4, sa4); m9 = VMACHI(m9, sa4, sa4);
+
+  // M += 2 * ca * sa * 2^260 + ca * 2^520
+  mca = VTEST(ca, ca);
+  m5 = VMADD(m5, mca, m5, VADD(sa0, sa0)); m6 = VMADD(m6, mca, m6, VADD(sa1, sa1));
+  m7 = VMADD(m7, mca, m7, VADD(sa2, sa2)); m8 = VMADD(m8, mca, m8, VADD(sa3, sa3));
+  m9 = VMADD(m9, mca, m9, VADD(sa4, sa4));
+  m10 = ca;
+
+  // z = L + (M - L - H) * 2^260 + H * 2^520, the columns may be negative
+  m0 = VSUB(m0, VADD(l0, h0)); m1 = VSUB(m1, VADD(l1, h1));
+  m2 = VSUB(m2, VADD(l2, h2)); m3 = VSUB(m3, VADD(l3, h3));
+  m4 = VSUB(m4, VADD(l4, h4)); m5 = VSUB(m5, VADD(l5, h5));
+  m6 = VSUB(m6, VADD(l6, h6)); m7 = VSUB(m7, VADD(l7, h7));
+  m8 = VSUB(m8, VADD(l8, h8)); m9 = VSUB(m9, VADD(l9, h9));
+  z0 = l0; z1 = l1; z2 = l2; z3 = l3;
+  z4 = l4; z5 = VADD(l5, m0); z6 = VADD(l6, m1); z7 = VADD(l7, m2);
+  z8 = VADD(l8, m3); z9 = VADD(l9, m4); z10 = VADD(m5, h0); z11 = VADD(m6, h1);
+  z12 = VADD(m7, h2); z13 = VADD(m8, h3); z14 = VADD(m9, h4); z15 = VADD(m10, h5);
+  z16 = h6; z17 = h7; z18 = h8; z19 = h9;
+
+  // Montgomery reduction (signed carries)
+  u = VMACLO(zero, z0, vw); 
+  z0  = VMACLO(z0,  u, vp0); z1  = VMACHI(z1,  u, vp0); 
+  z1  = VMACLO(z1,  u, vp1); z2  = VMACHI(z2,  u, vp1); 
+  z2  = VMACLO(z2,  u, vp2); z3  = VMACHI(z3,  u, vp2); 
+  z3  = VMACLO(z3,  u, vp3); z4  = VMACHI(z4,  u, vp3); 
+  z4  = VMACLO(z4,  u, vp4); z5  = VMACHI(z5,  u, vp4); 
+  z5  = VMACLO(z5,  u, vp5); z6  = VMACHI(z6,  u, vp5); 
+  z6  = VMACLO(z6,  u, vp6); z7  = VMACHI(z7,  u, vp6); 
+  z7  = VMACLO(z7,  u, vp7); z8  = VMACHI(z8,  u, vp7); 
+  z8  = VMACLO(z8,  u, vp8); z9  = VMACHI(z9,  u, vp8); 
+  z9  = VMACLO(z9,  u, vp9); z10 = VMACHI(z10, u, vp9); 
+  z1 = VADD(z1, VSRA(z0, HT_BRADIX));
+
+  u = VMACLO(zero, z1, vw); 
+  z1  = VMACLO(z1,  u, vp0); z2  = VMACHI(z2,  u, vp0); 
+  z2  = VMACLO(z2,  u, vp1); z3  = VMACHI(z3,  u, vp1); 
+  z3  = VMACLO(z3,  u, vp2); z4  = VMACHI(z4,  u, vp2); 
+  z4  = VMACLO(z4,  u, vp3); z5  = VMACHI(z5,  u, vp3); 
+  z5  = VMACLO(z5,  u, vp4); z6  = VMACHI(z6,  u, vp4); 
+  z6  = VMACLO(z6,  u, vp5); z7  = VMACHI(z7,  u, vp5); 
+  z7  = VMACLO(z7,  u, vp6); z8  = VMACHI(z8,  u, vp6); 
+  z8  = VMACLO(z8,  u, vp7); z9  = VMACHI(z9,  u, vp7); 
+  z9  = VMACLO(z9,  u, vp8); z10 = VMACHI(z10, u, vp8); 
+  z10 = VMACLO(z10, u, vp9); z11 = VMACHI(z11, u, vp9); 
+  z2 = VADD(z2, VSRA(z1, HT_BRADIX));
+
+  u = VMACLO(zero, z2, vw); 
+  z2  = VMACLO(z2,  u, vp0); z3  = VMACHI(z3,  u, vp0); 
+  z3  = VMACLO(z3,  u, vp1); z4  = VMACHI(z4,  u, vp1); 
+  z4  = VMACLO(z4,  u, vp2); z5  = VMACHI(z5,  u, vp2); 
+  z5  = VMACLO(z5,  u, vp3); z6  = VMACHI(z6,  u, vp3); 
+  z6  = VMACLO(z6,  u, vp4); z7  = VMACHI(z7,  u, vp4); 
+  z7  = VMACLO(z7,  u, vp5); z8  = VMACHI(z8,  u, vp5); 
+  z8  = VMACLO(z8,  u, vp6); z9  = VMACHI(z9,  u, vp6); 
+  z9  = VMACLO(z9,  u, vp7); z10 = VMACHI(z10, u, vp7); 
+  z10 = VMACLO(z10, u, vp8); z11 = VMACHI(z11, u, vp8); 
+  z11 = VMACLO(z11, u, vp9); z12 = VMACHI(z12, u, vp9); 
+  z3 = VADD(z3, VSRA(z2, HT_BRADIX));
+
+  u = VMACLO(zero, z3, vw); 
+  z3  = VMACLO(z3,  u, vp0); z4  = VMACHI(z4,  u, vp0); 
+  z4  = VMACLO(z4,  u, vp1); z5  = VMACHI(z5,  u, vp1); 
+  z5  = VMACLO(z5,  u, vp2); z6  = VMACHI(z6,  u, vp2); 
+  z6  = VMACLO(z6,  u, vp3); z7  = VMACHI(z7,  u, vp3); 
+  z7  = VMACLO(z7,  u, vp4); z8  = VMACHI(z8,  u, vp4); 
+  z8  = VMACLO(z8,  u, vp5); z9  = VMACHI(z9,  u, vp5); 
+  z9  = VMACLO(z9,  u, vp6); z10 = VMACHI(z10, u, vp6); 
+  z10 = VMACLO(z10, u, vp7); z11 = VMACHI(z11, u, vp7); 
+  z11 = VMACLO(z11, u, vp8); z12 = VMACHI(z12, u, vp8); 
+  z12 = VMACLO(z12, u, vp9); z13 = VMACHI(z13, u, vp9); 
+  z4 = VADD(z4, VSRA(z3, HT_BRADIX));
+
+  u = VMACLO(zero, z4, vw); 
+  z4  = VMACLO(z4,  u, vp0); z5  = VMACHI(z5,  u, vp0); 
+  z5  = VMACLO(z5,  u, vp1); z6  = VMACHI(z6,  u, vp1); 
+  z6  = VMACLO(z6,  u, vp2); z7  = VMACHI(z7,  u, vp2); 
+  z7  = VMACLO(z7,  u, vp3); z8  = VMACHI(z8,  u, vp3); 
+  z8  = VMACLO(z8,  u, vp4); z9  = VMACHI(z9,  u, vp4); 
+  z9  = VMACLO(z9,  u, vp5); z10 = VMACHI(z10, u, vp5); 
+  z10 = VMACLO(z10, u, vp6); z11 = VMACHI(z11, u, vp6); 
+  z11 = VMACLO(z11, u, vp7); z12 = VMACHI(z12, u, vp7); 
+  z12 = VMACLO(z12, u, vp8); z13 = VMACHI(z13, u, vp8); 
+  z13 = VMACLO(z13, u, vp9); z14 = VMACHI(z14, u, vp9); 
+  z5 = VADD(z5, VSRA(z4, HT_BRADIX));
+
+  u = VMACLO(zero, z5, vw); 
+  z5  = VMACLO(z5,  u, vp0); z6  = VMACHI(z6,  u, vp0); 
+  z6  = VMACLO(z6,  u, vp1); z7  = VMACHI(z7,  u, vp1); 
+  z7  = VMACLO(z7,  u, vp2); z8  = VMACHI(z8,  u, vp2); 
+  z8  = VMACLO(z8,  u, vp3); z9  = VMACHI(z9,  u, vp3); 
+  z9  = VMACLO(z9,  u, vp4); z10 = VMACHI(z10, u, vp4); 
+  z10 = VMACLO(z10, u, vp5); z11 = VMACHI(z11, u, vp5); 
+  z11 = VMACLO(z11, u, vp6); z12 = VMACHI(z12, u, vp6); 
+  z12 = VMACLO(z12, u, vp7); z13 = VMACHI(z13, u, vp7); 
+  z13 = VMACLO(z13, u, vp8); z14 = VMACHI(z14, u, vp8); 
+  z14 = VMACLO(z14, u, vp9); z15 = VMACHI(z15, u, vp9); 
+  z6 = VADD(z6, VSRA(z5, HT_BRADIX));
+
+  u = VMACLO(zero, z6, vw); 
+  z6  = VMACLO(z6,  u, vp0); z7  = VMACHI(z7,  u, vp0); 
+  z7  = VMACLO(z7,  u, vp1); z8  = VMACHI(z8,  u, vp1); 
+  z8  = VMACLO(z8,  u, vp2); z9  = VMACHI(z9,  u, vp2); 
+  z9  = VMACLO(z9,  u, vp3); z10 = VMACHI(z10, u, vp3); 
+  z10 = VMACLO(z10, u, vp4); z11 = VMACHI(z11, u, vp4); 
+  z11 = VMACLO(z11, u, vp5); z12 = VMACHI(z12, u, vp5); 
+  z12 = VMACLO(z12, u, vp6); z13 = VMACHI(z13, u, vp6); 
+  z13 = VMACLO(z13, u, vp7); z14 = VMACHI(z14, u, vp7); 
+  z14 = VMACLO(z14, u, vp8); z15 = VMACHI(z15, u, vp8); 
+  z15 = VMACLO(z15, u, vp9); z16 = VMACHI(z16, u, vp9); 
+  z7 = VADD(z7, VSRA(z6, HT_BRADIX));
+
+  u = VMACLO(zero, z7, vw); 
+  z7  = VMACLO(z7,  u, vp0); z8  = VMACHI(z8,  u, vp0); 
+  z8  = VMACLO(z8,  u, vp1); z9  = VMACHI(z9,  u, vp1); 
+  z9  = VMACLO(z9,  u, vp2); z10 = VMACHI(z10, u, vp2); 
+  z10 = VMACLO(z10, u, vp3); z11 = VMACHI(z11, u, vp3); 
+  z11 = VMACLO(z11, u, vp4); z12 = VMACHI(z12, u, vp4); 
+  z12 = VMACLO(z12, u, vp5); z13 = VMACHI(z13, u, vp5); 
+  z13 = VMACLO(z13, u, vp6); z14 = VMACHI(z14, u, vp6); 
+  z14 = VMACLO(z14, u, vp7); z15 = VMACHI(z15, u, vp7); 
+  z15 = VMACLO(z15, u, vp8); z16 = VMACHI(z16, u, vp8); 
+  z16 = VMACLO(z16, u, vp9); z17 = VMACHI(z17, u, vp9); 
+  z8 = VADD(z8, VSRA(z7, HT_BRADIX));
+
+  u = VMACLO(zero, z8, vw); 
+  z8  = VMACLO(z8,  u, vp0); z9  = VMACHI(z9,  u, vp0); 
+  z9  = VMACLO(z9,  u, vp1); z10 = VMACHI(z10, u, vp1); 
+  z10 = VMACLO(z10, u, vp2); z11 = VMACHI(z11, u, vp2); 
+  z11 = VMACLO(z11, u, vp3); z12 = VMACHI(z12, u, vp3); 
+  z12 = VMACLO(z12, u, vp4); z13 = VMACHI(z13, u, vp4); 
+  z13 = VMACLO(z13, u, vp5); z14 = VMACHI(z14, u, vp5); 
+  z14 = VMACLO(z14, u, vp6); z15 = VMACHI(z15, u, vp6); 
+  z15 = VMACLO(z15, u, vp7); z16 = VMACHI(z16, u, vp7); 
+  z16 = VMACLO(z16, u, vp8); z17 = VMACHI(z17, u, vp8); 
+  z17 = VMACLO(z17, u, vp9); z18 = VMACHI(z18, u, vp9); 
+  z9 = VADD(z9, VSRA(z8, HT_BRADIX));
+
+  u = VMACLO(zero, z9, vw); 
+  z9  = VMACLO(z9,  u, vp0); z10 = VMACHI(z10, u, vp0); 
+  z10 = VMACLO(z10, u, vp1); z11 = VMACHI(z11, u, vp1); 
+  z11 = VMACLO(z11, u, vp2); z12 = VMACHI(z12, u, vp2); 
+  z12 = VMACLO(z12, u, vp3); z13 = VMACHI(z13, u, vp3); 
+  z13 = VMACLO(z13, u, vp4); z14 = VMACHI(z14, u, vp4); 
+  z14 = VMACLO(z14, u, vp5); z15 = VMACHI(z15, u, vp5); 
+  z15 = VMACLO(z15, u, vp6); z16 = VMACHI(z16, u, vp6); 
+  z16 = VMACLO(z16, u, vp7); z17 = VMACHI(z17, u, vp7); 
+  z17 = VMACLO(z17, u, vp8); z18 = VMACHI(z18, u, vp8); 
+  z18 = VMACLO(z18, u, vp9); z19 = VMACHI(z19, u, vp9); 
+  z10 = VADD(z10, VSRA(z9, HT_BRADIX));
+
+  // carry propagation
+  z11 = VADD(z11, VSRA(z10, HT_BRADIX)); z10 = VAND(z10, vbmask);
+  z12 = VADD(z12, VSRA(z11, HT_BRADIX)); z11 = VAND(z11, vbmask);
+  z13 = VADD(z13, VSRA(z12, HT_BRADIX)); z12 = VAND(z12, vbmask);
+  z14 = VADD(z14, VSRA(z13, HT_BRADIX)); z13 = VAND(z13, vbmask);
+  z15 = VADD(z15, VSRA(z14, HT_BRADIX)); z14 = VAND(z14, vbmask);
+  z16 = VADD(z16, VSRA(z15, HT_BRADIX)); z15 = VAND(z15, vbmask);
+  z17 = VADD(z17, VSRA(z16, HT_BRADIX)); z16 = VAND(z16, vbmask);
+  z18 = VADD(z18, VSRA(z17, HT_BRADIX)); z17 = VAND(z17, vbmask);
+  z19 = VADD(z19, VSRA(z18, HT_BRADIX)); z18 = VAND(z18, vbmask);
+
+  r[0] = z10; r[1] = z11; r[2] = z12; r[3] = z13; r[4] = z14; 
+  r[5] = z15; r[6] = z16; r[7] = z17; r[8] = z18; r[9] = z19;  
+}
+
+// fused sum-of-products a * b +/- c * d with a single Montgomery reduction
+// Both products are accumulated as 20 unnormalized 52-bit columns (each < 2^57)
+// and only their sum (or difference) is reduced, which is possible since
+// 8p^2 < 2^520 * p, i.e., R = 2^520 leaves 9 bits of headroom over 2p < 2^512.
+
+// integer multiplication z = a * b without reduction (product-scanning)
+// a, b in [0, 2p) -> z = 20 unnormalized columns, each < 2^57
+static void gfp_mulnr_8x1w(__m512i *z, const htfe_t a, const htfe_t b)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9]; 
+  __m512i b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4];
+  __m512i b5 = b[5], b6 = b[6], b7 = b[7], b8 = b[8], b9 = b[9]; 
+  __m512i  z0 = VZERO,  z1 = VZERO,  z2 = VZERO,  z3 = VZERO,  z4 = VZERO;
+  __m512i  z5 = VZERO,  z6 = VZERO,  z7 = VZERO,  z8 = VZERO,  z9 = VZERO;
+  __m512i z10 = VZERO, z11 = VZERO, z12 = VZERO, z13 = VZERO, z14 = VZERO;
+  __m512i z15 = VZERO, z16 = VZERO, z17 = VZERO, z18 = VZERO, z19 = VZERO;
+
+  z0 = VMACLO(z0, a0, b0);
+  z1 = VMACHI(z1, a0, b0);
+
+  z1 = VMACLO(z1, a0, b1); z1 = VMACLO(z1, a1, b0);
+  z2 = VMACHI(z2, a0, b1); z2 = VMACHI(z2, a1, b0);
+
+  z2 = VMACLO(z2, a0, b2); z2 = VMACLO(z2, a1, b1); z2 = VMACLO(z2, a2, b0);
+  z3 = VMACHI(z3, a0, b2); z3 = VMACHI(z3, a1, b1); z3 = VMACHI(z3, a2, b0);
+
+  z3 = VMACLO(z3, a0, b3); z3 = VMACLO(z3, a1, b2); z3 = VMACLO(z3, a2, b1);
+  z3 = VMACLO(z3, a3, b0);
+  z4 = VMACHI(z4, a0, b3); z4 = VMACHI(z4, a1, b2); z4 = VMACHI(z4, a2, b1);
+  z4 = VMACHI(z4, a3, b0);
+
+  z4 = VMACLO(z4, a0, b4); z4 = VMACLO(z4, a1, b3); z4 = VMACLO(z4, a2, b2);
+  z4 = VMACLO(z4, a3, b1); z4 = VMACLO(z4, a4, b0);
+  z5 = VMACHI(z5, a0, b4); z5 = VMACHI(z5, a1, b3); z5 = VMACHI(z5, a2, b2);
+  z5 = VMACHI(z5, a3, b1); z5 = VMACHI(z5, a4, b0);
+
+  z5 = VMACLO(z5, a0, b5); z5 = VMACLO(z5, a1, b4); z5 = VMACLO(z5, a2, b3);
+  z5 = VMACLO(z5, a3, b2); z5 = VMACLO(z5, a4, b1); z5 = VMACLO(z5, a5, b0);
+  z6 = VMACHI(z6, a0, b5); z6 = VMACHI(z6, a1, b4); z6 = VMACHI(z6, a2, b3);
+  z6 = VMACHI(z6, a3, b2); z6 = VMACHI(z6, a4, b1); z6 = VMACHI(z6, a5, b0);
+
+  z6 = VMACLO(z6, a0, b6); z6 = VMACLO(z6, a1, b5); z6 = VMACLO(z6, a2, b4);
+  z6 = VMACLO(z6, a3, b3); z6 = VMACLO(z6, a4, b2); z6 = VMACLO(z6, a5, b1);
+  z6 = VMACLO(z6, a6, b0);
+  z7 = VMACHI(z7, a0, b6); z7 = VMACHI(z7, a1, b5); z7 = VMACHI(z7, a2, b4);
+  z7 = VMACHI(z7, a3, b3); z7 = VMACHI(z7, a4, b2); z7 = VMACHI(z7, a5, b1);
+  z7 = VMACHI(z7, a6, b0);
+
+  z7 = VMACLO(z7, a0, b7); z7 = VMACLO(z7, a1, b6); z7 = VMACLO(z7, a2, b5);
+  z7 = VMACLO(z7, a3, b4); z7 = VMACLO(z7, a4, b3); z7 = VMACLO(z7, a5, b2);
+  z7 = VMACLO(z7, a6, b1); z7 = VMACLO(z7, a7, b0);
+  z8 = VMACHI(z8, a0, b7); z8 = VMACHI(z8, a1, b6); z8 = VMACHI(z8, a2, b5);
+  z8 = VMACHI(z8, a3, b4); z8 = VMACHI(z8, a4, b3); z8 = VMACHI(z8, a5, b2);
+  z8 = VMACHI(z8, a6, b1); z8 = VMACHI(z8, a7, b0);
+
+  z8 = VMACLO(z8, a0, b8); z8 = VMACLO(z8, a1, b7); z8 = VMACLO(z8, a2, b6);
+  z8 = VMACLO(z8, a3, b5); z8 = VMACLO(z8, a4, b4); z8 = VMACLO(z8, a5, b3);
+  z8 = VMACLO(z8, a6, b2); z8 = VMACLO(z8, a7, b1); z8 = VMACLO(z8, a8, b0);
+  z9 = VMACHI(z9, a0, b8); z9 = VMACHI(z9, a1, b7); z9 = VMACHI(z9, a2, b6);
+  z9 = VMACHI(z9, a3, b5); z9 = VMACHI(z9, a4, b4); z9 = VMACHI(z9, a5, b3);
+  z9 = VMACHI(z9, a6, b2); z9 = VMACHI(z9, a7, b1); z9 = VMACHI(z9, a8, b0);
+
+  z9 = VMACLO(z9, a0, b9); z9 = VMACLO(z9, a1, b8); z9 = VMACLO(z9, a2, b7);
+  z9 = VMACLO(z9, a3, b6); z9 = VMACLO(z9, a4, b5); z9 = VMACLO(z9, a5, b4);
+  z9 = VMACLO(z9, a6, b3); z9 = VMACLO(z9, a7, b2); z9 = VMACLO(z9, a8, b1);
+  z9 = VMACLO(z9, a9, b0);
+  z10 = VMACHI(z10, a0, b9); z10 = VMACHI(z10, a1, b8); z10 = VMACHI(z10, a2, b7);
+  z10 = VMACHI(z10, a3, b6); z10 = VMACHI(z10, a4, b5); z10 = VMACHI(z10, a5, b4);
+  z10 = VMACHI(z10, a6, b3); z10 = VMACHI(z10, a7, b2); z10 = VMACHI(z10, a8, b1);
+  z10 = VMACHI(z10, a9, b0);
+
+  z10 = VMACLO(z10, a1, b9); z10 = VMACLO(z10, a2, b8); z10 = VMACLO(z10, a3, b7);
+  z10 = VMACLO(z10, a4, b6); z10 = VMACLO(z10, a5, b5); z10 = VMACLO(z10, a6, b4);
+  z10 = VMACLO(z10, a7, b3); z10 = VMACLO(z10, a8, b2); z10 = VMACLO(z10, a9, b1);
+  z11 = VMACHI(z11, a1, b9); z11 = VMACHI(z11, a2, b8); z11 = VMACHI(z11, a3, b7);
+  z11 = VMACHI(z11, a4, b6); z11 = VMACHI(z11, a5, b5); z11 = VMACHI(z11, a6, b4);
+  z11 = VMACHI(z11, a7, b3); z11 = VMACHI(z11, a8, b2); z11 = VMACHI(z11, a9, b1);
+
+  z11 = VMACLO(z11, a2, b9); z11 = VMACLO(z11, a3, b8); z11 = VMACLO(z11, a4, b7);
+  z11 = VMACLO(z11, a5, b6); z11 = VMACLO(z11, a6, b5); z11 = VMACLO(z11, a7, b4);
+  z11 = VMACLO(z11, a8, b3); z11 = VMACLO(z11, a9, b2);
+  z12 = VMACHI(z12, a2, b9); z12 = VMACHI(z12, a3, b8); z12 = VMACHI(z12, a4, b7);
+  z12 = VMACHI(z12, a5, b6); z12 = VMACHI(z12, a6, b5); z12 = VMACHI(z12, a7, b4);
+  z12 = VMACHI(z12, a8, b3); z12 = VMACHI(z12, a9, b2);
+
+  z12 = VMACLO(z12, a3, b9); z12 = VMACLO(z12, a4, b8); z12 = VMACLO(z12, a5, b7);
+  z12 = VMACLO(z12, a6, b6); z12 = VMACLO(z12, a7, b5); z12 = VMACLO(z12, a8, b4);
+  z12 = VMACLO(z12, a9, b3);
+  z13 = VMACHI(z13, a3, b9); z13 = VMACHI(z13, a4, b8); z13 = VMACHI(z13, a5, b7);
+  z13 = VMACHI(z13, a6, b6); z13 = VMACHI(z13, a7, b5); z13 = VMACHI(z13, a8, b4);
+  z13 = VMACHI(z13, a9, b3);
+
+  z13 = VMACLO(z13, a4, b9); z13 = VMACLO(z13, a5, b8); z13 = VMACLO(z13, a6, b7);
+  z13 = VMACLO(z13, a7, b6); z13 = VMACLO(z13, a8, b5); z13 = VMACLO(z13, a9, b4);
+  z14 = VMACHI(z14, a4, b9); z14 = VMACHI(z14, a5, b8); z14 = VMACHI(z14, a6, b7);
+  z14 = VMACHI(z14, a7, b6); z14 = VMACHI(z14, a8, b5); z14 = VMACHI(z14, a9, b4);
+
+  z14 = VMACLO(z14, a5, b9); z14 = VMACLO(z14, a6, b8); z14 = VMACLO(z14, a7, b7);
+  z14 = VMACLO(z14, a8, b6); z14 = VMACLO(z14, a9, b5);
+  z15 = VMACHI(z15, a5, b9); z15 = VMACHI(z15, a6, b8); z15 = VMACHI(z15, a7, b7);
+  z15 = VMACHI(z15, a8, b6); z15 = VMACHI(z15, a9, b5);
+
+  z15 = VMACLO(z15, a6, b9); z15 = VMACLO(z15, a7, b8); z15 = VMACLO(z15, a8, b7);
+  z15 = VMACLO(z15, a9, b6);
+  z16 = VMACHI(z16, a6, b9); z16 = VMACHI(z16, a7, b8); z16 = VMACHI(z16, a8, b7);
+  z16 = VMACHI(z16, a9, b6);
+
+  z16 = VMACLO(z16, a7, b9); z16 = VMACLO(z16, a8, b8); z16 = VMACLO(z16, a9, b7);
+  z17 = VMACHI(z17, a7, b9); z17 = VMACHI(z17, a8, b8); z17 = VMACHI(z17, a9, b7);
+
+  z17 = VMACLO(z17, a8, b9); z17 = VMACLO(z17, a9, b8);
+  z18 = VMACHI(z18, a8, b9); z18 = VMACHI(z18, a9, b8);
+
+  z18 = VMACLO(z18, a9, b9);
+  z19 = VMACHI(z19, a9, b9);
+
+  z[ 0] =  z0; z[ 1] =  z1; z[ 2] =  z2; z[ 3] =  z3; z[ 4] =  z4;
+  z[ 5] =  z5; z[ 6] =  z6; z[ 7] =  z7; z[ 8] =  z8; z[ 9] =  z9;
+  z[10] = z10; z[11] = z11; z[12] = z12; z[13] = z13; z[14] = z14;
+  z[15] = z15; z[16] = z16; z[17] = z17; z[18] = z18; z[19] = z19;
+}
+
+// Montgomery reduction r = z * R^-1 mod 2p (operand-scanning)
+// z in [0, 2^520 * p), 20 columns each < 2^59 -> r in [0, 2p)
+static void gfp_redc_8x1w(htfe_t r, const __m512i *z)
+{
+  __m512i  z0 =  z[0],  z1 =  z[1],  z2 =  z[2],  z3 =  z[3],  z4 =  z[4];
+  __m512i  z5 =  z[5],  z6 =  z[6],  z7 =  z[7],  z8 =  z[8],  z9 =  z[9];
+  __m512i z10 = z[10], z11 = z[11], z12 = z[12], z13 = z[13], z14 = z[14];
+  __m512i z15 = z[15], z16 = z[16], z17 = z[17], z18 = z[18], z19 = z[19];
+  __m512i u;
+  const __m512i vp0 = VSET1(ht_p[0]), vp1 = VSET1(ht_p[1]);
+  const __m512i vp2 = VSET1(ht_p[2]), vp3 = VSET1(ht_p[3]);
+  const __m512i vp4 = VSET1(ht_p[4]), vp5 = VSET1(ht_p[5]);
+  const __m512i vp6 = VSET1(ht_p[6]), vp7 = VSET1(ht_p[7]);
+  const __m512i vp8 = VSET1(ht_p[8]), vp9 = VSET1(ht_p[9]);
+  const __m512i vbmask = VSET1(HT_BMASK), vw = VSET1(HT_MONTW), zero = VZERO;
+
+  u = VMACLO(zero, z0, vw); 
+  z0  = VMACLO(z0,  u, vp0); z1  = VMACHI(z1,  u, vp0); 
+  z1  = VMACLO(z1,  u, vp1); z2  = VMACHI(z2,  u, vp1); 
+  z2  = VMACLO(z2,  u, vp2); z3  = VMACHI(z3,  u, vp2); 
+  z3  = VMACLO(z3,  u, vp3); z4  = VMACHI(z4,  u, vp3); 
+  z4  = VMACLO(z4,  u, vp4); z5  = VMACHI(z5,  u, vp4); 
+  z5  = VMACLO(z5,  u, vp5); z6  = VMACHI(z6,  u, vp5); 
+  z6  = VMACLO(z6,  u, vp6); z7  = VMACHI(z7,  u, vp6); 
+  z7  = VMACLO(z7,  u, vp7); z8  = VMACHI(z8,  u, vp7); 
+  z8  = VMACLO(z8,  u, vp8); z9  = VMACHI(z9,  u, vp8); 
+  z9  = VMACLO(z9,  u, vp9); z10 = VMACHI(z10, u, vp9); 
+  z1 = VADD(z1, VSHR(z0, HT_BRADIX));
 
   u = VMACLO(zero, z1, vw); 
   z1  = VMACLO(z1,  u, vp0); z2  = VMACHI(z2,  u, vp0); 
@@ -516,11 +2426,7 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z8  = VMACLO(z8,  u, vp7); z9  = VMACHI(z9,  u, vp7); 
   z9  = VMACLO(z9,  u, vp8); z10 = VMACHI(z10, u, vp8); 
   z10 = VMACLO(z10, u, vp9); z11 = VMACHI(z11, u, vp9); 
-  z2 = VADD(z2, VSHR(z1, HT_BRADIX));  
-
-  z12 = VMACLO(z12, a3, a9); z12 = VMACLO(z12, a4, a8); z12 = VMACLO(z12, a5, a7); 
-  z13 = VMACHI(z13, a3, a9); z13 = VMACHI(z13, a4, a8); z13 = VMACHI(z13, a5, a7); 
-  z12 = VADD(z12, z12);
+  z2 = VADD(z2, VSHR(z1, HT_BRADIX));
 
   u = VMACLO(zero, z2, vw); 
   z2  = VMACLO(z2,  u, vp0); z3  = VMACHI(z3,  u, vp0); 
@@ -535,11 +2441,6 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z11 = VMACLO(z11, u, vp9); z12 = VMACHI(z12, u, vp9); 
   z3 = VADD(z3, VSHR(z2, HT_BRADIX));
 
-  z13 = VMACLO(z13, a4, a9); z13 = VMACLO(z13, a5, a8); z13 = VMACLO(z13, a6, a7); 
-  z14 = VMACHI(z14, a4, a9); z14 = VMACHI(z14, a5, a8); z14 = VMACHI(z14, a6, a7); 
-  z13 = VADD(z13, z13);
-  z12 = VMACLO(z12, a6, a6); z13 = VMACHI(z13, a6, a6); 
-
   u = VMACLO(zero, z3, vw); 
   z3  = VMACLO(z3,  u, vp0); z4  = VMACHI(z4,  u, vp0); 
   z4  = VMACLO(z4,  u, vp1); z5  = VMACHI(z5,  u, vp1); 
@@ -553,10 +2454,6 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z12 = VMACLO(z12, u, vp9); z13 = VMACHI(z13, u, vp9); 
   z4 = VADD(z4, VSHR(z3, HT_BRADIX));
 
-  z14 = VMACLO(z14, a5, a9); z14 = VMACLO(z14, a6, a8); 
-  z15 = VMACHI(z15, a5, a9); z15 = VMACHI(z15, a6, a8); 
-  z14 = VADD(z14, z14);
-
   u = VMACLO(zero, z4, vw); 
   z4  = VMACLO(z4,  u, vp0); z5  = VMACHI(z5,  u, vp0); 
   z5  = VMACLO(z5,  u, vp1); z6  = VMACHI(z6,  u, vp1); 
@@ -570,11 +2467,6 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z13 = VMACLO(z13, u, vp9); z14 = VMACHI(z14, u, vp9); 
   z5 = VADD(z5, VSHR(z4, HT_BRADIX));
 
-  z15 = VMACLO(z15, a6, a9); z15 = VMACLO(z15, a7, a8); 
-  z16 = VMACHI(z16, a6, a9); z16 = VMACHI(z16, a7, a8);
-  z15 = VADD(z15, z15);
-  z14 = VMACLO(z14, a7, a7); z15 = VMACHI(z15, a7, a7);
-
   u = VMACLO(zero, z5, vw); 
   z5  = VMACLO(z5,  u, vp0); z6  = VMACHI(z6,  u, vp0); 
   z6  = VMACLO(z6,  u, vp1); z7  = VMACHI(z7,  u, vp1); 
@@ -588,10 +2480,6 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z14 = VMACLO(z14, u, vp9); z15 = VMACHI(z15, u, vp9); 
   z6 = VADD(z6, VSHR(z5, HT_BRADIX));
 
-  z16 = VMACLO(z16, a7, a9);  
-  z17 = VMACHI(z17, a7, a9); 
-  z16 = VADD(z16, z16);
-
   u = VMACLO(zero, z6, vw); 
   z6  = VMACLO(z6,  u, vp0); z7  = VMACHI(z7,  u, vp0); 
   z7  = VMACLO(z7,  u, vp1); z8  = VMACHI(z8,  u, vp1); 
@@ -603,12 +2491,7 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z13 = VMACLO(z13, u, vp7); z14 = VMACHI(z14, u, vp7); 
   z14 = VMACLO(z14, u, vp8); z15 = VMACHI(z15, u, vp8); 
   z15 = VMACLO(z15, u, vp9); z16 = VMACHI(z16, u, vp9); 
-  z7 = VADD(z7, VSHR(z6, HT_BRADIX)); 
-
-  z17 = VMACLO(z17, a8, a9); 
-  z18 = VMACHI(z18, a8, a9);
-  z17 = VADD(z17, z17);
-  z16 = VMACLO(z16, a8, a8); z17 = VMACHI(z17, a8, a8); 
+  z7 = VADD(z7, VSHR(z6, HT_BRADIX));
 
   u = VMACLO(zero, z7, vw); 
   z7  = VMACLO(z7,  u, vp0); z8  = VMACHI(z8,  u, vp0); 
@@ -621,9 +2504,7 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z14 = VMACLO(z14, u, vp7); z15 = VMACHI(z15, u, vp7); 
   z15 = VMACLO(z15, u, vp8); z16 = VMACHI(z16, u, vp8); 
   z16 = VMACLO(z16, u, vp9); z17 = VMACHI(z17, u, vp9); 
-  z8 = VADD(z8, VSHR(z7, HT_BRADIX)); 
-
-  z18 = VADD(z18, z18);
+  z8 = VADD(z8, VSHR(z7, HT_BRADIX));
 
   u = VMACLO(zero, z8, vw); 
   z8  = VMACLO(z8,  u, vp0); z9  = VMACHI(z9,  u, vp0); 
@@ -636,10 +2517,7 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z15 = VMACLO(z15, u, vp7); z16 = VMACHI(z16, u, vp7); 
   z16 = VMACLO(z16, u, vp8); z17 = VMACHI(z17, u, vp8); 
   z17 = VMACLO(z17, u, vp9); z18 = VMACHI(z18, u, vp9); 
-  z9 = VADD(z9, VSHR(z8, HT_BRADIX)); 
-
-  z18 = VMACLO(z18, a9, a9);
-  z19 = VMACHI(z19, a9, a9);
+  z9 = VADD(z9, VSHR(z8, HT_BRADIX));
 
   u = VMACLO(zero, z9, vw); 
   z9  = VMACLO(z9,  u, vp0); z10 = VMACHI(z10, u, vp0); 
@@ -651,9 +2529,10 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z15 = VMACLO(z15, u, vp6); z16 = VMACHI(z16, u, vp6); 
   z16 = VMACLO(z16, u, vp7); z17 = VMACHI(z17, u, vp7); 
   z17 = VMACLO(z17, u, vp8); z18 = VMACHI(z18, u, vp8); 
-  z18 = VMACLO(z18, u, vp9); z19 = VMACHI(z19, u, vp9);
+  z18 = VMACLO(z18, u, vp9); z19 = VMACHI(z19, u, vp9); 
   z10 = VADD(z10, VSHR(z9, HT_BRADIX));
 
+  // carry propagation
   z11 = VADD(z11, VSHR(z10, HT_BRADIX)); z10 = VAND(z10, vbmask);
   z12 = VADD(z12, VSHR(z11, HT_BRADIX)); z11 = VAND(z11, vbmask);
   z13 = VADD(z13, VSHR(z12, HT_BRADIX)); z12 = VAND(z12, vbmask);
@@ -664,10 +2543,378 @@ void gfp_sqr_8x1w(htfe_t r, const htfe_t a)
   z18 = VADD(z18, VSHR(z17, HT_BRADIX)); z17 = VAND(z17, vbmask);
   z19 = VADD(z19, VSHR(z18, HT_BRADIX)); z18 = VAND(z18, vbmask);
 
-  // ---------------------------------------------------------------------------
-
   r[0] = z10; r[1] = z11; r[2] = z12; r[3] = z13; r[4] = z14; 
-  r[5] = z15; r[6] = z16; r[7] = z17; r[8] = z18; r[9] = z19; 
+  r[5] = z15; r[6] = z16; r[7] = z17; r[8] = z18; r[9] = z19;  
+}
+
+// two independent Montgomery reductions r = x * R^-1, s = y * R^-1 mod 2p,
+// interleaved to hide the latency of the sequential reduction rounds
+// x, y in [0, 2^520 * p), 20 columns each < 2^59 -> r, s in [0, 2p)
+static void gfp_redc2_8x1w(htfe_t r, htfe_t s, const __m512i *x, const __m512i *y)
+{
+  __m512i  x0 =  x[0],  x1 =  x[1],  x2 =  x[2],  x3 =  x[3],  x4 =  x[4];
+  __m512i  x5 =  x[5],  x6 =  x[6],  x7 =  x[7],  x8 =  x[8],  x9 =  x[9];
+  __m512i x10 = x[10], x11 = x[11], x12 = x[12], x13 = x[13], x14 = x[14];
+  __m512i x15 = x[15], x16 = x[16], x17 = x[17], x18 = x[18], x19 = x[19];
+  __m512i  y0 =  y[0],  y1 =  y[1],  y2 =  y[2],  y3 =  y[3],  y4 =  y[4];
+  __m512i  y5 =  y[5],  y6 =  y[6],  y7 =  y[7],  y8 =  y[8],  y9 =  y[9];
+  __m512i y10 = y[10], y11 = y[11], y12 = y[12], y13 = y[13], y14 = y[14];
+  __m512i y15 = y[15], y16 = y[16], y17 = y[17], y18 = y[18], y19 = y[19];
+  __m512i u, v;
+  const __m512i vp0 = VSET1(ht_p[0]), vp1 = VSET1(ht_p[1]);
+  const __m512i vp2 = VSET1(ht_p[2]), vp3 = VSET1(ht_p[3]);
+  const __m512i vp4 = VSET1(ht_p[4]), vp5 = VSET1(ht_p[5]);
+  const __m512i vp6 = VSET1(ht_p[6]), vp7 = VSET1(ht_p[7]);
+  const __m512i vp8 = VSET1(ht_p[8]), vp9 = VSET1(ht_p[9]);
+  const __m512i vbmask = VSET1(HT_BMASK), vw = VSET1(HT_MONTW), zero = VZERO;
+
+  u = VMACLO(zero, x0, vw); v = VMACLO(zero, y0, vw);
+  x0  = VMACLO(x0,  u, vp0); x1  = VMACHI(x1,  u, vp0); 
+  y0  = VMACLO(y0,  v, vp0); y1  = VMACHI(y1,  v, vp0); 
+  x1  = VMACLO(x1,  u, vp1); x2  = VMACHI(x2,  u, vp1); 
+  y1  = VMACLO(y1,  v, vp1); y2  = VMACHI(y2,  v, vp1); 
+  x2  = VMACLO(x2,  u, vp2); x3  = VMACHI(x3,  u, vp2); 
+  y2  = VMACLO(y2,  v, vp2); y3  = VMACHI(y3,  v, vp2); 
+  x3  = VMACLO(x3,  u, vp3); x4  = VMACHI(x4,  u, vp3); 
+  y3  = VMACLO(y3,  v, vp3); y4  = VMACHI(y4,  v, vp3); 
+  x4  = VMACLO(x4,  u, vp4); x5  = VMACHI(x5,  u, vp4); 
+  y4  = VMACLO(y4,  v, vp4); y5  = VMACHI(y5,  v, vp4); 
+  x5  = VMACLO(x5,  u, vp5); x6  = VMACHI(x6,  u, vp5); 
+  y5  = VMACLO(y5,  v, vp5); y6  = VMACHI(y6,  v, vp5); 
+  x6  = VMACLO(x6,  u, vp6); x7  = VMACHI(x7,  u, vp6); 
+  y6  = VMACLO(y6,  v, vp6); y7  = VMACHI(y7,  v, vp6); 
+  x7  = VMACLO(x7,  u, vp7); x8  = VMACHI(x8,  u, vp7); 
+  y7  = VMACLO(y7,  v, vp7); y8  = VMACHI(y8,  v, vp7); 
+  x8  = VMACLO(x8,  u, vp8); x9  = VMACHI(x9,  u, vp8); 
+  y8  = VMACLO(y8,  v, vp8); y9  = VMACHI(y9,  v, vp8); 
+  x9  = VMACLO(x9,  u, vp9); x10 = VMACHI(x10, u, vp9); 
+  y9  = VMACLO(y9,  v, vp9); y10 = VMACHI(y10, v, vp9); 
+  x1 = VADD(x1, VSHR(x0, HT_BRADIX)); y1 = VADD(y1, VSHR(y0, HT_BRADIX));
+
+  u = VMACLO(zero, x1, vw); v = VMACLO(zero, y1, vw);
+  x1  = VMACLO(x1,  u, vp0); x2  = VMACHI(x2,  u, vp0); 
+  y1  = VMACLO(y1,  v, vp0); y2  = VMACHI(y2,  v, vp0); 
+  x2  = VMACLO(x2,  u, vp1); x3  = VMACHI(x3,  u, vp1); 
+  y2  = VMACLO(y2,  v, vp1); y3  = VMACHI(y3,  v, vp1); 
+  x3  = VMACLO(x3,  u, vp2); x4  = VMACHI(x4,  u, vp2); 
+  y3  = VMACLO(y3,  v, vp2); y4  = VMACHI(y4,  v, vp2); 
+  x4  = VMACLO(x4,  u, vp3); x5  = VMACHI(x5,  u, vp3); 
+  y4  = VMACLO(y4,  v, vp3); y5  = VMACHI(y5,  v, vp3); 
+  x5  = VMACLO(x5,  u, vp4); x6  = VMACHI(x6,  u, vp4); 
+  y5  = VMACLO(y5,  v, vp4); y6  = VMACHI(y6,  v, vp4); 
+  x6  = VMACLO(x6,  u, vp5); x7  = VMACHI(x7,  u, vp5); 
+  y6  = VMACLO(y6,  v, vp5); y7  = VMACHI(y7,  v, vp5); 
+  x7  = VMACLO(x7,  u, vp6); x8  = VMACHI(x8,  u, vp6); 
+  y7  = VMACLO(y7,  v, vp6); y8  = VMACHI(y8,  v, vp6); 
+  x8  = VMACLO(x8,  u, vp7); x9  = VMACHI(x9,  u, vp7); 
+  y8  = VMACLO(y8,  v, vp7); y9  = VMACHI(y9,  v, vp7); 
+  x9  = VMACLO(x9,  u, vp8); x10 = VMACHI(x10, u, vp8); 
+  y9  = VMACLO(y9,  v, vp8); y10 = VMACHI(y10, v, vp8); 
+  x10 = VMACLO(x10, u, vp9); x11 = VMACHI(x11, u, vp9); 
+  y10 = VMACLO(y10, v, vp9); y11 = VMACHI(y11, v, vp9); 
+  x2 = VADD(x2, VSHR(x1, HT_BRADIX)); y2 = VADD(y2, VSHR(y1, HT_BRADIX));
+
+  u = VMACLO(zero, x2, vw); v = VMACLO(zero, y2, vw);
+  x2  = VMACLO(x2,  u, vp0); x3  = VMACHI(x3,  u, vp0); 
+  y2  = VMACLO(y2,  v, vp0); y3  = VMACHI(y3,  v, vp0); 
+  x3  = VMACLO(x3,  u, vp1); x4  = VMACHI(x4,  u, vp1); 
+  y3  = VMACLO(y3,  v, vp1); y4  = VMACHI(y4,  v, vp1); 
+  x4  = VMACLO(x4,  u, vp2); x5  = VMACHI(x5,  u, vp2); 
+  y4  = VMACLO(y4,  v, vp2); y5  = VMACHI(y5,  v, vp2); 
+  x5  = VMACLO(x5,  u, vp3); x6  = VMACHI(x6,  u, vp3); 
+  y5  = VMACLO(y5,  v, vp3); y6  = VMACHI(y6,  v, vp3); 
+  x6  = VMACLO(x6,  u, vp4); x7  = VMACHI(x7,  u, vp4); 
+  y6  = VMACLO(y6,  v, vp4); y7  = VMACHI(y7,  v, vp4); 
+  x7  = VMACLO(x7,  u, vp5); x8  = VMACHI(x8,  u, vp5); 
+  y7  = VMACLO(y7,  v, vp5); y8  = VMACHI(y8,  v, vp5); 
+  x8  = VMACLO(x8,  u, vp6); x9  = VMACHI(x9,  u, vp6); 
+  y8  = VMACLO(y8,  v, vp6); y9  = VMACHI(y9,  v, vp6); 
+  x9  = VMACLO(x9,  u, vp7); x10 = VMACHI(x10, u, vp7); 
+  y9  = VMACLO(y9,  v, vp7); y10 = VMACHI(y10, v, vp7); 
+  x10 = VMACLO(x10, u, vp8); x11 = VMACHI(x11, u, vp8); 
+  y10 = VMACLO(y10, v, vp8); y11 = VMACHI(y11, v, vp8); 
+  x11 = VMACLO(x11, u, vp9); x12 = VMACHI(x12, u, vp9); 
+  y11 = VMACLO(y11, v, vp9); y12 = VMACHI(y12, v, vp9); 
+  x3 = VADD(x3, VSHR(x2, HT_BRADIX)); y3 = VADD(y3, VSHR(y2, HT_BRADIX));
+
+  u = VMACLO(zero, x3, vw); v = VMACLO(zero, y3, vw);
+  x3  = VMACLO(x3,  u, vp0); x4  = VMACHI(x4,  u, vp0); 
+  y3  = VMACLO(y3,  v, vp0); y4  = VMACHI(y4,  v, vp0); 
+  x4  = VMACLO(x4,  u, vp1); x5  = VMACHI(x5,  u, vp1); 
+  y4  = VMACLO(y4,  v, vp1); y5  = VMACHI(y5,  v, vp1); 
+  x5  = VMACLO(x5,  u, vp2); x6  = VMACHI(x6,  u, vp2); 
+  y5  = VMACLO(y5,  v, vp2); y6  = VMACHI(y6,  v, vp2); 
+  x6  = VMACLO(x6,  u, vp3); x7  = VMACHI(x7,  u, vp3); 
+  y6  = VMACLO(y6,  v, vp3); y7  = VMACHI(y7,  v, vp3); 
+  x7  = VMACLO(x7,  u, vp4); x8  = VMACHI(x8,  u, vp4); 
+  y7  = VMACLO(y7,  v, vp4); y8  = VMACHI(y8,  v, vp4); 
+  x8  = VMACLO(x8,  u, vp5); x9  = VMACHI(x9,  u, vp5); 
+  y8  = VMACLO(y8,  v, vp5); y9  = VMACHI(y9,  v, vp5); 
+  x9  = VMACLO(x9,  u, vp6); x10 = VMACHI(x10, u, vp6); 
+  y9  = VMACLO(y9,  v, vp6); y10 = VMACHI(y10, v, vp6); 
+  x10 = VMACLO(x10, u, vp7); x11 = VMACHI(x11, u, vp7); 
+  y10 = VMACLO(y10, v, vp7); y11 = VMACHI(y11, v, vp7); 
+  x11 = VMACLO(x11, u, vp8); x12 = VMACHI(x12, u, vp8); 
+  y11 = VMACLO(y11, v, vp8); y12 = VMACHI(y12, v, vp8); 
+  x12 = VMACLO(x12, u, vp9); x13 = VMACHI(x13, u, vp9); 
+  y12 = VMACLO(y12, v, vp9); y13 = VMACHI(y13, v, vp9); 
+  x4 = VADD(x4, VSHR(x3, HT_BRADIX)); y4 = VADD(y4, VSHR(y3, HT_BRADIX));
+
+  u = VMACLO(zero, x4, vw); v = VMACLO(zero, y4, vw);
+  x4  = VMACLO(x4,  u, vp0); x5  = VMACHI(x5,  u, vp0); 
+  y4  = VMACLO(y4,  v, vp0); y5  = VMACHI(y5,  v, vp0); 
+  x5  = VMACLO(x5,  u, vp1); x6  = VMACHI(x6,  u, vp1); 
+  y5  = VMACLO(y5,  v, vp1); y6  = VMACHI(y6,  v, vp1); 
+  x6  = VMACLO(x6,  u, vp2); x7  = VMACHI(x7,  u, vp2); 
+  y6  = VMACLO(y6,  v, vp2); y7  = VMACHI(y7,  v, vp2); 
+  x7  = VMACLO(x7,  u, vp3); x8  = VMACHI(x8,  u, vp3); 
+  y7  = VMACLO(y7,  v, vp3); y8  = VMACHI(y8,  v, vp3); 
+  x8  = VMACLO(x8,  u, vp4); x9  = VMACHI(x9,  u, vp4); 
+  y8  = VMACLO(y8,  v, vp4); y9  = VMACHI(y9,  v, vp4); 
+  x9  = VMACLO(x9,  u, vp5); x10 = VMACHI(x10, u, vp5); 
+  y9  = VMACLO(y9,  v, vp5); y10 = VMACHI(y10, v, vp5); 
+  x10 = VMACLO(x10, u, vp6); x11 = VMACHI(x11, u, vp6); 
+  y10 = VMACLO(y10, v, vp6); y11 = VMACHI(y11, v, vp6); 
+  x11 = VMACLO(x11, u, vp7); x12 = VMACHI(x12, u, vp7); 
+  y11 = VMACLO(y11, v, vp7); y12 = VMACHI(y12, v, vp7); 
+  x12 = VMACLO(x12, u, vp8); x13 = VMACHI(x13, u, vp8); 
+  y12 = VMACLO(y12, v, vp8); y13 = VMACHI(y13, v, vp8); 
+  x13 = VMACLO(x13, u, vp9); x14 = VMACHI(x14, u, vp9); 
+  y13 = VMACLO(y13, v, vp9); y14 = VMACHI(y14, v, vp9); 
+  x5 = VADD(x5, VSHR(x4, HT_BRADIX)); y5 = VADD(y5, VSHR(y4, HT_BRADIX));
+
+  u = VMACLO(zero, x5, vw); v = VMACLO(zero, y5, vw);
+  x5  = VMACLO(x5,  u, vp0); x6  = VMACHI(x6,  u, vp0); 
+  y5  = VMACLO(y5,  v, vp0); y6  = VMACHI(y6,  v, vp0); 
+  x6  = VMACLO(x6,  u, vp1); x7  = VMACHI(x7,  u, vp1); 
+  y6  = VMACLO(y6,  v, vp1); y7  = VMACHI(y7,  v, vp1); 
+  x7  = VMACLO(x7,  u, vp2); x8  = VMACHI(x8,  u, vp2); 
+  y7  = VMACLO(y7,  v, vp2); y8  = VMACHI(y8,  v, vp2); 
+  x8  = VMACLO(x8,  u, vp3); x9  = VMACHI(x9,  u, vp3); 
+  y8  = VMACLO(y8,  v, vp3); y9  = VMACHI(y9,  v, vp3); 
+  x9  = VMACLO(x9,  u, vp4); x10 = VMACHI(x10, u, vp4); 
+  y9  = VMACLO(y9,  v, vp4); y10 = VMACHI(y10, v, vp4); 
+  x10 = VMACLO(x10, u, vp5); x11 = VMACHI(x11, u, vp5); 
+  y10 = VMACLO(y10, v, vp5); y11 = VMACHI(y11, v, vp5); 
+  x11 = VMACLO(x11, u, vp6); x12 = VMACHI(x12, u, vp6); 
+  y11 = VMACLO(y11, v, vp6); y12 = VMACHI(y12, v, vp6); 
+  x12 = VMACLO(x12, u, vp7); x13 = VMACHI(x13, u, vp7); 
+  y12 = VMACLO(y12, v, vp7); y13 = VMACHI(y13, v, vp7); 
+  x13 = VMACLO(x13, u, vp8); x14 = VMACHI(x14, u, vp8); 
+  y13 = VMACLO(y13, v, vp8); y14 = VMACHI(y14, v, vp8); 
+  x14 = VMACLO(x14, u, vp9); x15 = VMACHI(x15, u, vp9); 
+  y14 = VMACLO(y14, v, vp9); y15 = VMACHI(y15, v, vp9); 
+  x6 = VADD(x6, VSHR(x5, HT_BRADIX)); y6 = VADD(y6, VSHR(y5, HT_BRADIX));
+
+  u = VMACLO(zero, x6, vw); v = VMACLO(zero, y6, vw);
+  x6  = VMACLO(x6,  u, vp0); x7  = VMACHI(x7,  u, vp0); 
+  y6  = VMACLO(y6,  v, vp0); y7  = VMACHI(y7,  v, vp0); 
+  x7  = VMACLO(x7,  u, vp1); x8  = VMACHI(x8,  u, vp1); 
+  y7  = VMACLO(y7,  v, vp1); y8  = VMACHI(y8,  v, vp1); 
+  x8  = VMACLO(x8,  u, vp2); x9  = VMACHI(x9,  u, vp2); 
+  y8  = VMACLO(y8,  v, vp2); y9  = VMACHI(y9,  v, vp2); 
+  x9  = VMACLO(x9,  u, vp3); x10 = VMACHI(x10, u, vp3); 
+  y9  = VMACLO(y9,  v, vp3); y10 = VMACHI(y10, v, vp3); 
+  x10 = VMACLO(x10, u, vp4); x11 = VMACHI(x11, u, vp4); 
+  y10 = VMACLO(y10, v, vp4); y11 = VMACHI(y11, v, vp4); 
+  x11 = VMACLO(x11, u, vp5); x12 = VMACHI(x12, u, vp5); 
+  y11 = VMACLO(y11, v, vp5); y12 = VMACHI(y12, v, vp5); 
+  x12 = VMACLO(x12, u, vp6); x13 = VMACHI(x13, u, vp6); 
+  y12 = VMACLO(y12, v, vp6); y13 = VMACHI(y13, v, vp6); 
+  x13 = VMACLO(x13, u, vp7); x14 = VMACHI(x14, u, vp7); 
+  y13 = VMACLO(y13, v, vp7); y14 = VMACHI(y14, v, vp7); 
+  x14 = VMACLO(x14, u, vp8); x15 = VMACHI(x15, u, vp8); 
+  y14 = VMACLO(y14, v, vp8); y15 = VMACHI(y15, v, vp8); 
+  x15 = VMACLO(x15, u, vp9); x16 = VMACHI(x16, u, vp9); 
+  y15 = VMACLO(y15, v, vp9); y16 = VMACHI(y16, v, vp9); 
+  x7 = VADD(x7, VSHR(x6, HT_BRADIX)); y7 = VADD(y7, VSHR(y6, HT_BRADIX));
+
+  u = VMACLO(zero, x7, vw); v = VMACLO(zero, y7, vw);
+  x7  = VMACLO(x7,  u, vp0); x8  = VMACHI(x8,  u, vp0); 
+  y7  = VMACLO(y7,  v, vp0); y8  = VMACHI(y8,  v, vp0); 
+  x8  = VMACLO(x8,  u, vp1); x9  = VMACHI(x9,  u, vp1); 
+  y8  = VMACLO(y8,  v, vp1); y9  = VMACHI(y9,  v, vp1); 
+  x9  = VMACLO(x9,  u, vp2); x10 = VMACHI(x10, u, vp2); 
+  y9  = VMACLO(y9,  v, vp2); y10 = VMACHI(y10, v, vp2); 
+  x10 = VMACLO(x10, u, vp3); x11 = VMACHI(x11, u, vp3); 
+  y10 = VMACLO(y10, v, vp3); y11 = VMACHI(y11, v, vp3); 
+  x11 = VMACLO(x11, u, vp4); x12 = VMACHI(x12, u, vp4); 
+  y11 = VMACLO(y11, v, vp4); y12 = VMACHI(y12, v, vp4); 
+  x12 = VMACLO(x12, u, vp5); x13 = VMACHI(x13, u, vp5); 
+  y12 = VMACLO(y12, v, vp5); y13 = VMACHI(y13, v, vp5); 
+  x13 = VMACLO(x13, u, vp6); x14 = VMACHI(x14, u, vp6); 
+  y13 = VMACLO(y13, v, vp6); y14 = VMACHI(y14, v, vp6); 
+  x14 = VMACLO(x14, u, vp7); x15 = VMACHI(x15, u, vp7); 
+  y14 = VMACLO(y14, v, vp7); y15 = VMACHI(y15, v, vp7); 
+  x15 = VMACLO(x15, u, vp8); x16 = VMACHI(x16, u, vp8); 
+  y15 = VMACLO(y15, v, vp8); y16 = VMACHI(y16, v, vp8); 
+  x16 = VMACLO(x16, u, vp9); x17 = VMACHI(x17, u, vp9); 
+  y16 = VMACLO(y16, v, vp9); y17 = VMACHI(y17, v, vp9); 
+  x8 = VADD(x8, VSHR(x7, HT_BRADIX)); y8 = VADD(y8, VSHR(y7, HT_BRADIX));
+
+  u = VMACLO(zero, x8, vw); v = VMACLO(zero, y8, vw);
+  x8  = VMACLO(x8,  u, vp0); x9  = VMACHI(x9,  u, vp0); 
+  y8  = VMACLO(y8,  v, vp0); y9  = VMACHI(y9,  v, vp0); 
+  x9  = VMACLO(x9,  u, vp1); x10 = VMACHI(x10, u, vp1); 
+  y9  = VMACLO(y9,  v, vp1); y10 = VMACHI(y10, v, vp1); 
+  x10 = VMACLO(x10, u, vp2); x11 = VMACHI(x11, u, vp2); 
+  y10 = VMACLO(y10, v, vp2); y11 = VMACHI(y11, v, vp2); 
+  x11 = VMACLO(x11, u, vp3); x12 = VMACHI(x12, u, vp3); 
+  y11 = VMACLO(y11, v, vp3); y12 = VMACHI(y12, v, vp3); 
+  x12 = VMACLO(x12, u, vp4); x13 = VMACHI(x13, u, vp4); 
+  y12 = VMACLO(y12, v, vp4); y13 = VMACHI(y13, v, vp4); 
+  x13 = VMACLO(x13, u, vp5); x14 = VMACHI(x14, u, vp5); 
+  y13 = VMACLO(y13, v, vp5); y14 = VMACHI(y14, v, vp5); 
+  x14 = VMACLO(x14, u, vp6); x15 = VMACHI(x15, u, vp6); 
+  y14 = VMACLO(y14, v, vp6); y15 = VMACHI(y15, v, vp6); 
+  x15 = VMACLO(x15, u, vp7); x16 = VMACHI(x16, u, vp7); 
+  y15 = VMACLO(y15, v, vp7); y16 = VMACHI(y16, v, vp7); 
+  x16 = VMACLO(x16, u, vp8); x17 = VMACHI(x17, u, vp8); 
+  y16 = VMACLO(y16, v, vp8); y17 = VMACHI(y17, v, vp8); 
+  x17 = VMACLO(x17, u, vp9); x18 = VMACHI(x18, u, vp9); 
+  y17 = VMACLO(y17, v, vp9); y18 = VMACHI(y18, v, vp9); 
+  x9 = VADD(x9, VSHR(x8, HT_BRADIX)); y9 = VADD(y9, VSHR(y8, HT_BRADIX));
+
+  u = VMACLO(zero, x9, vw); v = VMACLO(zero, y9, vw);
+  x9  = VMACLO(x9,  u, vp0); x10 = VMACHI(x10, u, vp0); 
+  y9  = VMACLO(y9,  v, vp0); y10 = VMACHI(y10, v, vp0); 
+  x10 = VMACLO(x10, u, vp1); x11 = VMACHI(x11, u, vp1); 
+  y10 = VMACLO(y10, v, vp1); y11 = VMACHI(y11, v, vp1); 
+  x11 = VMACLO(x11, u, vp2); x12 = VMACHI(x12, u, vp2); 
+  y11 = VMACLO(y11, v, vp2); y12 = VMACHI(y12, v, vp2); 
+  x12 = VMACLO(x12, u, vp3); x13 = VMACHI(x13, u, vp3); 
+  y12 = VMACLO(y12, v, vp3); y13 = VMACHI(y13, v, vp3); 
+  x13 = VMACLO(x13, u, vp4); x14 = VMACHI(x14, u, vp4); 
+  y13 = VMACLO(y13, v, vp4); y14 = VMACHI(y14, v, vp4); 
+  x14 = VMACLO(x14, u, vp5); x15 = VMACHI(x15, u, vp5); 
+  y14 = VMACLO(y14, v, vp5); y15 = VMACHI(y15, v, vp5); 
+  x15 = VMACLO(x15, u, vp6); x16 = VMACHI(x16, u, vp6); 
+  y15 = VMACLO(y15, v, vp6); y16 = VMACHI(y16, v, vp6); 
+  x16 = VMACLO(x16, u, vp7); x17 = VMACHI(x17, u, vp7); 
+  y16 = VMACLO(y16, v, vp7); y17 = VMACHI(y17, v, vp7); 
+  x17 = VMACLO(x17, u, vp8); x18 = VMACHI(x18, u, vp8); 
+  y17 = VMACLO(y17, v, vp8); y18 = VMACHI(y18, v, vp8); 
+  x18 = VMACLO(x18, u, vp9); x19 = VMACHI(x19, u, vp9); 
+  y18 = VMACLO(y18, v, vp9); y19 = VMACHI(y19, v, vp9); 
+  x10 = VADD(x10, VSHR(x9, HT_BRADIX)); y10 = VADD(y10, VSHR(y9, HT_BRADIX));
+
+  // carry propagation
+  x11 = VADD(x11, VSHR(x10, HT_BRADIX)); x10 = VAND(x10, vbmask);
+  y11 = VADD(y11, VSHR(y10, HT_BRADIX)); y10 = VAND(y10, vbmask);
+  x12 = VADD(x12, VSHR(x11, HT_BRADIX)); x11 = VAND(x11, vbmask);
+  y12 = VADD(y12, VSHR(y11, HT_BRADIX)); y11 = VAND(y11, vbmask);
+  x13 = VADD(x13, VSHR(x12, HT_BRADIX)); x12 = VAND(x12, vbmask);
+  y13 = VADD(y13, VSHR(y12, HT_BRADIX)); y12 = VAND(y12, vbmask);
+  x14 = VADD(x14, VSHR(x13, HT_BRADIX)); x13 = VAND(x13, vbmask);
+  y14 = VADD(y14, VSHR(y13, HT_BRADIX)); y13 = VAND(y13, vbmask);
+  x15 = VADD(x15, VSHR(x14, HT_BRADIX)); x14 = VAND(x14, vbmask);
+  y15 = VADD(y15, VSHR(y14, HT_BRADIX)); y14 = VAND(y14, vbmask);
+  x16 = VADD(x16, VSHR(x15, HT_BRADIX)); x15 = VAND(x15, vbmask);
+  y16 = VADD(y16, VSHR(y15, HT_BRADIX)); y15 = VAND(y15, vbmask);
+  x17 = VADD(x17, VSHR(x16, HT_BRADIX)); x16 = VAND(x16, vbmask);
+  y17 = VADD(y17, VSHR(y16, HT_BRADIX)); y16 = VAND(y16, vbmask);
+  x18 = VADD(x18, VSHR(x17, HT_BRADIX)); x17 = VAND(x17, vbmask);
+  y18 = VADD(y18, VSHR(y17, HT_BRADIX)); y17 = VAND(y17, vbmask);
+  x19 = VADD(x19, VSHR(x18, HT_BRADIX)); x18 = VAND(x18, vbmask);
+  y19 = VADD(y19, VSHR(y18, HT_BRADIX)); y18 = VAND(y18, vbmask);
+
+  r[0] = x10; r[1] = x11; r[2] = x12; r[3] = x13; r[4] = x14; 
+  r[5] = x15; r[6] = x16; r[7] = x17; r[8] = x18; r[9] = x19;  
+  s[0] = y10; s[1] = y11; s[2] = y12; s[3] = y13; s[4] = y14; 
+  s[5] = y15; s[6] = y16; s[7] = y17; s[8] = y18; s[9] = y19;  
+}
+
+// fused multiply-add r = a * b + c * d mod 2p
+// a, b, c, d in [0, 2p) -> r in [0, 2p)
+void gfp_muladd_8x1w(htfe_t r, const htfe_t a, const htfe_t b, const htfe_t c, const htfe_t d)
+{
+  __m512i x[2*HT_NWORDS], y[2*HT_NWORDS];
+  int i;
+
+  gfp_mulnr_8x1w(x, a, b);              // x = a * b
+  gfp_mulnr_8x1w(y, c, d);              // y = c * d
+  for (i = 0; i < 2*HT_NWORDS; i++) x[i] = VADD(x[i], y[i]);
+  gfp_redc_8x1w(r, x);                  // r = (a * b + c * d) * R^-1 mod 2p
+}
+
+// fused multiply-subtract r = a * b - c * d mod 2p
+// a, b, c, d in [0, 2p) -> r in [0, 2p)
+void gfp_mulsub_8x1w(htfe_t r, const htfe_t a, const htfe_t b, const htfe_t c, const htfe_t d)
+{
+  __m512i x[2*HT_NWORDS], y[2*HT_NWORDS];
+  int i;
+
+  gfp_mulnr_8x1w(x, a, b);              // x = a * b
+  gfp_mulnr_8x1w(y, c, d);              // y = c * d
+  // x = a * b - c * d + p * 2^516, every column stays non-negative
+  for (i = 0; i < 2*HT_NWORDS; i++) x[i] = VSUB(VADD(x[i], VSET1(ht_pbias[i])), y[i]);
+  gfp_redc_8x1w(r, x);                  // r = (a * b - c * d) * R^-1 mod 2p
+}
+
+// fused multiply-add-subtract r = a * b + c * d, s = a * b - c * d mod 2p
+// both products are computed only once; r and s may alias any of a, b, c, d
+// a, b, c, d in [0, 2p) -> r, s in [0, 2p)
+void gfp_muladdsub_8x1w(htfe_t r, htfe_t s, const htfe_t a, const htfe_t b, const htfe_t c, const htfe_t d)
+{
+  __m512i x[2*HT_NWORDS], y[2*HT_NWORDS], t;
+  int i;
+
+  gfp_mulnr_8x1w(x, a, b);              // x = a * b
+  gfp_mulnr_8x1w(y, c, d);              // y = c * d
+  for (i = 0; i < 2*HT_NWORDS; i++) {
+    t = y[i];
+    y[i] = VSUB(VADD(x[i], VSET1(ht_pbias[i])), t);
+    x[i] = VADD(x[i], t);
+  }
+  gfp_redc2_8x1w(r, s, x, y);           // r = (a * b + c * d) * R^-1 mod 2p
+                                        // s = (a * b - c * d) * R^-1 mod 2p
+}
+
+// inner product r = a[0] * b[0] + ... + a[n-1] * b[n-1] mod 2p with a single
+// Montgomery reduction; the columns are normalized after every third product 
+// so that they stay below 2^59 
+// a[i], b[i] in [0, 2p), 1 <= n <= 128 -> r in [0, 2p)
+void gfp_dotp_8x1w(htfe_t r, const htfe_t *a, const htfe_t *b, const int n)
+{
+  __m512i x[2*HT_NWORDS], y[2*HT_NWORDS];
+  const __m512i vbmask = VSET1(HT_BMASK);
+  int i, j;
+
+  gfp_mulnr_8x1w(x, a[0], b[0]);        // x = a[0] * b[0]
+  for (i = 1; i < n; i++) {
+    if (!(i % 3)) {
+      for (j = 0; j < 2*HT_NWORDS-1; j++) {
+        x[j+1] = VADD(x[j+1], VSHR(x[j], HT_BRADIX));
+        x[j] = VAND(x[j], vbmask);
+      }
+    }
+    gfp_mulnr_8x1w(y, a[i], b[i]);      // x = x + a[i] * b[i]
+    for (j = 0; j < 2*HT_NWORDS; j++) x[j] = VADD(x[j], y[j]);
+  }
+  gfp_redc_8x1w(r, x);                  // r = x * R^-1 mod 2p
+}
+
+// inner product r = a[0] * b[n-1] + a[1] * b[n-2] + ... + a[n-1] * b[0] mod 2p,
+// as gfp_dotp_8x1w with b reversed (a coefficient of a polynomial product)
+// a[i], b[i] in [0, 2p), 1 <= n <= 128 -> r in [0, 2p)
+void gfp_dotpr_8x1w(htfe_t r, const htfe_t *a, const htfe_t *b, const int n)
+{
+  __m512i x[2*HT_NWORDS], y[2*HT_NWORDS];
+  const __m512i vbmask = VSET1(HT_BMASK);
+  int i, j;
+
+  gfp_mulnr_8x1w(x, a[0], b[n-1]);      // x = a[0] * b[n-1]
+  for (i = 1; i < n; i++) {
+    if (!(i % 3)) {
+      for (j = 0; j < 2*HT_NWORDS-1; j++) {
+        x[j+1] = VADD(x[j+1], VSHR(x[j], HT_BRADIX));
+        x[j] = VAND(x[j], vbmask);
+      }
+    }
+    gfp_mulnr_8x1w(y, a[i], b[n-1-i]);  // x = x + a[i] * b[n-1-i]
+    for (j = 0; j < 2*HT_NWORDS; j++) x[j] = VADD(x[j], y[j]);
+  }
+  gfp_redc_8x1w(r, x);                  // r = x * R^-1 mod 2p
 }
 
 // field exponentiation r = a^e mod 2p
@@ -693,11 +2940,31 @@ void gfp_pow_8x1w(htfe_t r, const htfe_t a, const uint64_t *e)
   }
 }
 
+// field exponentiation r = a^e mod 2p with a fixed sliding-window chain of e
+// the chain c of n steps is a *public* parameter and is the *same* for all 8 instances
+// -> r in [0, 2p)
+void gfp_powchn_8x1w(htfe_t r, const htfe_t a, const uint8_t (*c)[2], const int n)
+{
+  htfe_t t[EXP_WINTBL], a2;
+  int i, j;
+
+  // precompute t[k] = a^(2k+1)
+  gfp_copy_8x1w(t[0], a);
+  gfp_sqr_8x1w(a2, a);
+  for (i = 1; i < EXP_WINTBL; i++) gfp_mul_8x1w(t[i], t[i-1], a2);
+
+  gfp_copy_8x1w(r, t[c[0][1]]);
+  for (i = 1; i < n; i++) {
+    for (j = 0; j < c[i][0]; j++) gfp_sqr_8x1w(r, r);
+    gfp_mul_8x1w(r, r, t[c[i][1]]);
+  }
+}
+
 // field multiplicative inversion r = a^(-1) = a^(p-2) mod 2p
 // -> r in [0, 2p)
 void gfp_inv_8x1w(htfe_t r, const htfe_t a)
 {
-  gfp_pow_8x1w(r, a, u64_psub2);
+  gfp_powchn_8x1w(r, a, psub2_chain, EXP_CHNLEN);
 }
 
 // reduce the field element from [0, 2p) to [0, p)
@@ -757,6 +3024,29 @@ void gfp_rdcp_8x1w(htfe_t r, const htfe_t a)
   r[5] = r5; r[6] = r6; r[7] = r7; r[8] = r8; r[9] = r9; 
 }
 
+// a complete (signed) carry propagation to make r strictly radix-52 
+// this does not change the value of r, in particular its bound [0, kp)
+void gfp_carryp_8x1w(htfe_t r)
+{
+  __m512i r0 = r[0], r1 = r[1], r2 = r[2], r3 = r[3], r4 = r[4];
+  __m512i r5 = r[5], r6 = r[6], r7 = r[7], r8 = r[8], r9 = r[9];
+  const __m512i vbmask = VSET1(HT_BMASK);
+
+  // carry propagation
+  r1 = VADD(r1, VSRA(r0, HT_BRADIX)); r0 = VAND(r0, vbmask);
+  r2 = VADD(r2, VSRA(r1, HT_BRADIX)); r1 = VAND(r1, vbmask);
+  r3 = VADD(r3, VSRA(r2, HT_BRADIX)); r2 = VAND(r2, vbmask);
+  r4 = VADD(r4, VSRA(r3, HT_BRADIX)); r3 = VAND(r3, vbmask);
+  r5 = VADD(r5, VSRA(r4, HT_BRADIX)); r4 = VAND(r4, vbmask);
+  r6 = VADD(r6, VSRA(r5, HT_BRADIX)); r5 = VAND(r5, vbmask);
+  r7 = VADD(r7, VSRA(r6, HT_BRADIX)); r6 = VAND(r6, vbmask);
+  r8 = VADD(r8, VSRA(r7, HT_BRADIX)); r7 = VAND(r7, vbmask);
+  r9 = VADD(r9, VSRA(r8, HT_BRADIX)); r8 = VAND(r8, vbmask);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4;  
+  r[5] = r5; r[6] = r6; r[7] = r7; r[8] = r8; r[9] = r9; 
+}
+
 // set the field element r to be 0
 // -> r = 0
 void gfp_zero_8x1w(htfe_t r)
@@ -864,10 +3154,10 @@ void gfp_cswap_8x1w(htfe_t r, htfe_t a, const __m512i b)
   a[5] = a5; a[6] = a6; a[7] = a7; a[8] = a8; a[9] = a9;
 }
 
-// check whether the field element is a square in the field  
+// check whether the field element is a square in the field with Euler's criterion
 // if a is     a square in the field, return 1; 
 // if a is not a square in the field, return 0.
-__m512i gfp_issqr_8x1w(const htfe_t a)
+__m512i gfp_euler_8x1w(const htfe_t a)
 {  
   htfe_t t0, t1;
   __m512i r = VZERO;
@@ -876,7 +3166,7 @@ __m512i gfp_issqr_8x1w(const htfe_t a)
   // compute r = a^((p-1)/2) - 1 
   // r is 0 if a is a square; r is non-0 if a is not a square
   gfp_copy_8x1w(t0, a);                 // t0 = a
-  gfp_pow_8x1w(t1, t0, u64_pdiv2);      // t1 = a^((p-1)/2)
+  gfp_powchn_8x1w(t1, t0, pdiv2_chain, EXP_CHNLEN); // t1 = a^((p-1)/2)
   gfp_rdcp_8x1w(t1, t1);                // t1 in [0, p) and strictly radix-52 now 
   for (i = 0; i < HT_NWORDS; i++)       // r = t1 - 1
     r = VOR(r, VSUB(t1[i], VSET1(ht_montR[i])));
@@ -915,6 +3205,350 @@ __m512i gfp_iszero_8x1w(const htfe_t a)
   return t;
 }
 
+// -----------------------------------------------------------------------------
+// (8x1)-way constant-time safegcd inversion [BY19] 
+// f, g, d, e are *signed* radix-SG_BRADIX integers with SG_NWORDS limbs, the 
+// lower limbs are in [0, 2^SG_BRADIX) and the top limb carries the sign
+
+// SG_BRADIX divsteps on the lowest limbs of f and g 
+// -> the transition matrix t = (u, v, q, r) scaled by 2^SG_BRADIX, and new delta
+static __m512i gfp_divsteps_8x1w(__m512i *t, __m512i delta, __m512i f, __m512i g)
+{
+  __m512i u = VSET1(1), v = VZERO, q = VZERO, r = VSET1(1), x;
+  const __m512i one = VSET1(1);
+  __mmask8 c;
+  int i;
+
+  for (i = 0; i < SG_BRADIX; i++) {
+    // if delta > 0 and g is odd: (delta, f, g, u, v, q, r) = (-delta, g, -f, q, r, -u, -v) 
+    c = VCMPGT(delta, VZERO) & VTEST(g, one);
+    delta = VMSUB(delta, c, VZERO, delta);
+    x = f; f = VMMOV(f, c, g); g = VMSUB(g, c, VZERO, x);
+    x = u; u = VMMOV(u, c, q); q = VMSUB(q, c, VZERO, x);
+    x = v; v = VMMOV(v, c, r); r = VMSUB(r, c, VZERO, x);
+    // if g is odd: (g, q, r) = (g + f, q + u, r + v)
+    c = VTEST(g, one);
+    g = VMADD(g, c, g, f); q = VMADD(q, c, q, u); r = VMADD(r, c, r, v);
+    // (delta, g, u, v) = (delta + 1, g/2, 2u, 2v)
+    delta = VADD(delta, one); g = VSRA(g, 1); u = VSHL(u, 1); v = VSHL(v, 1);
+  }
+
+  t[0] = u; t[1] = v; t[2] = q; t[3] = r;
+
+  return delta;
+}
+
+// (f, g) = (u*f + v*g, q*f + r*g) / 2^SG_BRADIX
+// |u| + |v| <= 2^SG_BRADIX and |q| + |r| <= 2^SG_BRADIX, the division is exact
+static void gfp_updatefg_8x1w(__m512i *f, __m512i *g, const __m512i *t)
+{
+  const __m512i u = t[0], v = t[1], q = t[2], r = t[3];
+  const __m512i vbmask = VSET1(SG_BMASK);
+  __m512i cf, cg;
+  int i;
+
+  cf = VADD(VMULS(u, f[0]), VMULS(v, g[0]));
+  cg = VADD(VMULS(q, f[0]), VMULS(r, g[0]));
+  cf = VSRA(cf, SG_BRADIX); cg = VSRA(cg, SG_BRADIX);
+
+  for (i = 1; i < SG_NWORDS; i++) {
+    cf = VADD(cf, VADD(VMULS(u, f[i]), VMULS(v, g[i])));
+    cg = VADD(cg, VADD(VMULS(q, f[i]), VMULS(r, g[i])));
+    f[i-1] = VAND(cf, vbmask); cf = VSRA(cf, SG_BRADIX);
+    g[i-1] = VAND(cg, vbmask); cg = VSRA(cg, SG_BRADIX);
+  }
+
+  f[SG_NWORDS-1] = cf; g[SG_NWORDS-1] = cg;
+}
+
+// (d, e) = (u*d + v*e, q*d + r*e) / 2^SG_BRADIX mod p
+// d, e in (-2p, p) -> d, e in (-2p, p)
+static void gfp_updatede_8x1w(__m512i *d, __m512i *e, const __m512i *t, const __m512i *vp)
+{
+  const __m512i u = t[0], v = t[1], q = t[2], r = t[3];
+  const __m512i vbmask = VSET1(SG_BMASK), vpinv = VSET1(SG_PINV);
+  __m512i cd, ce, md, me, sd, se;
+  int i;
+
+  // md, me are chosen such that (u*d + v*e + md*p) and (q*d + r*e + me*p) are
+  // divisible by 2^SG_BRADIX, and the results remain in (-2p, p) 
+  sd = VSRA(d[SG_NWORDS-1], 63); se = VSRA(e[SG_NWORDS-1], 63);
+  md = VADD(VAND(u, sd), VAND(v, se));
+  me = VADD(VAND(q, sd), VAND(r, se));
+
+  cd = VADD(VMULS(u, d[0]), VMULS(v, e[0]));
+  ce = VADD(VMULS(q, d[0]), VMULS(r, e[0]));
+  md = VSUB(md, VAND(VADD(VMUL(vpinv, cd), md), vbmask));
+  me = VSUB(me, VAND(VADD(VMUL(vpinv, ce), me), vbmask));
+  cd = VADD(cd, VMULS(vp[0], md)); 
+  ce = VADD(ce, VMULS(vp[0], me));
+  cd = VSRA(cd, SG_BRADIX); ce = VSRA(ce, SG_BRADIX);
+
+  for (i = 1; i < SG_NWORDS; i++) {
+    cd = VADD(cd, VADD(VADD(VMULS(u, d[i]), VMULS(v, e[i])), VMULS(vp[i], md)));
+    ce = VADD(ce, VADD(VADD(VMULS(q, d[i]), VMULS(r, e[i])), VMULS(vp[i], me)));
+    d[i-1] = VAND(cd, vbmask); cd = VSRA(cd, SG_BRADIX);
+    e[i-1] = VAND(ce, vbmask); ce = VSRA(ce, SG_BRADIX);
+  }
+
+  d[SG_NWORDS-1] = cd; e[SG_NWORDS-1] = ce;
+}
+
+// signed carry propagation, the top limb carries the sign
+static void gfp_carrysg_8x1w(__m512i *a)
+{
+  const __m512i vbmask = VSET1(SG_BMASK);
+  int i;
+
+  for (i = 0; i < SG_NWORDS-1; i++) {
+    a[i+1] = VADD(a[i+1], VSRA(a[i], SG_BRADIX));
+    a[i] = VAND(a[i], vbmask);
+  }
+}
+
+// field multiplicative inversion r = a^(-1) mod p with safegcd [BY19]
+// a is in Montgomery domain, e starts from R^2 so that r = (a*R^(-1))^(-1)*R 
+// a in [0, 2p) -> r in [0, p)
+void gfp_sginv_8x1w(htfe_t r, const htfe_t a)
+{
+  __m512i f[SG_NWORDS], g[SG_NWORDS], d[SG_NWORDS], e[SG_NWORDS];
+  __m512i vp[SG_NWORDS], t[4], delta = VSET1(1), s;
+  htfe_t b;
+  int i;
+
+  gfp_rdcp_8x1w(b, a);                  // g < f = p is required by the bound
+
+  // f = p, g = a, d = 0, e = R^2 in radix-26 (each radix-52 limb is split into two)
+  for (i = 0; i < HT_NWORDS; i++) {
+    vp[2*i] = VSET1(ht_p[i]&SG_BMASK); vp[2*i+1] = VSET1(ht_p[i]>>SG_BRADIX);
+    e[2*i]  = VSET1(ht_montR2[i]&SG_BMASK); e[2*i+1] = VSET1(ht_montR2[i]>>SG_BRADIX);
+    g[2*i]  = VAND(b[i], VSET1(SG_BMASK)); g[2*i+1] = VSHR(b[i], SG_BRADIX);
+    f[2*i]  = vp[2*i]; f[2*i+1] = vp[2*i+1];
+    d[2*i]  = VZERO; d[2*i+1] = VZERO;
+  }
+
+  // SG_NITERS*SG_BRADIX divsteps are enough for 511-bit f and g 
+  for (i = 0; i < SG_NITERS; i++) {
+    delta = gfp_divsteps_8x1w(t, delta, f[0], g[0]);
+    gfp_updatefg_8x1w(f, g, t);
+    gfp_updatede_8x1w(d, e, t, vp);
+  }
+
+  // now g = 0, f = +/-1 and d = +/-a^(-1) in (-2p, p)
+  s = VSRA(d[SG_NWORDS-1], 63);         // d = d + p if d < 0 
+  for (i = 0; i < SG_NWORDS; i++) d[i] = VADD(d[i], VAND(vp[i], s));
+  gfp_carrysg_8x1w(d);
+  s = VSRA(f[SG_NWORDS-1], 63);         // d = -d if f = -1 
+  for (i = 0; i < SG_NWORDS; i++) d[i] = VSUB(VXOR(d[i], s), s);
+  gfp_carrysg_8x1w(d);
+  s = VSRA(d[SG_NWORDS-1], 63);         // d = d + p if d < 0
+  for (i = 0; i < SG_NWORDS; i++) d[i] = VADD(d[i], VAND(vp[i], s));
+  gfp_carrysg_8x1w(d);
+  // radix-26 to radix-52
+  for (i = 0; i < HT_NWORDS; i++) r[i] = VADD(d[2*i], VSHL(d[2*i+1], SG_BRADIX));
+}
+
+// (8x1)-way constant-time Jacobi symbol with the optimized binary GCD [Por20]
+// a and b are non-negative radix-SG_BRADIX integers with SG_NWORDS limbs, b is
+// odd; each inner step is "if a is odd: if a < b: swap a and b; a = a - b", 
+// then "a = a/2", and 2*len(p)-1 steps bring (a, b) to (0, gcd(a, b))
+
+// approximations xa, xb of a, b for SG_BRADIX inner steps: with n = max(len(a),
+// len(b), 2*SG_BRADIX+2), the low SG_BRADIX bits are exact and the top 
+// SG_BRADIX+2 bits are the bits [n-SG_BRADIX-2, n) of a and b
+static void gfp_bgcdapprox_8x1w(__m512i *xa, __m512i *xb, const __m512i *a, const __m512i *b)
+{
+  const __m512i vbmask = VSET1(SG_BMASK);
+  __m512i wa, wb, m, x;
+  __mmask8 c;
+  int i, k;
+
+  // 64-bit windows of a and b whose top limb is the highest non-zero limb of 
+  // a|b, the sentinel bit 2*SG_BRADIX+1 stands for n >= 2*SG_BRADIX+2
+  wa = VOR(VOR(VSHL(a[2], 64-SG_BRADIX), VSHL(a[1], 64-2*SG_BRADIX)), VSHR(a[0], 3*SG_BRADIX-64));
+  wb = VOR(VOR(VSHL(b[2], 64-SG_BRADIX), VSHL(b[1], 64-2*SG_BRADIX)), VSHR(b[0], 3*SG_BRADIX-64));
+  m  = VSET1(1ULL<<(65-SG_BRADIX));
+  for (i = 3; i < SG_NWORDS; i++) {
+    x = VOR(a[i], b[i]); c = VTEST(x, x);
+    x = VOR(VOR(VSHL(a[i], 64-SG_BRADIX), VSHL(a[i-1], 64-2*SG_BRADIX)), VSHR(a[i-2], 3*SG_BRADIX-64));
+    wa = VMMOV(wa, c, x);
+    x = VOR(VOR(VSHL(b[i], 64-SG_BRADIX), VSHL(b[i-1], 64-2*SG_BRADIX)), VSHR(b[i-2], 3*SG_BRADIX-64));
+    wb = VMMOV(wb, c, x);
+    m  = VMMOV(m, c, VZERO);
+  }
+
+  // shift the windows left by the leading zeros of wa|wb|m (at most SG_BRADIX-1)
+  m = VOR(m, VOR(wa, wb));
+  for (k = 16; k > 0; k >>= 1) {
+    c = ~VTEST(m, VSET1(~0ULL<<(64-k)));
+    m = VMMOV(m, c, VSHL(m, k)); wa = VMMOV(wa, c, VSHL(wa, k)); wb = VMMOV(wb, c, VSHL(wb, k));
+  }
+
+  *xa = VOR(VAND(a[0], vbmask), VSHL(VSHR(wa, 62-SG_BRADIX), SG_BRADIX));
+  *xb = VOR(VAND(b[0], vbmask), VSHL(VSHR(wb, 62-SG_BRADIX), SG_BRADIX));
+}
+
+// SG_BRADIX inner steps on the approximations xa, xb and on the exact low 64 
+// bits la, lb of a, b 
+// -> the update matrix t = (f0, g0, f1, g1) scaled by 2^SG_BRADIX, and the sign
+//    flips of the Jacobi symbol (a/|b|) accumulated in bit 1 of *j
+static void gfp_bgcdsteps_8x1w(__m512i *t, __m512i *j, __m512i xa, __m512i xb, __m512i la, __m512i lb)
+{
+  __m512i f0 = VSET1(1), g0 = VZERO, f1 = VZERO, g1 = VSET1(1), x, jac = *j;
+  const __m512i one = VSET1(1);
+  __mmask8 c, o;
+  int i;
+
+  for (i = 0; i < SG_BRADIX; i++) {
+    // if a is odd and xa < xb: (a, b, f0, g0, f1, g1) = (b, a, f1, g1, f0, g0)
+    // (b/|a|) = -(a/|b|) if a = b = 3 mod 4 (a and b are never both negative)
+    o = VTEST(la, one);
+    c = o & VCMPGT(xb, xa);
+    x = xa; xa = VMMOV(xa, c, xb); xb = VMMOV(xb, c, x);
+    x = la; la = VMMOV(la, c, lb); lb = VMMOV(lb, c, x);
+    x = f0; f0 = VMMOV(f0, c, f1); f1 = VMMOV(f1, c, x);
+    x = g0; g0 = VMMOV(g0, c, g1); g1 = VMMOV(g1, c, x);
+    jac = VMXOR(jac, c, jac, VAND(la, lb));
+    // if a is odd: (a, f0, g0) = (a - b, f0 - f1, g0 - g1)
+    xa = VMSUB(xa, o, xa, xb); la = VMSUB(la, o, la, lb);
+    f0 = VMSUB(f0, o, f0, f1); g0 = VMSUB(g0, o, g0, g1);
+    // (a, f1, g1) = (a/2, 2f1, 2g1)
+    // (a/2 / |b|) = -(a/|b|) if b = 3, 5 mod 8
+    xa = VSHR(xa, 1); la = VSHR(la, 1); f1 = VSHL(f1, 1); g1 = VSHL(g1, 1);
+    jac = VXOR(jac, VXOR(lb, VSHR(lb, 1)));
+  }
+
+  t[0] = f0; t[1] = g0; t[2] = f1; t[3] = g1; *j = jac;
+}
+
+// Jacobi symbol (a/b) of the non-negative radix-SG_BRADIX integers a and b (odd)
+// with gcd(a, b) = 1, a and b are destroyed and end as (0, 1) after JC_NITERS 
+// iterations, the bound is proven in [Por20]
+// if (a/b) = 1, return 1; if (a/b) = -1, return 0.
+static __m512i gfp_jacobisg_8x1w(__m512i *a, __m512i *b)
+{
+  __m512i t[4], j = VZERO, xa, xb, la, lb, s;
+  int i, k;
+
+  for (i = 0; i < JC_NITERS; i++) {
+    gfp_bgcdapprox_8x1w(&xa, &xb, a, b);
+    la = VOR(VOR(a[0], VSHL(a[1], SG_BRADIX)), VSHL(a[2], 2*SG_BRADIX));
+    lb = VOR(VOR(b[0], VSHL(b[1], SG_BRADIX)), VSHL(b[2], 2*SG_BRADIX));
+    gfp_bgcdsteps_8x1w(t, &j, xa, xb, la, lb);
+    gfp_updatefg_8x1w(a, b, t);
+    // (a, b) = (|a|, |b|), (-a/|b|) = -(a/|b|) if |b| = 3 mod 4
+    s = VSRA(b[SG_NWORDS-1], 63);
+    for (k = 0; k < SG_NWORDS; k++) b[k] = VSUB(VXOR(b[k], s), s);
+    gfp_carrysg_8x1w(b);
+    s = VSRA(a[SG_NWORDS-1], 63);
+    for (k = 0; k < SG_NWORDS; k++) a[k] = VSUB(VXOR(a[k], s), s);
+    gfp_carrysg_8x1w(a);
+    j = VXOR(j, VAND(s, b[0]));
+  }
+
+  // now b = 1, so the symbol is given by bit 1 of j
+  j = VSHR(VAND(j, VSET1(2)), 1);       // j is 0 (symbol 1) or 1 (symbol -1)
+
+  return VXOR(j, VSET1(1));
+}
+
+// check whether the field element is a square in the field with the Jacobi
+// symbol computed by the optimized binary GCD, zero is not a square as in 
+// Euler's criterion
+// if a is     a square in the field, return 1; 
+// if a is not a square in the field, return 0.
+__m512i gfp_jacobi_8x1w(const htfe_t a)
+{
+  __m512i x[SG_NWORDS], y[SG_NWORDS], r;
+  htfe_t b;
+  int i;
+
+  gfp_rdcp_8x1w(b, a);                  // R = 2^k with even k, so (aR/p) = (a/p) 
+
+  // x = a, y = p in radix-26 (each radix-52 limb is split into two)
+  for (i = 0; i < HT_NWORDS; i++) {
+    x[2*i] = VAND(b[i], VSET1(SG_BMASK)); x[2*i+1] = VSHR(b[i], SG_BRADIX);
+    y[2*i] = VSET1(ht_p[i]&SG_BMASK); y[2*i+1] = VSET1(ht_p[i]>>SG_BRADIX);
+  }
+
+  r = gfp_jacobisg_8x1w(x, y);
+
+  return VAND(r, VXOR(gfp_iszero_8x1w(b), VSET1(1)));
+}
+
+// check whether the field element is a square in the field  
+// if a is     a square in the field, return 1; 
+// if a is not a square in the field, return 0.
+__m512i gfp_issqr_8x1w(const htfe_t a)
+{
+#ifdef ISSQR_JACOBI
+  return gfp_jacobi_8x1w(a);
+#else
+  return gfp_euler_8x1w(a);
+#endif
+}
+
+// handover to the (2x4)-way component, still one field element per lane: 
+// r = a * 2^516/2^520 mod 2p in LL_NWORDS radix-43 limbs, i.e., the Montgomery
+// domain changes from R' = 2^520 to R = 2^516 by a single multiplication 
+void gfp_ht2ll_8x1w(__m512i *r, const htfe_t a)
+{
+  const __m512i vbmask = VSET1(LL_BMASK);
+  htfe_t c, t;
+  int i, j, k;
+
+  for (i = 0; i < HT_NWORDS; i++) c[i] = VSET1(ht_ht2ll[i]);
+  gfp_mul_8x1w(t, a, c);                // t = a * R/R' mod 2p, strictly radix-52
+
+  // limb i of r holds the bits [43i, 43i+43) of t 
+  for (i = 0; i < LL_NWORDS; i++) {
+    j = (LL_BRADIX*i) / HT_BRADIX;
+    k = (LL_BRADIX*i) % HT_BRADIX;
+    r[i] = VSHR(t[j], k);
+    if ((k + LL_BRADIX > HT_BRADIX) && (j+1 < HT_NWORDS)) 
+      r[i] = VOR(r[i], VSHL(t[j+1], HT_BRADIX-k));
+    r[i] = VAND(r[i], vbmask);
+  }
+}
+
+// handover back from the (2x4)-way component: a has LL_NWORDS radix-43 limbs 
+// per lane, not necessarily carried, in the Montgomery domain R = 2^516;
+// r = a * 2^520/2^516 mod 2p 
+void gfp_ll2ht_8x1w(htfe_t r, const __m512i *a)
+{
+  const __m512i vbmask = VSET1(LL_BMASK), hbmask = VSET1(HT_BMASK);
+  __m512i t[LL_NWORDS], smask;
+  htfe_t c;
+  int i, j, k;
+
+  // carry propagation; add p if a is negative 
+  for (i = 0; i < LL_NWORDS; i++) t[i] = a[i];
+  for (i = 0; i < LL_NWORDS-1; i++) {
+    t[i+1] = VADD(t[i+1], VSRA(t[i], LL_BRADIX));
+    t[i] = VAND(t[i], vbmask);
+  }
+  smask = VSRA(t[LL_NWORDS-1], 63);
+  for (i = 0; i < LL_NWORDS; i++) t[i] = VADD(t[i], VAND(VSET1(ll_p[i]), smask));
+  for (i = 0; i < LL_NWORDS-1; i++) {
+    t[i+1] = VADD(t[i+1], VSHR(t[i], LL_BRADIX));
+    t[i] = VAND(t[i], vbmask);
+  }
+
+  // limb i of r holds the bits [52i, 52i+52) of t
+  for (i = 0; i < HT_NWORDS; i++) {
+    j = (HT_BRADIX*i) / LL_BRADIX;
+    k = (HT_BRADIX*i) % LL_BRADIX;
+    r[i] = VSHR(t[j], k);
+    if (j+1 < LL_NWORDS) r[i] = VOR(r[i], VSHL(t[j+1], LL_BRADIX-k));
+    if ((2*LL_BRADIX-k < HT_BRADIX) && (j+2 < LL_NWORDS)) 
+      r[i] = VOR(r[i], VSHL(t[j+2], 2*LL_BRADIX-k));
+    if (i < HT_NWORDS-1) r[i] = VAND(r[i], hbmask);
+  }
+
+  for (i = 0; i < HT_NWORDS; i++) c[i] = VSET1(ht_ll2ht[i]);
+  gfp_mul_8x1w(r, r, c);                // r = a * R'/R mod 2p
+}
+
 // -----------------------------------------------------------------------------
 // (2x4)-way prime-field operations 
 
@@ -1585,11 +4219,46 @@ void gfp_pow_2x4w(llfe_t r, const llfe_t a, const uint64_t *e)
   gfp_carryp_2x4w(r);                   // make r strictly radix-43
 }
 
+// field exponentiation r = a^e mod 2p with a fixed sliding-window chain of e
+// the chain c of n steps is a *public* parameter
+// the odd powers are precomputed in pairs t[k] = a^(4k+3) | a^(4k+1)
+// -> r in [0, 2p)
+void gfp_powchn_2x4w(llfe_t r, const llfe_t a, const uint8_t (*c)[2], const int n)
+{
+  llfe_t t[EXP_WINTBL/2], z0, z1, z2;
+  int i, j;
+
+  vec_permzl_2x4w(z0, a);               // z0 = 0   | a
+  gfp_sqr_2x4w(z1, z0);                 // z1 = 0   | a^2
+  gfp_mul_2x4w(z2, z0, z1);             // z2 = 0   | a^3
+  vec_permlh_2x4w(z2, z2);              // z2 = a^3 | 0
+  vec_blend_2x4w(t[0], z2, z0, 0x0F);   // t0 = a^3 | a
+  vec_permll_2x4w(z1, z1);              // z1 = a^2 | a^2
+  gfp_sqr_2x4w(z1, z1);                 // z1 = a^4 | a^4
+  for (i = 1; i < EXP_WINTBL/2; i++) gfp_mul_2x4w(t[i], t[i-1], z1);
+
+  // only the low half of r is meaningful in the main loop
+  // if-else statement is based on the public parameter
+  if (c[0][1]&1) vec_permhh_2x4w(r, t[c[0][1]>>1]);
+  else gfp_copy_2x4w(r, t[c[0][1]>>1]);
+  for (i = 1; i < n; i++) {
+    for (j = 0; j < c[i][0]; j++) gfp_sqr_2x4w(r, r);
+    if (c[i][1]&1) {
+      vec_permhh_2x4w(z0, t[c[i][1]>>1]);
+      gfp_mul_2x4w(r, r, z0);
+    }
+    else gfp_mul_2x4w(r, r, t[c[i][1]>>1]);
+  }
+
+  vec_permzl_2x4w(r, r);                // r = 0 | a^e
+  gfp_carryp_2x4w(r);                   // make r strictly radix-43
+}
+
 // field multiplicative inversion r = a^(-1) = a^(p-2) mod 2p
 // -> r in [0, 2p)
 void gfp_inv_2x4w(llfe_t r, const llfe_t a)
 {
-  gfp_pow_2x4w(r, a, u64_psub2);
+  gfp_powchn_2x4w(r, a, psub2_chain, EXP_CHNLEN);
 }
 
 // reduce the field element from [0, 2p) to [0, p)
@@ -1809,10 +4478,10 @@ void gfp_cswap_2x4w(llfe_t r, llfe_t a, const uint8_t b)
   a[0] = a0; a[1] = a1; a[2] = a2;
 }
 
-// check whether the field element is a square in the field  
+// check whether the field element is a square in the field with Euler's criterion
 // if a is     a square in the field, return 1; 
 // if a is not a square in the field, return 0.
-uint8_t gfp_issqr_2x4w(const llfe_t a)
+uint8_t gfp_euler_2x4w(const llfe_t a)
 {
   llfe_t t0, t1, vR;
   __m512i r = VZERO;
@@ -1822,7 +4491,7 @@ uint8_t gfp_issqr_2x4w(const llfe_t a)
   // compute r = a^((p-1)/2) - 1 
   // r is 0 if a is a square; r is non-0 if a is not a square
   gfp_copy_2x4w(t0, a);                 // t0 = a 
-  gfp_pow_2x4w(t1, t0, u64_pdiv2);      // t1 = a^((p-1)/2)
+  gfp_powchn_2x4w(t1, t0, pdiv2_chain, EXP_CHNLEN); // t1 = a^((p-1)/2)
   gfp_rdcp_2x4w(t1, t1);                // make t1 in [0, p) and strictly radix-43
 
   // vR = 0 | R
@@ -1847,6 +4516,57 @@ uint8_t gfp_issqr_2x4w(const llfe_t a)
   return (uint8_t) (z&1);
 }
 
+// check whether the field element is a square in the field with the Jacobi
+// symbol computed by the optimized binary GCD, the element is broadcast to all
+// lanes of the (8x1)-way kernel 
+// if a is     a square in the field, return 1; 
+// if a is not a square in the field, return 0.
+uint8_t gfp_jacobi_2x4w(const llfe_t a)
+{
+  __m512i x[SG_NWORDS], y[SG_NWORDS], r;
+  uint64_t a43[LL_NWORDS], w;
+  uint64_t z = 0;
+  llfe_t b;
+  int i, k, s;
+
+  gfp_rdcp_2x4w(b, a);                  // R = 2^k with even k, so (aR/p) = (a/p)
+
+  // get the limbs of the low half 
+  for (i = 0; i < LL_NWORDS; i++) a43[i] = ((uint64_t *)&b[i%LL_VLIMBS])[i/LL_VLIMBS];
+  for (i = 0; i < LL_NWORDS; i++) z |= a43[i];
+
+  // x = a, y = p in radix-26
+  for (i = 0; i < SG_NWORDS; i++) {
+    k = (i*SG_BRADIX)/LL_BRADIX; 
+    s = (i*SG_BRADIX)%LL_BRADIX;
+    w = a43[k] >> s;
+    if (k+1 < LL_NWORDS) w |= a43[k+1] << (LL_BRADIX-s);
+    x[i] = VSET1(w&SG_BMASK);
+  }
+  for (i = 0; i < HT_NWORDS; i++) {
+    y[2*i] = VSET1(ht_p[i]&SG_BMASK); y[2*i+1] = VSET1(ht_p[i]>>SG_BRADIX);
+  }
+
+  r = gfp_jacobisg_8x1w(x, y);
+
+  // zero is not a square, see gfp_jacobi_8x1w
+  z = (z | (0 - z)) >> 63;              // z is 0 (zero) or 1 (not zero)
+
+  return (uint8_t) ((((uint64_t *)&r)[0]&1) & z);
+}
+
+// check whether the field element is a square in the field  
+// if a is     a square in the field, return 1; 
+// if a is not a square in the field, return 0.
+uint8_t gfp_issqr_2x4w(const llfe_t a)
+{
+#ifdef ISSQR_JACOBI
+  return gfp_jacobi_2x4w(a);
+#else
+  return gfp_euler_2x4w(a);
+#endif
+}
+
 // check whether the field element is zero 
 // if a is     zero, return 1; 
 // if a is not zero, return 0.
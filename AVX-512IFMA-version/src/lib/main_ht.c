@@ -10,6 +10,7 @@
 #include "action.h"
 #include "utils.h"
 #include <string.h>
+#include <sys/wait.h>
 
 // the function to measure CPU cycles 
 extern uint64_t read_tsc();
@@ -20,6 +21,12 @@ extern uint64_t read_tsc();
 #define ITER_M 10000
 #define ITER_S 1000
 
+#ifdef RNG_FIXED
+static const uint8_t rng_fixed[32] = { 0 };
+#endif
+#define ITER_STREAM 16
+#define ITER_BATCHES 8
+
 #define LOAD_CACHE(X, ITER) for (i = 0; i < (ITER); i++) (X)
 
 #define MEASURE_TIME(X, ITER)                         \
@@ -123,7 +130,7 @@ void test_action()
   puts("\n* Public Keys:");  
   action(&vPK, vsk, &vE);
 
-  gfp_inv_8x1w(t0, vPK.z);
+  gfp_sginv_8x1w(t0, vPK.z);
   gfp_mul_8x1w(t1, vPK.y, t0);
   gfp_mont2num_8x1w(t0, t1);
 
@@ -165,7 +172,7 @@ void test_action()
   puts("\n* Shared Secrets:");  
   action(&vSS, vsk, &vPK);
 
-  gfp_inv_8x1w(t0, vSS.z);
+  gfp_sginv_8x1w(t0, vSS.z);
   gfp_mul_8x1w(t1, vSS.y, t0);
   gfp_mont2num_8x1w(t0, t1);
 
@@ -255,7 +262,7 @@ void test_multi_actions(int round)
     // keypair generation
     action(&vPK, vsk, &vE);
 
-    gfp_inv_8x1w(t0, vPK.z);
+    gfp_sginv_8x1w(t0, vPK.z);
     gfp_mul_8x1w(t1, vPK.y, t0);
     gfp_mont2num_8x1w(t0, t1);
 
@@ -271,7 +278,7 @@ void test_multi_actions(int round)
     // shared secret computation
     action(&vSS, vsk, &vPK);
 
-    gfp_inv_8x1w(t0, vSS.z);
+    gfp_sginv_8x1w(t0, vSS.z);
     gfp_mul_8x1w(t1, vSS.y, t0);
     gfp_mont2num_8x1w(t0, t1);
 
@@ -301,19 +308,12 @@ void test_multi_actions(int round)
 
 void timing_action()
 {
-  uint8_t sk_a[N], sk_b[N], sk_c[N], sk_d[N];
-  uint8_t sk_e[N], sk_f[N], sk_g[N], sk_h[N];
   htpoint vE, vPK;
   __m512i vsk[N];
   int i;
 
   // randomly generate eight private keys 
-  random_sk(sk_a); random_sk(sk_b); random_sk(sk_c); random_sk(sk_d);
-  random_sk(sk_e); random_sk(sk_f); random_sk(sk_g); random_sk(sk_h);
-
-  // initialize AVX512 vector of private key
-  for (i = 0; i < N; i++) 
-    vsk[i] = set_vector(sk_h[i], sk_g[i], sk_f[i], sk_e[i], sk_d[i], sk_c[i], sk_b[i], sk_a[i]);
+  random_sk_8x1w(&vsk, NULL, 1);
 
   for (i = 0; i < HT_NWORDS; i++) {
     vE.y[i] = VSET1(E[0][i]);
@@ -327,11 +327,1384 @@ void timing_action()
   printf("* GROUP ACTION : %ld cycles\n", diff_cycles);
 }
 
+void timing_exp()
+{
+  htfe_t a, r;
+  uint64_t old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) a[i] = VSET1(E[0][i]);
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(gfp_pow_8x1w(r, a, u64_psub2), 100);
+  MEASURE_TIME(gfp_pow_8x1w(r, a, u64_psub2), ITER_S);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_inv_8x1w(r, a), ITER_S);
+  printf("* INVERSION    : %ld -> %ld cycles (%ld saved)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+  MEASURE_TIME(gfp_sginv_8x1w(r, a), ITER_S);
+  printf("* SAFEGCD INV  : %ld -> %ld cycles (%ld saved)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+
+  MEASURE_TIME(gfp_pow_8x1w(r, a, u64_pdiv2), ITER_S);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_euler_8x1w(a), ITER_S);
+  printf("* EULER        : %ld -> %ld cycles (%ld saved per elligator)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+  MEASURE_TIME(gfp_jacobi_8x1w(a), ITER_S);
+  printf("* JACOBI       : %ld -> %ld cycles (%ld saved per elligator)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+}
+
+// scalar Montgomery multiplication r = a * b * 2^(-520) mod p in [0, p), the 
+// reference of the kernels: as vpmadd52, it reads only the low 52 bits of a limb
+static void mul_ref(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+  uint64_t t[HT_NWORDS+1] = { 0 }, m, borrow;
+  unsigned __int128 c;
+  int i, j;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    for (j = 0, c = 0; j < HT_NWORDS; j++) {
+      c += t[j] + (unsigned __int128)(a[i] & HT_BMASK) * (b[j] & HT_BMASK);
+      t[j] = (uint64_t)c & HT_BMASK; c >>= HT_BRADIX;
+    }
+    t[HT_NWORDS] += (uint64_t)c;
+    m = (t[0] * HT_MONTW) & HT_BMASK;
+    for (j = 0, c = 0; j < HT_NWORDS; j++) {
+      c += t[j] + (unsigned __int128)m * ht_p[j];
+      t[j] = (uint64_t)c & HT_BMASK; c >>= HT_BRADIX;
+    }
+    t[HT_NWORDS] += (uint64_t)c;
+    for (j = 0; j < HT_NWORDS; j++) t[j] = t[j+1];
+    t[HT_NWORDS] = 0;
+  }
+
+  // t < a + p, subtract p as long as t >= p
+  while (1) {
+    for (j = HT_NWORDS-1; (j > 0) && (t[j] == ht_p[j]); j--);
+    if (t[j] < ht_p[j]) break;
+    for (j = 0, borrow = 0; j < HT_NWORDS; j++) {
+      t[j] = t[j] - ht_p[j] - borrow;
+      borrow = t[j] >> 63; t[j] &= HT_BMASK;
+    }
+  }
+  memcpy(r, t, sizeof(uint64_t)*HT_NWORDS);
+}
+
+// the Karatsuba kernels agree with the reference (and so with the schoolbook 
+// ones) also on limbs with junk above bit 52, e.g. those of mpi_conv_43to52()
+void test_mulka()
+{
+  uint64_t x[8][8], y[8][8], u[HT_NWORDS], v[HT_NWORDS], w[HT_NWORDS], z[HT_NWORDS];
+  htfe_t a, b, an, bn, r[4];
+  __m512i junk;
+  int i, k, ch, wrong = 0;
+
+  for (k = 0; k < 1000; k++) {
+    for (i = 0; i < 8; i++) {
+      mpi64_random(x[i]);
+      mpi64_random(y[i]);
+    }
+    mpi_load_8x1w(a, (const uint64_t (*)[8])x);
+    mpi_load_8x1w(b, (const uint64_t (*)[8])y);
+    // every other round, limbs that are not strict
+    for (i = 0; i < HT_NWORDS; i++) {
+      randombytes(&junk, sizeof(junk));
+      an[i] = (k & 1) ? VOR(a[i], VAND(junk, VSET1(~HT_BMASK))) : a[i];
+      randombytes(&junk, sizeof(junk));
+      bn[i] = (k & 1) ? VOR(b[i], VAND(junk, VSET1(~HT_BMASK))) : b[i];
+    }
+
+    gfp_mulka_8x1w(r[0], an, bn);
+    gfp_sqrka_8x1w(r[1], an);
+    gfp_mul_8x1w(r[2], an, bn);
+    gfp_sqr_8x1w(r[3], an);
+    for (i = 0; i < 4; i++) gfp_rdcp_8x1w(r[i], r[i]);
+
+    for (ch = 0; ch < 8; ch++) {
+      get_channel_8x1w(u, an, ch);
+      get_channel_8x1w(v, bn, ch);
+      mul_ref(w, u, v);
+      mul_ref(z, u, u);
+      get_channel_8x1w(u, r[0], ch); wrong |= memcmp(u, w, sizeof(w));
+      get_channel_8x1w(u, r[1], ch); wrong |= memcmp(u, z, sizeof(z));
+      get_channel_8x1w(u, r[2], ch); wrong |= memcmp(u, w, sizeof(w));
+      get_channel_8x1w(u, r[3], ch); wrong |= memcmp(u, z, sizeof(z));
+    }
+  }
+
+  if (wrong) printf("Karatsuba MUL/SQR : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Karatsuba MUL/SQR : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// the Jacobi symbol agrees with Euler's criterion, in both components, on
+// random elements and on 0, 1, 2, p-1, p, p+1, 2^510 and 2p-1
+void test_jacobi()
+{
+  uint64_t x[8][8], y[LL_NWORDS], z[LL_VLIMBS][8];
+  htfe_t a;
+  llfe_t b;
+  __m512i r, s;
+  int i, k, wrong = 0;
+  uint64_t c;
+
+  for (k = 0; k < 2000; k++) {
+    for (i = 0; i < 8; i++) mpi64_random(x[i]);
+    if (k == 0) {
+      memset(x, 0, sizeof(x));
+      x[1][0] = 1; x[2][0] = 2; x[6][7] = (uint64_t) 1 << 62;
+      for (i = 0; i < 8; i++) { x[3][i] = u64_p[i]; x[4][i] = u64_p[i]; x[5][i] = u64_p[i]; }
+      x[3][0] -= 1; x[5][0] += 1;
+      for (i = 0, c = 0; i < 8; i++) {  // 2p-1
+        x[7][i] = (u64_p[i] << 1) | c; c = u64_p[i] >> 63;
+      }
+      x[7][0] -= 1;
+    }
+    mpi_load_8x1w(a, (const uint64_t (*)[8])x);
+    r = gfp_jacobi_8x1w(a);
+    s = gfp_euler_8x1w(a);
+    wrong |= VTEST(VXOR(r, s), VXOR(r, s));
+
+    // the (2x4)-way component reads the low half of b
+    for (i = 0; i < 8; i++) {
+      mpi_conv_64to43(y, x[i], LL_NWORDS, 8);
+      memset(z, 0, sizeof(z));
+      for (c = 0; c < LL_NWORDS; c++) z[c%LL_VLIMBS][c/LL_VLIMBS] = y[c];
+      b[0] = VLOAD(z[0]); b[1] = VLOAD(z[1]); b[2] = VLOAD(z[2]);
+      wrong |= gfp_jacobi_2x4w(b) != gfp_euler_2x4w(b);
+      wrong |= gfp_jacobi_2x4w(b) != (((uint64_t *)&s)[i]&1);
+    }
+  }
+
+  if (wrong) printf("Jacobi symbol     : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Jacobi symbol     : \x1b[32mPASS!\x1b[0m\n");
+}
+
+void timing_mul()
+{
+  htfe_t a, b, r;
+  uint64_t old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    a[i] = VSET1(E[0][i]);
+    b[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  // gfp_mul/sqr_8x1w are the schoolbook kernels unless built with MUL=KARATSUBA
+  LOAD_CACHE(gfp_mul_8x1w(r, a, b), 1000);
+  MEASURE_TIME(gfp_mul_8x1w(r, r, b), ITER_L);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_mulka_8x1w(r, r, b), ITER_L);
+  printf("* KARATSUBA MUL: %ld -> %ld cycles\n", old_cycles, diff_cycles);
+  MEASURE_TIME(gfp_sqr_8x1w(r, r), ITER_L);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_sqrka_8x1w(r, r), ITER_L);
+  printf("* KARATSUBA SQR: %ld -> %ld cycles\n", old_cycles, diff_cycles);
+}
+
+// reference yMUL using the out-of-line yDBL/yADD and copying the three ladder 
+// points in every step (the implementation before the fused ladder step)
+static void ymul_ref_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A, const uint8_t k)
+{
+  htpoint T[3], Q, TQ;
+  uint32_t m = addc[k];
+  __m512i inf;
+  int i;
+
+  point_copy_8x1w(&T[0], P);
+  yDBL_8x1w(&T[1], P, A);
+  yADD_8x1w(&T[2], &T[1], &T[0], P);
+
+  for (i = 0; i < addc_len[k]; i++) {
+    inf = point_isinf_8x1w(&T[m&1]);
+    if (!VORRDC(inf)) yADD_8x1w(&Q, &T[2], &T[(m&1)^1], &T[m&1]);
+    else {
+      yDBL_8x1w(&TQ, &T[2], A);
+      yADD_8x1w(&Q, &T[2], &T[(m&1)^1], &T[m&1]);
+      point_cmove_8x1w(&Q, &TQ, inf);
+    }
+    point_copy_8x1w(&T[0], &T[(m&1)^1]);
+    point_copy_8x1w(&T[1], &T[2]);
+    point_copy_8x1w(&T[2], &Q);
+    m >>= 1;
+  }
+  point_copy_8x1w(R, &T[2]);
+}
+
+void timing_ymul()
+{
+  htpoint vP, vA, vR;
+  uint64_t old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vP.y[i] = VSET1(E[0][i]);
+    vP.z[i] = VSET1(E[1][i]);
+    vA.y[i] = VSET1(E[1][i]);
+    vA.z[i] = VSET1(E[0][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  // k = N-5 is the largest prime l = 587 and so the longest addition chain
+  LOAD_CACHE(yMUL_8x1w(&vR, &vP, &vA, N-5), 100);
+  MEASURE_TIME(ymul_ref_8x1w(&vR, &vP, &vA, N-5), ITER_S);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(yMUL_8x1w(&vR, &vP, &vA, N-5), ITER_S);
+  printf("* YMUL (l=587) : %ld -> %ld cycles\n", old_cycles, diff_cycles);
+}
+
+// the scalar conversion of eight radix-64 integers to radix-52 and back
+static void loadstore_scalar(uint64_t (*r)[8], htfe_t b, const uint64_t (*a)[8])
+{
+  uint64_t a52[8][HT_NWORDS];
+  int i;
+
+  for (i = 0; i < 8; i++) mpi_conv_64to52(a52[i], a[i], HT_NWORDS, 8);
+  for (i = 0; i < HT_NWORDS; i++) 
+    b[i] = set_vector(a52[7][i], a52[6][i], a52[5][i], a52[4][i], a52[3][i], a52[2][i], a52[1][i], a52[0][i]);
+  for (i = 0; i < 8; i++) {
+    get_channel_8x1w(a52[i], b, i);
+    mpi_conv_52to64(r[i], a52[i], 8, HT_NWORDS);
+  }
+}
+
+// the SIMD load/store gives the same radix-52 element as the scalar conversion
+void test_loadstore()
+{
+  uint64_t a[8][8], r0[8][8], r1[8][8];
+  htfe_t b0, b1;
+  int wrong = 0;
+
+  randombytes(a, sizeof(a));
+  loadstore_scalar(r0, b0, (const uint64_t (*)[8])a);
+  mpi_load_8x1w(b1, (const uint64_t (*)[8])a);
+  mpi_store_8x1w(r1, b1);
+  wrong |= memcmp(b0, b1, sizeof(htfe_t));
+  wrong |= memcmp(r0, a, sizeof(a));
+  wrong |= memcmp(r1, a, sizeof(a));
+
+  if (wrong) printf("Load/store 8x1w   : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Load/store 8x1w   : \x1b[32mPASS!\x1b[0m\n");
+}
+
+void timing_loadstore()
+{
+  uint64_t a[8][8] = {0}, r[8][8];
+  htfe_t b;
+  uint64_t old_cycles;
+  int i;
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(loadstore_scalar(r, b, (const uint64_t (*)[8])a), 100);
+  MEASURE_TIME(loadstore_scalar(r, b, (const uint64_t (*)[8])a), ITER_L);
+  old_cycles = diff_cycles;
+  MEASURE_TIME((mpi_load_8x1w(b, (const uint64_t (*)[8])a), mpi_store_8x1w(r, b)), ITER_L);
+  printf("* LOAD/STORE   : %ld -> %ld cycles (radix-64 -> 52 -> 64, 8 elements)\n", old_cycles, diff_cycles);
+}
+
+// the scalar handover of the curve between the (8x1)-way and (2x4)-way components
+// return 0 if the radix-52 limbs it forms on the way back are strict (< 2^52)
+static int handover_scalar(llpoint_t *R, htpoint_t C, const htpoint_t P)
+{
+  uint64_t a43[LL_NWORDS] = {0}, ad43[LL_NWORDS] = {0};
+  uint64_t a52[8][HT_NWORDS] = {0}, ad52[8][HT_NWORDS] = {0};
+  llpoint_t t;
+  htpoint T;
+  uint64_t junk = 0;
+  int i, k;
+
+  gfp_mont2num_8x1w(T.y, P->y);
+  gfp_mont2num_8x1w(T.z, P->z);
+  for (i = 0; i < 8; i++) {
+    get_channel_8x1w(a52[i], T.y, i);
+    get_channel_8x1w(ad52[i], T.z, i);
+    mpi_conv_52to43(a43, a52[i], LL_NWORDS, HT_NWORDS);
+    mpi_conv_52to43(ad43, ad52[i], LL_NWORDS, HT_NWORDS);
+    R[i][0] = set_vector(a43[9] , a43[6], a43[3], a43[0], ad43[9] , ad43[6], ad43[3], ad43[0]);
+    R[i][1] = set_vector(a43[10], a43[7], a43[4], a43[1], ad43[10], ad43[7], ad43[4], ad43[1]);
+    R[i][2] = set_vector(a43[11], a43[8], a43[5], a43[2], ad43[11], ad43[8], ad43[5], ad43[2]);
+    gfp_num2mont_2x4w(R[i], R[i]);
+  }
+
+  for (i = 0; i < 8; i++) {
+    gfp_mont2num_2x4w(t, R[i]);
+    get_channel_2x4w(a43, t, 4);
+    get_channel_2x4w(ad43, t, 0);
+    mpi43_carryp(a43);
+    mpi43_carryp(ad43);
+    mpi_conv_43to52(a52[i], a43, HT_NWORDS, LL_NWORDS);
+    mpi_conv_43to52(ad52[i], ad43, HT_NWORDS, LL_NWORDS);
+    for (k = 0; k < HT_NWORDS; k++) junk |= (a52[i][k] | ad52[i][k]) & ~HT_BMASK;
+  }
+  for (i = 0; i < HT_NWORDS; i++) {
+    C->y[i] = set_vector(a52[7][i],  a52[6][i],  a52[5][i],  a52[4][i],  a52[3][i],  a52[2][i],  a52[1][i],  a52[0][i]);
+    C->z[i] = set_vector(ad52[7][i], ad52[6][i], ad52[5][i], ad52[4][i], ad52[3][i], ad52[2][i], ad52[1][i], ad52[0][i]);
+  }
+  gfp_num2mont_8x1w(C->y, C->y);
+  gfp_num2mont_8x1w(C->z, C->z);
+
+  return (junk != 0);
+}
+
+// the SIMD handover gives the same (2x4)-way points as the scalar one, and back
+void test_handover()
+{
+  llpoint_t R0[8], R1[8];
+  htpoint P, C0, C1;
+  uint64_t r[HT_NWORDS];
+  int i, k, wrong = 0;
+
+  // random y and z in [0, p) 
+  for (i = 0; i < HT_NWORDS; i++) {
+    randombytes(&P.y[i], sizeof(__m512i));
+    randombytes(&P.z[i], sizeof(__m512i));
+    r[i] = (i < HT_NWORDS-1) ? HT_BMASK : (1ULL << 42) - 1;
+    P.y[i] = VAND(P.y[i], VSET1(r[i]));
+    P.z[i] = VAND(P.z[i], VSET1(r[i]));
+  }
+  gfp_num2mont_8x1w(P.y, P.y);
+  gfp_num2mont_8x1w(P.z, P.z);
+
+  wrong |= handover_scalar(R0, &C0, &P);
+  point_ht2ll_8x1w(R1, &P);
+  for (k = 0; k < 8; k++) {
+    gfp_mont2num_2x4w(R0[k], R0[k]);
+    gfp_mont2num_2x4w(R1[k], R1[k]);
+    wrong |= memcmp(R0[k], R1[k], sizeof(llpoint_t));
+  }
+
+  point_ht2ll_8x1w(R1, &P);
+  point_ll2ht_8x1w(&C1, R1);
+  gfp_mont2num_8x1w(C0.y, C0.y); gfp_mont2num_8x1w(C1.y, C1.y);
+  gfp_mont2num_8x1w(C0.z, C0.z); gfp_mont2num_8x1w(C1.z, C1.z);
+  wrong |= memcmp(&C0, &C1, sizeof(htpoint));
+
+  if (wrong) printf("Handover HT <-> LL : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Handover HT <-> LL : \x1b[32mPASS!\x1b[0m\n");
+}
+
+void timing_handover()
+{
+  llpoint_t R[8];
+  htpoint P, C;
+  uint64_t old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    P.y[i] = VSET1(E[0][i]);
+    P.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(handover_scalar(R, &C, &P), 100);
+  MEASURE_TIME(handover_scalar(R, &C, &P), ITER_M);
+  old_cycles = diff_cycles;
+  MEASURE_TIME((point_ht2ll_8x1w(R, &P), point_ll2ht_8x1w(&C, R)), ITER_M);
+  printf("* HANDOVER     : %ld -> %ld cycles (HT -> LL -> HT, 8 curves)\n", old_cycles, diff_cycles);
+}
+
+#ifdef METHOD_CONTINUOUS
+#define STREAM_N 18                     // not a multiple of 8: the last batch is padded
+
+// the curve of the instance as A24plus/C24 in the number domain
+static void inst_normalize(uint64_t *r, const htinst *inst)
+{
+  htfe_t y, z;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    y[i] = VSET1(inst->y[i]);
+    z[i] = VSET1(inst->z[i]);
+  }
+  gfp_sginv_8x1w(z, z);
+  gfp_mul_8x1w(y, y, z);
+  gfp_mont2num_8x1w(y, y);
+  get_channel_8x1w(r, y, 0);
+}
+
+// STREAM_N/2 key exchanges through the queue of action_stream()
+void test_stream()
+{
+  htinst pk[STREAM_N], ss[STREAM_N];
+  uint64_t r0[HT_NWORDS], r1[HT_NWORDS];
+  int i, wrong = 0;
+
+  for (i = 0; i < STREAM_N; i++) {
+    random_sk(pk[i].sk);
+    memcpy(pk[i].y, E[0], sizeof(pk[i].y));
+    memcpy(pk[i].z, E[1], sizeof(pk[i].z));
+  }
+  wrong |= action_stream(pk, STREAM_N);
+
+  // instance 2i shares the secret with instance 2i+1
+  for (i = 0; i < STREAM_N; i++) {
+    memcpy(ss[i].sk, pk[i].sk, N);
+    memcpy(ss[i].y, pk[i^1].y, sizeof(ss[i].y));
+    memcpy(ss[i].z, pk[i^1].z, sizeof(ss[i].z));
+  }
+  wrong |= action_stream(ss, STREAM_N);
+
+  for (i = 0; i < STREAM_N; i += 2) {
+    inst_normalize(r0, &ss[i]);
+    inst_normalize(r1, &ss[i+1]);
+    wrong |= memcmp(r0, r1, sizeof(r0));
+  }
+
+  if (wrong) printf("Stream (%d instances) : \x1b[31mNOT PASS!\x1b[0m\n", STREAM_N);
+  else printf("Stream (%d instances) : \x1b[32mPASS!\x1b[0m\n", STREAM_N);
+}
+
+// cycles per instance of a long queue, compared to one batch of 8 and to the 
+// same instances in batches with pooled tails
+void timing_stream()
+{
+  static htinst inst[8*ITER_STREAM];
+  static __m512i vsk[ITER_STREAM][N];
+  static htpoint C[ITER_STREAM], A[ITER_STREAM];
+  int b, i, k;
+
+  random_sk_8x1w(vsk, NULL, ITER_STREAM);
+  for (b = 0; b < ITER_STREAM; b++) {
+    for (i = 0; i < HT_NWORDS; i++) {
+      A[b].y[i] = VSET1(E[0][i]);
+      A[b].z[i] = VSET1(E[1][i]);
+    }
+    for (k = 0; k < 8; k++) {
+      for (i = 0; i < N; i++) inst[8*b+k].sk[i] = ((uint64_t *)&vsk[b][i])[k];
+      memcpy(inst[8*b+k].y, E[0], sizeof(inst[8*b+k].y));
+      memcpy(inst[8*b+k].z, E[1], sizeof(inst[8*b+k].z));
+    }
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles, old_cycles, pool_cycles;
+
+  MEASURE_TIME(action(&C[0], vsk[0], &A[0]), 1);
+  old_cycles = diff_cycles/8;
+  MEASURE_TIME(action_batches(C, vsk, A, ITER_STREAM), 1);
+  pool_cycles = diff_cycles/(8*ITER_STREAM);
+  MEASURE_TIME(action_stream(inst, 8*ITER_STREAM), 1);
+  printf("* STREAM       : %ld -> %ld -> %ld cycles per instance (batch, pooled, stream)\n", 
+         old_cycles, pool_cycles, diff_cycles/(8*ITER_STREAM));
+}
+#endif
+
+#ifdef METHOD_COMBINED
+#define TEST_NB 3
+
+// lane k of the curve as A24plus/C24 in the number domain
+static void curve_normalize(uint64_t *r, const htpoint_t A, const int k)
+{
+  htfe_t t;
+
+  gfp_sginv_8x1w(t, A->z);
+  gfp_mul_8x1w(t, A->y, t);
+  gfp_mont2num_8x1w(t, t);
+  get_channel_8x1w(r, t, k);
+}
+
+// the pooled tails of TEST_NB batches give the same curves as action()
+void test_batches()
+{
+  __m512i sk[TEST_NB][N];
+  htpoint A[TEST_NB], C0[TEST_NB], C1[TEST_NB];
+  uint64_t r0[HT_NWORDS], r1[HT_NWORDS];
+  int b, i, k, wrong = 0;
+
+  random_sk_8x1w(sk, NULL, TEST_NB);
+  for (b = 0; b < TEST_NB; b++) {
+    for (i = 0; i < HT_NWORDS; i++) {
+      A[b].y[i] = VSET1(E[0][i]);
+      A[b].z[i] = VSET1(E[1][i]);
+    }
+    action(&C0[b], sk[b], &A[b]);
+  }
+  wrong |= action_batches(C1, (const __m512i (*)[N])sk, A, TEST_NB);
+
+  for (b = 0; b < TEST_NB; b++) {
+    for (k = 0; k < 8; k++) {
+      curve_normalize(r0, &C0[b], k);
+      curve_normalize(r1, &C1[b], k);
+      wrong |= memcmp(r0, r1, sizeof(r0));
+    }
+  }
+
+  if (wrong) printf("Pooled tails (%d batches) : \x1b[31mNOT PASS!\x1b[0m\n", TEST_NB);
+  else printf("Pooled tails (%d batches) : \x1b[32mPASS!\x1b[0m\n", TEST_NB);
+}
+
+// cycles per batch of action() against ITER_BATCHES batches with pooled tails
+void timing_batches()
+{
+  static __m512i sk[ITER_BATCHES][N];
+  static htpoint A[ITER_BATCHES], C[ITER_BATCHES];
+  int b, i;
+
+  random_sk_8x1w(sk, NULL, ITER_BATCHES);
+  for (b = 0; b < ITER_BATCHES; b++) {
+    for (i = 0; i < HT_NWORDS; i++) {
+      A[b].y[i] = VSET1(E[0][i]);
+      A[b].z[i] = VSET1(E[1][i]);
+    }
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles, old_cycles;
+
+  start_cycles = read_tsc();
+  for (b = 0; b < ITER_BATCHES; b++) action(&C[b], sk[b], &A[b]);
+  end_cycles = read_tsc();
+  old_cycles = (end_cycles-start_cycles)/ITER_BATCHES;
+  MEASURE_TIME(action_batches(C, (const __m512i (*)[N])sk, A, ITER_BATCHES), 1);
+  printf("* POOLED TAILS : %ld -> %ld cycles per batch\n", old_cycles, diff_cycles/ITER_BATCHES);
+}
+#endif
+
+// read from the kernel, as randombytes() did before the DRBG
+static void urandom_read(void *r, size_t len)
+{
+  static int fd = -1;
+  ssize_t n;
+
+  if ((fd < 0) && (0 > (fd = open("/dev/urandom", O_RDONLY)))) exit(1);
+  for (size_t i = 0; i < len; i += n)
+    if (0 >= (n = read(fd, (char *)r + i, len-i))) exit(2);
+}
+
+// the ChaCha20 core gives the block of RFC 8439 (Sect. 2.3.2) and its successors
+// in the next lanes, a fixed seed gives the same bytes however they are read, and
+// a forked child does not repeat the bytes of its parent
+void test_rng()
+{
+  const uint32_t out[16] = {
+    0xe4e7f110, 0x15593bd1, 0x1fdd0f50, 0xc47120a3, 0xc7f4d1c7, 0x0368c033, 0x9aaa2204, 0x4e6cd4c3, 
+    0x466482d2, 0x09aa9f07, 0x05d7c214, 0xa2028bd9, 0xd19c12b5, 0xb94e16de, 0xe883d0cb, 0x4e3c50a2, };
+  const uint32_t nonce[3] = { 0x09000000, 0x4a000000, 0x00000000 };
+  uint32_t key[8], w0[16][RNG_LANES], w1[16][RNG_LANES];
+  uint8_t seed[32] = { 0 }, a[3000], b[3000];
+  __m512i x[16];
+  int i, k, fd[2], status, wrong = 0;
+  pid_t pid;
+
+  for (i = 0; i < 8; i++) key[i] = 0x03020100 + 0x04040404*i;   // key = 00:01:...:1f
+  chacha20_16x1w(x, key, nonce, 1);
+  memcpy(w0, x, sizeof(w0));
+  for (i = 0; i < 16; i++) wrong |= (w0[i][0] != out[i]);
+  chacha20_16x1w(x, key, nonce, RNG_LANES-1);
+  memcpy(w1, x, sizeof(w1));
+  for (i = 0; i < 16; i++) wrong |= (w0[i][RNG_LANES-2] != w1[i][0]);
+
+  rng_seed(seed);
+  randombytes(a, sizeof(a));
+  rng_seed(seed);
+  for (i = 0, k = 1; i < sizeof(b); i += k, k = 2*k+1) randombytes(&b[i], (i+k < sizeof(b)) ? k : sizeof(b)-i);
+  wrong |= memcmp(a, b, sizeof(a));
+  memset(b, 0, sizeof(b));
+  wrong |= !memcmp(a, b, sizeof(a));
+  rng_seed(NULL);
+
+  randombytes(a, 1);                    // seeds the DRBG before the fork
+  if (pipe(fd)) exit(1);
+  if (0 == (pid = fork())) {
+    randombytes(b, 64);
+    _exit(64 != write(fd[1], b, 64));
+  }
+  randombytes(a, 64);
+  wrong |= (pid < 0) || (64 != read(fd[0], b, 64));
+  wrong |= (pid < 0) || (pid != waitpid(pid, &status, 0)) || (status != 0);
+  wrong |= !memcmp(a, b, 64);
+  close(fd[0]); close(fd[1]);
+
+  if (wrong) printf("ChaCha20 DRBG     : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("ChaCha20 DRBG     : \x1b[32mPASS!\x1b[0m\n");
+}
+
+void timing_rng()
+{
+  uint64_t u[8], old_cycles;
+  int i;
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(urandom_read(u, sizeof(u)), 100);
+  MEASURE_TIME(urandom_read(u, sizeof(u)), ITER_M);
+  old_cycles = diff_cycles;
+  LOAD_CACHE(randombytes(u, sizeof(u)), 100);
+  MEASURE_TIME(randombytes(u, sizeof(u)), ITER_M);
+  printf("* RANDOMBYTES  : %ld -> %ld cycles (64 bytes)\n", old_cycles, diff_cycles);
+}
+
+// the exponents of the batch sampler are in the ranges of random_sk(), and the
+// per-key form is the lane-packed one
+void test_keygen()
+{
+  __m512i vsk[2][N];
+  uint8_t sk[16][N], sk0[N];
+  int i, k, e, wrong = 0, hit[N][2] = { 0 };
+
+  random_sk_8x1w(vsk, sk, 2);
+  for (k = 0; k < 16; k++) {
+    for (i = 0; i < N; i++) {
+      wrong |= (sk[k][i] != ((uint64_t *)&vsk[k/8][i])[k%8]);
+      e = (2*(sk[k][i]&1)-1)*(sk[k][i]>>1);
+      wrong |= ((sk[k][i] >> 1) == 0) && !(sk[k][i] & 1);   // 0 is always positive
+      wrong |= (e < -B[i]) || (e > B[i]);
+      hit[i][e > 0] = 1;
+    }
+  }
+  // a negative and a positive exponent in every position (fails with a 
+  // negligible probability)
+  for (i = 0; i < N; i++) wrong |= !(hit[i][0] & hit[i][1]);
+  // random_sk() maps 0 the same way
+  random_sk(sk0);
+  for (i = 0; i < N; i++) wrong |= ((sk0[i] >> 1) == 0) && !(sk0[i] & 1);
+
+  if (wrong) printf("Key sampler 8x1w  : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Key sampler 8x1w  : \x1b[32mPASS!\x1b[0m\n");
+}
+
+void timing_keygen()
+{
+  __m512i vsk[N];
+  uint8_t sk[8][N];
+  uint64_t old_cycles;
+  int i, k;
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  start_cycles = read_tsc();
+  for (i = 0; i < ITER_S; i++) {
+    for (k = 0; k < 8; k++) random_sk(sk[k]);
+    for (k = 0; k < N; k++) 
+      vsk[k] = set_vector(sk[7][k], sk[6][k], sk[5][k], sk[4][k], sk[3][k], sk[2][k], sk[1][k], sk[0][k]);
+  }
+  end_cycles = read_tsc();
+  old_cycles = (end_cycles-start_cycles)/ITER_S;
+  MEASURE_TIME(random_sk_8x1w(&vsk, sk, 1), ITER_S);
+  printf("* KEYGEN       : %ld -> %ld cycles (8 secret keys)\n", old_cycles, diff_cycles);
+}
+
+#ifdef ELLIGATOR_FIXED
+// the table of the fixed-u Elligator holds u = 2, 3, ... and the right u^2+-1
+void test_elligator()
+{
+  htfe_t u, t, r;
+  llfe_t lu;
+  uint64_t a[HT_NWORDS], a43[LL_NWORDS], w[LL_NWORDS];
+  int i, k, wrong = 0;
+
+  for (k = 0; k < ELL_NU; k++) {
+    for (i = 0; i < HT_NWORDS; i++) {
+      u[i] = VSET1(ht_ellu[k][0][i]);
+      r[i] = VSET1(ht_montR[i]);
+    }
+    gfp_mont2num_8x1w(t, u);
+    get_channel_8x1w(a, t, 0);
+    for (i = 0; i < HT_NWORDS; i++) wrong |= (a[i] != ((i == 0) ? k+2 : 0));
+
+    gfp_sqr_8x1w(t, u);
+    gfp_rdcp_8x1w(t, t);
+    get_channel_8x1w(a, t, 0);
+    wrong |= memcmp(a, ht_ellu[k][1], sizeof(a));
+    gfp_add_8x1w(u, t, r);
+    gfp_rdcp_8x1w(u, u);
+    get_channel_8x1w(a, u, 0);
+    wrong |= memcmp(a, ht_ellu[k][2], sizeof(a));
+    gfp_sub_8x1w(u, t, r);
+    gfp_rdcp_8x1w(u, u);
+    get_channel_8x1w(a, u, 0);
+    wrong |= memcmp(a, ht_ellu[k][3], sizeof(a));
+
+    for (i = 0; i < LL_VLIMBS; i++) 
+      lu[i] = VSET(0, 0, 0, 0, ll_ellu[k][i+9], ll_ellu[k][i+6], ll_ellu[k][i+3], ll_ellu[k][i]);
+    gfp_mont2num_2x4w(lu, lu);
+    get_channel_2x4w(a43, lu, 0);
+    mpi43_carryp(a43);
+    for (i = 0; i < LL_NWORDS; i++) w[i] = (i == 0) ? k+2 : 0;
+    wrong |= memcmp(a43, w, sizeof(w));
+  }
+
+  if (wrong) printf("Fixed-u Elligator : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Fixed-u Elligator : \x1b[32mPASS!\x1b[0m\n");
+}
+#endif
+
+void timing_elligator()
+{
+  htpoint vE, T0, T1;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(elligator_8x1w(&T0, &T1, &vE), 10);
+  MEASURE_TIME(elligator_8x1w(&T0, &T1, &vE), ITER_M);
+#ifdef ELLIGATOR_FIXED
+  printf("* ELLIGATOR    : %ld cycles (fixed u)\n", diff_cycles);
+#else
+  printf("* ELLIGATOR    : %ld cycles (random u)\n", diff_cycles);
+#endif
+}
+
+// the first-round points on the base curve: T+ lies on E and T- on its twist, 
+// and both have the order of the product of the primes of BATCHES[1]
+void test_basepoints()
+{
+  htpoint vE, T[2], G;
+  htfe_t t0, t1, t2;
+  __m512i r;
+  const int m = 1 % NUMBA;
+  int i, j, k, wrong = 0;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+    for (k = 0; k < 2; k++) {
+      T[k].y[i] = VSET1(ET[k][i]);
+      T[k].z[i] = VSET1(ht_montR[i]);
+    }
+  }
+  wrong |= !curve_iseql_8x1w(&vE, E[0], E[1]);
+  wrong |= curve_iseql_8x1w(&vE, E[1], E[0]);
+
+  for (k = 0; k < 2; k++) {
+    // Montgomery X = z+y, Z = z-y, then X*Z*(X^2+Z^2) is a square iff x^3+x is
+    gfp_add_8x1w(t0, T[k].z, T[k].y);
+    gfp_sub_8x1w(t1, T[k].z, T[k].y);
+    gfp_mul_8x1w(t2, t0, t1);
+    gfp_sqr_8x1w(t0, t0);
+    gfp_sqr_8x1w(t1, t1);
+    gfp_add_8x1w(t0, t0, t1);
+    gfp_mul_8x1w(t2, t2, t0);
+    r = gfp_issqr_8x1w(t2);
+    wrong |= (VADDRDC(r) != 8*k);
+
+    for (i = 0; i < SIZEBA[m]; i++) {
+      point_copy_8x1w(&G, &T[k]);
+      for (j = 0; j < SIZEBA[m]; j++)
+        if (j != i) yMUL_8x1w(&G, &G, &vE, BATCHES[m][j]);
+      r = point_isinf_8x1w(&G);
+      wrong |= (VORRDC(r) != 0);
+      yMUL_8x1w(&G, &G, &vE, BATCHES[m][i]);
+      r = point_isinf_8x1w(&G);
+      wrong |= (VADDRDC(r) != 8);
+    }
+  }
+
+  if (wrong) printf("Base curve points : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Base curve points : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// the first round on the base curve: Elligator and the cofactor clearing over 
+// COMPBA[1] against loading the precomputed points
+static void basepoints_elligator(htpoint_t T0, htpoint_t T1, const htpoint_t A)
+{
+  const int m = 1 % NUMBA;
+  int i;
+
+  elligator_8x1w(T1, T0, A);
+  yDBL_8x1w(T0, T0, A); 
+  yDBL_8x1w(T0, T0, A);
+  yDBL_8x1w(T1, T1, A);
+  yDBL_8x1w(T1, T1, A); 
+  for (i = 0; i < SICOBA[m]; i++) {
+    yMUL_8x1w(T0, T0, A, COMPBA[m][i]); 
+    yMUL_8x1w(T1, T1, A, COMPBA[m][i]);
+  }
+}
+
+static void basepoints_table(htpoint_t T0, htpoint_t T1)
+{
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    T0->y[i] = VSET1(ET[0][i]);
+    T1->y[i] = VSET1(ET[1][i]);
+    T0->z[i] = T1->z[i] = VSET1(ht_montR[i]);
+  }
+}
+
+void timing_basepoints()
+{
+  htpoint vE, T0, T1;
+  uint64_t old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(basepoints_elligator(&T0, &T1, &vE), 10);
+  MEASURE_TIME(basepoints_elligator(&T0, &T1, &vE), ITER_S);
+  old_cycles = diff_cycles;
+  LOAD_CACHE(basepoints_table(&T0, &T1), 100);
+  MEASURE_TIME(basepoints_table(&T0, &T1), ITER_L);
+  printf("* BASE POINTS  : %ld -> %ld cycles (first round on E)\n", old_cycles, diff_cycles);
+}
+
+// the lanes in which P and Q are the same projective point 
+static __m512i point_eql(const htpoint_t P, const htpoint_t Q)
+{
+  htfe_t t;
+
+  gfp_mulsub_8x1w(t, P->y, Q->z, P->z, Q->y);
+  gfp_rdcp_8x1w(t, t);
+  return gfp_iszero_8x1w(t);
+}
+
+// a kernel point G of order l = primeli[k] on the curve A (except for the lanes 
+// in which it is O), and two random points T0, T1 to push through the isogeny
+static __m512i sqrtvelu_kernel(htpoint_t G, htpoint_t T0, htpoint_t T1, const htpoint_t A, const int k)
+{
+  int i;
+
+  elligator_8x1w(T1, T0, A);
+  yDBL_8x1w(G, T1, A);
+  yDBL_8x1w(G, G, A);
+  for (i = 0; i < N; i++)
+    if (i != k) yMUL_8x1w(G, G, A, i);
+
+  return point_isinf_8x1w(G);
+}
+
+// sqrt-Velu gives the same codomains, the same images of T0, T1, and the same 
+// multiples [s-1]P, [s]P (for OAYT) as Velu for all l >= 17, along a walk 
+void test_sqrtvelu()
+{
+  htpoint vA, G, T0, T1, C0, C1, R0, R1;
+  htpoint K0[HLMAX], K1[HLMAX];
+  __m512i inf, eql;
+  int k, s, wrong = 0;
+
+  for (k = 0; k < HT_NWORDS; k++) {
+    vA.y[k] = VSET1(E[0][k]);
+    vA.z[k] = VSET1(E[1][k]);
+  }
+
+  for (k = 0; k < N; k++) {
+    if (primeli[k] < 17) continue;
+    s = primeli[k]>>1;
+    inf = sqrtvelu_kernel(&G, &T0, &T1, &vA, k);
+
+    yISOGvelu_8x1w(K0, &C0, &G, &vA, k);
+    yISOGsqrt_8x1w(K1, &C1, &G, &vA, k);
+    eql = VAND(point_eql(&C0, &C1), point_eql(&K0[s-1], &K1[s-1]));
+    eql = VAND(eql, point_eql(&K0[s-2], &K1[s-2]));
+    yEVALvelu_8x1w(&R0, &T0, K0, k);
+    yEVALsqrt_8x1w(&R1, &T0, K1, k);
+    eql = VAND(eql, point_eql(&R0, &R1));
+    yEVALvelu_8x1w(&R0, &T1, K0, k);
+    yEVALsqrt_8x1w(&R1, &T1, K1, k);
+    eql = VAND(eql, point_eql(&R0, &R1));
+    eql = VOR(eql, inf);
+    wrong |= VADDRDC(eql) != 8;
+
+    point_cmove_8x1w(&vA, &C0, VXOR(inf, VSET1(1)));
+  }
+
+  if (wrong) printf("sqrt-Velu         : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("sqrt-Velu         : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// an isogeny with the evaluation of T0 and T1, as in the action
+static void sqrtvelu_velu(htpoint R[], htpoint_t C, htpoint_t T0, htpoint_t T1, const htpoint_t G, const htpoint_t A, const int k)
+{
+  yISOGvelu_8x1w(R, C, G, A, k);
+  yEVALvelu_8x1w(T0, T0, R, k);
+  yEVALvelu_8x1w(T1, T1, R, k);
+}
+
+static void sqrtvelu_sqrt(htpoint R[], htpoint_t C, htpoint_t T0, htpoint_t T1, const htpoint_t G, const htpoint_t A, const int k)
+{
+  yISOGsqrt_8x1w(R, C, G, A, k);
+  yEVALsqrt_8x1w(T0, T0, R, k);
+  yEVALsqrt_8x1w(T1, T1, R, k);
+}
+
+// Velu against sqrt-Velu (an isogeny and two evaluations) for the degrees 
+// around the crossover SV_LMIN and the largest ones
+void timing_sqrtvelu()
+{
+  htpoint vA, G, T0, T1, C;
+  htpoint K[HLMAX];
+  uint64_t old_cycles;
+  int i, k;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vA.y[i] = VSET1(E[0][i]);
+    vA.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  for (k = 0; k < N; k++) {
+    if ((primeli[k] < 89) || ((primeli[k] > 139) && (primeli[k] < 337))) continue;
+    sqrtvelu_kernel(&G, &T0, &T1, &vA, k);
+    LOAD_CACHE(sqrtvelu_velu(K, &C, &T0, &T1, &G, &vA, k), 10);
+    MEASURE_TIME(sqrtvelu_velu(K, &C, &T0, &T1, &G, &vA, k), ITER_S);
+    old_cycles = diff_cycles;
+    LOAD_CACHE(sqrtvelu_sqrt(K, &C, &T0, &T1, &G, &vA, k), 10);
+    MEASURE_TIME(sqrtvelu_sqrt(K, &C, &T0, &T1, &G, &vA, k), ITER_S);
+    printf("* SQRT-VELU    : %ld -> %ld cycles (l=%d)\n", old_cycles, diff_cycles, primeli[k]);
+  }
+}
+
+// the fused isogeny computation and evaluation gives the same codomains and the
+// same images of T0, T1 (the latter in place) as yISOG_8x1w and yEVAL_8x1w for 
+// all l, and [l]P of a point P out of the kernel, along a walk
+void test_isogeval()
+{
+  htpoint vA, G, T0, T1, C0, C1, R0, R1, S0, L0, L1;
+  htpoint K[HLMAX], *R[2] = { &R1, &T1 }, *Q[2] = { &T0, &T1 };
+  __m512i inf, eql;
+  int k, wrong = 0;
+
+  for (k = 0; k < HT_NWORDS; k++) {
+    vA.y[k] = VSET1(E[0][k]);
+    vA.z[k] = VSET1(E[1][k]);
+  }
+
+  for (k = 0; k < N; k++) {
+    inf = sqrtvelu_kernel(&G, &T0, &T1, &vA, k);
+
+    yISOG_8x1w(K, &C0, &G, &vA, k);
+    yEVAL_8x1w(&R0, &T0, K, k);
+    yEVAL_8x1w(&S0, &T1, K, k);
+    yMUL_8x1w(&L0, &T0, &vA, k);
+    yISOGEVAL_8x1w(&C1, R, NULL, &G, &vA, Q, 2, k);
+    eql = VAND(point_eql(&C0, &C1), point_eql(&R0, &R1));
+    eql = VAND(eql, point_eql(&S0, &T1));
+    yISOGEVAL_8x1w(&C1, NULL, &L1, &T0, &vA, NULL, 0, k);
+    eql = VAND(eql, point_eql(&L0, &L1));
+    eql = VOR(eql, inf);
+    wrong |= VADDRDC(eql) != 8;
+
+    point_cmove_8x1w(&vA, &C0, VXOR(inf, VSET1(1)));
+  }
+
+  if (wrong) printf("Fused ISOG+EVAL   : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Fused ISOG+EVAL   : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// an isogeny with the evaluation of T0 and T1 and [l]G, as in the action 
+// (METHOD=EXTRA_DUMMY, OAYT), without and with ISOG=FUSED
+static void isogeval_split(htpoint R[], htpoint_t C, htpoint_t T0, htpoint_t T1, htpoint_t L, const htpoint_t G, const htpoint_t A, const int k)
+{
+  int s = primeli[k]>>1;
+
+  yISOG_8x1w(R, C, G, A, k);
+  yEVAL_8x1w(T0, T0, R, k);
+  yEVAL_8x1w(T1, T1, R, k);
+  yADD_8x1w(&R[s], &R[s-1], G, &R[s-2]);
+  yADD_8x1w(L, &R[s], &R[s-1], G);
+}
+
+static void isogeval_fused(htpoint_t C, htpoint_t T0, htpoint_t T1, htpoint_t L, const htpoint_t G, const htpoint_t A, const int k)
+{
+  htpoint *R[2] = { T0, T1 };
+
+  yISOGEVAL_8x1w(C, R, L, G, A, R, 2, k);
+}
+
+// the separate and the fused isogeny computation and evaluation for some degrees
+// of Velu and sqrt-Velu
+void timing_isogeval()
+{
+  htpoint vA, G, T0, T1, C, L;
+  htpoint K[HLMAX];
+  uint64_t old_cycles;
+  int i, k;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vA.y[i] = VSET1(E[0][i]);
+    vA.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  for (k = 5; k < N; k += 17) {
+    sqrtvelu_kernel(&G, &T0, &T1, &vA, k);
+    LOAD_CACHE(isogeval_split(K, &C, &T0, &T1, &L, &G, &vA, k), 10);
+    MEASURE_TIME(isogeval_split(K, &C, &T0, &T1, &L, &G, &vA, k), ITER_S);
+    old_cycles = diff_cycles;
+    LOAD_CACHE(isogeval_fused(&C, &T0, &T1, &L, &G, &vA, k), 10);
+    MEASURE_TIME(isogeval_fused(&C, &T0, &T1, &L, &G, &vA, k), ITER_S);
+    printf("* ISOG+EVAL    : %ld -> %ld cycles (l=%d, fused)\n", old_cycles, diff_cycles, primeli[k]);
+  }
+}
+
+// the multi-point evaluation gives the same images of four points (in place) as
+// yEVAL_8x1w for all l, and so does its 2x4w version in the eight instances, 
+// along a walk
+void test_evalmulti()
+{
+  htpoint vA, G, C, U, T[EVAL_NQMAX], R[EVAL_NQMAX];
+  htpoint K[HLMAX], *Q[EVAL_NQMAX];
+  llpoint_t llA[8], llG[8], llT[EVAL_NQMAX][8], llC, llK[HLMAX], *llQ[EVAL_NQMAX];
+  __m512i inf, eql;
+  int i, h, k, wrong = 0;
+
+  for (k = 0; k < HT_NWORDS; k++) {
+    vA.y[k] = VSET1(E[0][k]);
+    vA.z[k] = VSET1(E[1][k]);
+  }
+  for (h = 0; h < EVAL_NQMAX; h++) Q[h] = &T[h];
+
+  for (k = 0; k < N; k++) {
+    inf = sqrtvelu_kernel(&G, &T[0], &T[1], &vA, k);
+    yDBL_8x1w(&T[2], &T[0], &vA);
+    yDBL_8x1w(&T[3], &T[1], &vA);
+
+    yISOG_8x1w(K, &C, &G, &vA, k);
+    for (h = 0; h < EVAL_NQMAX; h++) yEVAL_8x1w(&R[h], &T[h], K, k);
+
+    point_ht2ll_8x1w(llA, &vA);
+    point_ht2ll_8x1w(llG, &G);
+    for (h = 0; h < EVAL_NQMAX; h++) point_ht2ll_8x1w(llT[h], &T[h]);
+    for (i = 0; i < 8; i++) {
+      for (h = 0; h < EVAL_NQMAX; h++) llQ[h] = &llT[h][i];
+      yISOG_2x4w(llK, llC, llG[i], llA[i], k);
+      yEVALmulti_2x4w(llQ, llQ, llK, EVAL_NQMAX, k);
+    }
+
+    yEVALmulti_8x1w(Q, Q, K, EVAL_NQMAX, k);
+    eql = VSET1(1);
+    for (h = 0; h < EVAL_NQMAX; h++) {
+      point_ll2ht_8x1w(&U, llT[h]);
+      eql = VAND(eql, point_eql(&R[h], &T[h]));
+      eql = VAND(eql, point_eql(&R[h], &U));
+    }
+    eql = VOR(eql, inf);
+    wrong |= VADDRDC(eql) != 8;
+
+    point_cmove_8x1w(&vA, &C, VXOR(inf, VSET1(1)));
+  }
+
+  if (wrong) printf("Multi-point EVAL  : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Multi-point EVAL  : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// the evaluation of T0 and T1, as in the action, one after the other and in one
+// pass over K[]
+static void evalmulti_split(htpoint_t T0, htpoint_t T1, const htpoint K[], const int k)
+{
+  yEVAL_8x1w(T0, T0, K, k);
+  yEVAL_8x1w(T1, T1, K, k);
+}
+
+static void evalmulti_multi(htpoint_t T0, htpoint_t T1, const htpoint K[], const int k)
+{
+  htpoint *Q[2] = { T0, T1 };
+
+  yEVALmulti_8x1w(Q, Q, K, 2, k);
+}
+
+static void evalmulti_split_2x4w(llpoint_t T0, llpoint_t T1, const llpoint_t K[], const int k)
+{
+  yEVAL_2x4w(T0, T0, K, k);
+  yEVAL_2x4w(T1, T1, K, k);
+}
+
+static void evalmulti_multi_2x4w(llpoint_t T0, llpoint_t T1, const llpoint_t K[], const int k)
+{
+  llpoint_t *Q[2] = { (llpoint_t *)T0, (llpoint_t *)T1 };
+
+  yEVALmulti_2x4w(Q, Q, K, 2, k);
+}
+
+// the evaluation of two points with yEVAL and with yEVALmulti for every third 
+// degree, in the 8x1w and 2x4w versions
+void timing_evalmulti()
+{
+  htpoint vA, G, T0, T1, C;
+  htpoint K[HLMAX];
+  llpoint_t llA[8], llG[8], llT0[8], llT1[8], llC, llK[HLMAX];
+  uint64_t old_cycles;
+  int i, k;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vA.y[i] = VSET1(E[0][i]);
+    vA.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  for (k = 0; k < N; k += 3) {
+    sqrtvelu_kernel(&G, &T0, &T1, &vA, k);
+    yISOG_8x1w(K, &C, &G, &vA, k);
+    LOAD_CACHE(evalmulti_split(&T0, &T1, K, k), 10);
+    MEASURE_TIME(evalmulti_split(&T0, &T1, K, k), ITER_S);
+    old_cycles = diff_cycles;
+    LOAD_CACHE(evalmulti_multi(&T0, &T1, K, k), 10);
+    MEASURE_TIME(evalmulti_multi(&T0, &T1, K, k), ITER_S);
+    printf("* EVAL 8x1w    : %ld -> %ld cycles (l=%d, 2 points)\n", old_cycles, diff_cycles, primeli[k]);
+
+    point_ht2ll_8x1w(llA, &vA);
+    point_ht2ll_8x1w(llG, &G);
+    point_ht2ll_8x1w(llT0, &T0);
+    point_ht2ll_8x1w(llT1, &T1);
+    yISOG_2x4w(llK, llC, llG[0], llA[0], k);
+    LOAD_CACHE(evalmulti_split_2x4w(llT0[0], llT1[0], llK, k), 10);
+    MEASURE_TIME(evalmulti_split_2x4w(llT0[0], llT1[0], llK, k), ITER_S);
+    old_cycles = diff_cycles;
+    LOAD_CACHE(evalmulti_multi_2x4w(llT0[0], llT1[0], llK, k), 10);
+    MEASURE_TIME(evalmulti_multi_2x4w(llT0[0], llT1[0], llK, k), ITER_S);
+    printf("* EVAL 2x4w    : %ld -> %ld cycles (l=%d, 2 points)\n", old_cycles, diff_cycles, primeli[k]);
+  }
+}
+
+// a point G of order l = primeli[k] on the curve A in the lanes of e >= 0 and
+// on its twist in the others (or O), as the action takes it for the exponent e
+static __m512i radical_kernel(htpoint_t G, const htpoint_t A, const __m512i e, const int k)
+{
+  htpoint T;
+  int i;
+
+  elligator_8x1w(&T, G, A);
+  point_cswap_8x1w(G, &T, VAND(e, VSET1(1)));
+  yDBL_8x1w(G, G, A);
+  yDBL_8x1w(G, G, A);
+  for (i = 0; i < N; i++)
+    if (i != k) yMUL_8x1w(G, G, A, i);
+
+  return point_isinf_8x1w(G);
+}
+
+// a chain of B[k] radical isogenies (|e| of them real ones) gives the same curve
+// as |e| Velu isogenies with a new kernel point each, from the base curve and
+// from the curve it leads to, in both the 8x1w and 2x4w versions
+void test_radical()
+{
+  htpoint vA, G, H, C, A0, A1;
+  htpoint K[HLMAX];
+  llpoint_t llA[8], llG[8], llC[8];
+  __m512i vsk[1][N], e, cnt, go, inf, eql;
+  int i, k, r, wrong = 0;
+
+  for (k = RAD_KMIN; k <= RAD_KMAX; k++) {
+    for (i = 0; i < HT_NWORDS; i++) {
+      vA.y[i] = VSET1(E[0][i]);
+      vA.z[i] = VSET1(E[1][i]);
+    }
+
+    for (r = 0; r < 2; r++) {
+      random_sk_8x1w(vsk, NULL, 1);
+      e = vsk[0][k];
+
+      do inf = radical_kernel(&G, &vA, e, k);
+      while (VTEST(inf, inf));
+      radical_8x1w(&C, &vA, &G, e, k, B[k]);
+
+      point_copy_8x1w(&A0, &vA);
+      cnt = VSHR(e, 1);
+      while (VTEST(cnt, cnt)) {
+        inf = radical_kernel(&H, &A0, e, k);
+        yISOG_8x1w(K, &A1, &H, &A0, k);
+        go = VAND(VXOR(inf, VSET1(1)), VSHR(VSUB(VZERO, cnt), 63));
+        point_cmove_8x1w(&A0, &A1, go);
+        cnt = VSUB(cnt, go);
+      }
+
+      point_ht2ll_8x1w(llA, &vA);
+      point_ht2ll_8x1w(llG, &G);
+      for (i = 0; i < 8; i++) radical_2x4w(llC[i], llA[i], llG[i], ((uint64_t *)&e)[i], k, B[k]);
+      point_ll2ht_8x1w(&A1, llC);
+
+      eql = VAND(point_eql(&C, &A0), point_eql(&C, &A1));
+      wrong |= VADDRDC(eql) != 8;
+      point_copy_8x1w(&vA, &C);
+    }
+  }
+
+  if (wrong) printf("radical isogeny   : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("radical isogeny   : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// a chain of B[k] radical isogenies of degree l = 3, 5, 7 on the base curve
+void timing_radical()
+{
+  htpoint vA, G, C;
+  llpoint_t llA[8], llG[8], llC;
+  __m512i vsk[1][N], e;
+  int i, k;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vA.y[i] = VSET1(E[0][i]);
+    vA.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  for (k = RAD_KMIN; k <= RAD_KMAX; k++) {
+    random_sk_8x1w(vsk, NULL, 1);
+    e = vsk[0][k];
+    radical_kernel(&G, &vA, e, k);
+    LOAD_CACHE(radical_8x1w(&C, &vA, &G, e, k, B[k]), 10);
+    MEASURE_TIME(radical_8x1w(&C, &vA, &G, e, k, B[k]), ITER_S);
+    printf("* RADICAL 8x1w : %ld cycles (l=%d, %d steps)\n", diff_cycles, primeli[k], B[k]);
+    point_ht2ll_8x1w(llA, &vA);
+    point_ht2ll_8x1w(llG, &G);
+    LOAD_CACHE(radical_2x4w(llC, llA[0], llG[0], ((uint64_t *)&e)[0], k, B[k]), 10);
+    MEASURE_TIME(radical_2x4w(llC, llA[0], llG[0], ((uint64_t *)&e)[0], k, B[k]), ITER_S);
+    printf("* RADICAL 2x4w : %ld cycles (l=%d, %d steps)\n", diff_cycles, primeli[k], B[k]);
+  }
+}
+
+// the Montgomery coefficients A of the eight curves in [0, p) in radix-64
+static void curve_u64(uint64_t (*r)[8], const htpoint_t A)
+{
+  htfe_t t0, t1, t2;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    t1[i] = VSET1(E[0][i]);
+    t2[i] = VSET1(E[1][i]);
+  }
+  gfp_sginv_8x1w(t0, A->z);
+  gfp_mul_8x1w(t0, A->y, t0);
+  gfp_mul_8x1w(t0, t0, t2);
+  gfp_sub_8x1w(t0, t0, t1);
+  gfp_mont2num_8x1w(t0, t0);
+  mpi_store_8x1w(r, t0);
+}
+
+// the curve of lane 0 of C in all lanes 
+static void curve_bcast(htpoint_t R, const htpoint_t C)
+{
+  uint64_t y[HT_NWORDS], z[HT_NWORDS];
+  int i;
+
+  get_channel_8x1w(y, C->y, 0);
+  get_channel_8x1w(z, C->z, 0);
+  for (i = 0; i < HT_NWORDS; i++) {
+    R->y[i] = VSET1(y[i]);
+    R->z[i] = VSET1(z[i]);
+  }
+}
+
+// the group action on a cached curve gives the same curves as without cache
+void test_cache()
+{
+  htpoint vE, vP, C0, C1, T0, T1;
+  __m512i vsk[N];
+  uint64_t a[8][8], r0[8][8], r1[8][8];
+  int i, wrong = 0;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+  }
+  random_sk_8x1w(&vsk, NULL, 1);
+  action(&C0, vsk, &vE);
+  curve_bcast(&vP, &C0);                // a static curve in all lanes 
+  curve_u64(a, &vP);
+
+  wrong |= point_first_8x1w(&T0, &T1, &vP);
+  wrong |= cache_add(a[0]) != 0;
+  wrong |= cache_add(a[0]) != 0;        // already cached
+  wrong |= !point_first_8x1w(&T0, &T1, &vP);
+
+  action(&C1, vsk, &vP);
+  cache_clear();
+  wrong |= point_first_8x1w(&T0, &T1, &vP);
+  action(&C0, vsk, &vP);
+  curve_u64(r0, &C0);
+  curve_u64(r1, &C1);
+  wrong |= memcmp(r0, r1, sizeof(r0));
+
+  if (wrong) printf("Curve cache       : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Curve cache       : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// the first round on a static curve: Elligator and the cofactor clearing over
+// COMPBA[1] against the cache lookup
+void timing_cache()
+{
+  htpoint vE, vP, T0, T1;
+  __m512i vsk[N];
+  uint64_t a[8][8], old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+  }
+  random_sk_8x1w(&vsk, NULL, 1);
+  action(&vP, vsk, &vE);
+  curve_bcast(&vP, &vP);
+  curve_u64(a, &vP);
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  MEASURE_TIME(cache_add(a[0]), 1);
+  printf("* CACHE ADD    : %ld cycles (one curve)\n", diff_cycles);
+  LOAD_CACHE(basepoints_elligator(&T0, &T1, &vP), 10);
+  MEASURE_TIME(basepoints_elligator(&T0, &T1, &vP), ITER_S);
+  old_cycles = diff_cycles;
+  LOAD_CACHE(point_first_8x1w(&T0, &T1, &vP), 10);
+  MEASURE_TIME(point_first_8x1w(&T0, &T1, &vP), ITER_M);
+  printf("* CURVE CACHE  : %ld -> %ld cycles (first round on a cached curve)\n", old_cycles, diff_cycles);
+  cache_clear();
+}
+
 int main() 
 {
+  test_rng();
+  test_mulka();
+  test_jacobi();
+#ifdef RNG_FIXED
+  rng_seed(rng_fixed);                  // reproducible runs
+#endif
   test_action();
+  test_keygen();
+#ifdef ELLIGATOR_FIXED
+  test_elligator();
+#endif
+  test_basepoints();
+  test_cache();
+  test_sqrtvelu();
+  test_isogeval();
+  test_evalmulti();
+  test_radical();
+  test_loadstore();
+  test_handover();
+#ifdef METHOD_CONTINUOUS
+  test_stream();
+#endif
+#ifdef METHOD_COMBINED
+  test_batches();
+#endif
   // test_multi_actions(1000);
+  timing_mul();
+  timing_ymul();
+  timing_rng();
+  timing_keygen();
+  timing_exp();
+  timing_elligator();
+  timing_basepoints();
+  timing_cache();
+  timing_sqrtvelu();
+  timing_isogeval();
+  timing_evalmulti();
+  timing_radical();
+  timing_loadstore();
+  timing_handover();
   timing_action();
+#ifdef METHOD_CONTINUOUS
+  timing_stream();
+#endif
+#ifdef METHOD_COMBINED
+  timing_batches();
+#endif
 
   return 0;
 }
@@ -220,10 +220,40 @@ void timing_action()
   /* ------------------------------------------------------------------------ */
 }
 
+void timing_exp()
+{
+  int i;
+  llfe_t a, r;
+  uint64_t old_cycles;
+
+  a[0] = VSET(E[0][9] , E[0][6], E[0][3], E[0][0], E[1][9] , E[1][6], E[1][3], E[1][0]);
+  a[1] = VSET(E[0][10], E[0][7], E[0][4], E[0][1], E[1][10], E[1][7], E[1][4], E[1][1]);
+  a[2] = VSET(E[0][11], E[0][8], E[0][5], E[0][2], E[1][11], E[1][8], E[1][5], E[1][2]);
+
+  // benchmark 
+  /* ------------------------------------------------------------------------ */
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(gfp_pow_2x4w(r, a, u64_psub2), 100);
+  MEASURE_TIME(gfp_pow_2x4w(r, a, u64_psub2), ITER_S);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_inv_2x4w(r, a), ITER_S);
+  printf("* INVERSION    : %ld -> %ld cycles (%ld saved)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+
+  MEASURE_TIME(gfp_pow_2x4w(r, a, u64_pdiv2), ITER_S);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_euler_2x4w(a), ITER_S);
+  printf("* EULER        : %ld -> %ld cycles (%ld saved per elligator)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+  MEASURE_TIME(gfp_jacobi_2x4w(a), ITER_S);
+  printf("* JACOBI       : %ld -> %ld cycles (%ld saved per elligator)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+  /* ------------------------------------------------------------------------ */
+}
+
 int main() 
 {
   test_action();
   // test_multi_actions(1000);
+  timing_exp();
   timing_action();
 
   return 0;
@@ -0,0 +1,263 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#include "action.h"
+#include "pool.h"
+#include "cache.h"
+#include "utils.h"
+#include <string.h>
+#include <time.h>
+
+#define TEST_JOBS 4                     // jobs of the correctness test
+#define JOBS_PER_THREAD 4               // jobs per worker of the benchmark
+#define CACHE_THREADS 4                 // threads that add curves to the cache at once
+
+// random private keys of the eight lanes, on the base curve 
+static void job_init(pool_job *job)
+{
+  int i;
+
+  random_sk_8x1w(&job->sk, NULL, 1);
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    job->A.y[i] = VSET1(E[0][i]);
+    job->A.z[i] = VSET1(E[1][i]);
+  }
+}
+
+// r[j] = A24plus/C24 of lane j in the number domain
+static void point_normalize(uint64_t r[8][HT_NWORDS], const htpoint_t P)
+{
+  htfe_t t0;
+  int j;
+
+  gfp_sginv_8x1w(t0, P->z);
+  gfp_mul_8x1w(t0, P->y, t0);
+  gfp_mont2num_8x1w(t0, t0);
+  for (j = 0; j < 8; j++) get_channel_8x1w(r[j], t0, j);
+}
+
+// the Montgomery coefficients A = 4*A24plus/C24 - 2 of the eight curves, in
+// [0, p) in radix-64
+static void curve_u64(uint64_t (*r)[8], const htpoint_t A)
+{
+  htfe_t t0, t1, t2;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    t1[i] = VSET1(E[0][i]);
+    t2[i] = VSET1(E[1][i]);
+  }
+  gfp_sginv_8x1w(t0, A->z);
+  gfp_mul_8x1w(t0, A->y, t0);
+  gfp_mul_8x1w(t0, t0, t2);
+  gfp_sub_8x1w(t0, t0, t1);
+  gfp_mont2num_8x1w(t0, t0);
+  mpi_store_8x1w(r, t0);
+}
+
+// a thread that adds one curve to the cache, together with the other threads
+typedef struct {
+  pthread_barrier_t *start;
+  const uint64_t *a;
+  int r;
+} cache_job;
+
+static void *cache_worker(void *arg)
+{
+  cache_job *job = arg;
+
+  pthread_barrier_wait(job->start);
+  job->r = cache_add(job->a);
+  return NULL;
+}
+
+// online CPUs sorted for the benchmark: nosmt[] holds one CPU per physical core,
+// smt[] holds the CPUs core by core (all SMT siblings of a core in a row);
+// return the number of physical cores, *nlogical is the number of CPUs 
+static int cpu_topology(int *nosmt, int *smt, int *nlogical)
+{
+  int key[POOL_MAXTHREADS], ncpu, ncores = 0, n = 0, pkg, core, i, j;
+  char path[128];
+  FILE *f;
+
+  ncpu = (int) sysconf(_SC_NPROCESSORS_ONLN);
+  if (ncpu > POOL_MAXTHREADS) ncpu = POOL_MAXTHREADS;
+
+  for (i = 0; i < ncpu; i++) {
+    pkg = core = 0;
+    sprintf(path, "/sys/devices/system/cpu/cpu%d/topology/physical_package_id", i);
+    if ((f = fopen(path, "r"))) { if (fscanf(f, "%d", &pkg) != 1) pkg = 0; fclose(f); }
+    sprintf(path, "/sys/devices/system/cpu/cpu%d/topology/core_id", i);
+    // without topology information every CPU counts as a core of its own 
+    if ((f = fopen(path, "r"))) { if (fscanf(f, "%d", &core) != 1) core = i; fclose(f); }
+    else core = i;
+    key[i] = (pkg << 16) | core;
+
+    for (j = 0; j < i; j++) if (key[j] == key[i]) break;
+    if (j == i) nosmt[ncores++] = i;
+  }
+
+  for (i = 0; i < ncores; i++)
+    for (j = 0; j < ncpu; j++) 
+      if (key[j] == key[nosmt[i]]) smt[n++] = j;
+
+  *nlogical = ncpu;
+  return ncores;
+}
+
+// actions per second of nthreads workers pinned to cpus[0], ..., cpus[nthreads-1]
+static double pool_throughput(pool_job *job, const int *cpus, const int nthreads)
+{
+  struct timespec start, end;
+  int i, njobs = nthreads*JOBS_PER_THREAD;
+  double sec;
+  pool_t *pool;
+
+  if (!(pool = pool_create(nthreads, cpus))) return 0;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (i = 0; i < njobs; i++) pool_submit(pool, &job[i]);
+  pool_wait(pool);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  pool_destroy(pool);
+
+  sec = (end.tv_sec-start.tv_sec) + (end.tv_nsec-start.tv_nsec)*1e-9;
+  return 8*njobs/sec;
+}
+
+// the jobs computed by the pool must equal the jobs computed by the main thread
+void test_pool()
+{
+  pool_job *job;
+  htpoint vC;
+  uint64_t r0[8][HT_NWORDS], r1[8][HT_NWORDS];
+  int i, wrong = 0;
+  pool_t *pool;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST:");
+  puts("-------------------------------------------------------------------");
+
+  job = aligned_alloc(64, TEST_JOBS*sizeof(pool_job));
+  for (i = 0; i < TEST_JOBS; i++) job_init(&job[i]);
+
+  pool = pool_create(2, NULL);
+  for (i = 0; i < TEST_JOBS; i++) pool_submit(pool, &job[i]);
+  pool_wait(pool);
+  pool_destroy(pool);
+
+  for (i = 0; i < TEST_JOBS; i++) {
+    action(&vC, job[i].sk, &job[i].A);
+    point_normalize(r0, &vC);
+    point_normalize(r1, &job[i].C);
+    wrong |= memcmp(r0, r1, sizeof(r0));
+  }
+  free(job);
+
+  if (wrong) printf("Pool (%d jobs) : \x1b[31mNOT PASS!\x1b[0m\n", TEST_JOBS);
+  else printf("Pool (%d jobs) : \x1b[32mPASS!\x1b[0m\n", TEST_JOBS);
+}
+
+// CACHE_THREADS threads add different curves to the cache at once; the group 
+// action on these curves must give the same curves with and without the cache 
+void test_cache_threads()
+{
+  pthread_barrier_t start;
+  pthread_t tid[CACHE_THREADS];
+  cache_job job[CACHE_THREADS];
+  htpoint vE, vP, C0, C1, T0, T1;
+  __m512i vsk[N];
+  uint64_t a[8][8], r0[8][HT_NWORDS], r1[8][HT_NWORDS], y[HT_NWORDS], z[HT_NWORDS];
+  int i, k, wrong = 0;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+  }
+  random_sk_8x1w(&vsk, NULL, 1);
+  action(&vP, vsk, &vE);                // eight different static curves
+  curve_u64(a, &vP);
+
+  pthread_barrier_init(&start, NULL, CACHE_THREADS);
+  for (k = 0; k < CACHE_THREADS; k++) {
+    job[k].start = &start;
+    job[k].a = a[k];
+    pthread_create(&tid[k], NULL, cache_worker, &job[k]);
+  }
+  for (k = 0; k < CACHE_THREADS; k++) {
+    pthread_join(tid[k], NULL);
+    wrong |= job[k].r != 0;
+  }
+  pthread_barrier_destroy(&start);
+
+  // lane k holds the cached curve k % CACHE_THREADS
+  for (k = 0; k < 8; k++) {
+    get_channel_8x1w(y, vP.y, k % CACHE_THREADS);
+    get_channel_8x1w(z, vP.z, k % CACHE_THREADS);
+    for (i = 0; i < HT_NWORDS; i++) {
+      vE.y[i] = VMMOV(vE.y[i], 1 << k, VSET1(y[i]));
+      vE.z[i] = VMMOV(vE.z[i], 1 << k, VSET1(z[i]));
+    }
+  }
+  wrong |= !point_first_8x1w(&T0, &T1, &vE);   // every curve has been added
+  action(&C1, vsk, &vE);
+  cache_clear();
+  action(&C0, vsk, &vE);
+  point_normalize(r0, &C0);
+  point_normalize(r1, &C1);
+  wrong |= memcmp(r0, r1, sizeof(r0));
+
+  if (wrong) printf("Cache (%d threads) : \x1b[31mNOT PASS!\x1b[0m\n", CACHE_THREADS);
+  else printf("Cache (%d threads) : \x1b[32mPASS!\x1b[0m\n", CACHE_THREADS);
+
+  puts("*******************************************************************");
+}
+
+// actions per second against the number of worker threads, first with one 
+// worker per physical core, then with the SMT siblings of each core in use 
+void timing_pool()
+{
+  int nosmt[POOL_MAXTHREADS], smt[POOL_MAXTHREADS], ncores, nlogical, t, i;
+  double base, r;
+  pool_job *job;
+
+  ncores = cpu_topology(nosmt, smt, &nlogical);
+  printf("* %d physical cores, %d logical CPUs\n", ncores, nlogical);
+
+  job = aligned_alloc(64, nlogical*JOBS_PER_THREAD*sizeof(pool_job));
+  for (i = 0; i < nlogical*JOBS_PER_THREAD; i++) job_init(&job[i]);
+
+  puts("* without SMT siblings:");
+  base = pool_throughput(job, nosmt, 1);
+  for (t = 1; t <= ncores; t = ((t < ncores) && (2*t > ncores)) ? ncores : 2*t) {
+    r = (t == 1) ? base : pool_throughput(job, nosmt, t);
+    printf("  - %3d threads : %8.1f actions/s (x%.2f)\n", t, r, r/base);
+  }
+
+  if (nlogical > ncores) {
+    puts("* with SMT siblings:");
+    for (t = 2; t <= nlogical; t = ((t < nlogical) && (2*t > nlogical)) ? nlogical : 2*t) {
+      r = pool_throughput(job, smt, t);
+      printf("  - %3d threads : %8.1f actions/s (x%.2f)\n", t, r, r/base);
+    }
+  }
+  else puts("* no SMT siblings");
+
+  free(job);
+}
+
+int main() 
+{
+  test_pool();
+  test_cache_threads();
+  timing_pool();
+
+  return 0;
+}
@@ -0,0 +1,204 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#define _GNU_SOURCE
+#include <sched.h>
+#include <errno.h>
+#include "action.h"
+#include "pool.h"
+
+// A group action takes ~10^8 cycles, so a mutex per queue costs nothing 
+// compared to a job and keeps the work stealing simple. 
+
+static pool_job *queue_pop_head(pool_queue *q)
+{
+  pool_job *job = NULL;
+
+  pthread_mutex_lock(&q->lock);
+  if (q->head != q->tail) job = q->job[(q->head++) & (POOL_QLEN-1)];
+  pthread_mutex_unlock(&q->lock);
+
+  return job;
+}
+
+static pool_job *queue_pop_tail(pool_queue *q)
+{
+  pool_job *job = NULL;
+
+  pthread_mutex_lock(&q->lock);
+  if (q->head != q->tail) job = q->job[(--q->tail) & (POOL_QLEN-1)];
+  pthread_mutex_unlock(&q->lock);
+
+  return job;
+}
+
+static int queue_push(pool_queue *q, pool_job *job)
+{
+  int r = -1;
+
+  pthread_mutex_lock(&q->lock);
+  if (q->tail - q->head < POOL_QLEN) {
+    q->job[(q->tail++) & (POOL_QLEN-1)] = job;
+    r = 0;
+  }
+  pthread_mutex_unlock(&q->lock);
+
+  return r;
+}
+
+// take a job from the own queue, or steal one from the other queues
+static pool_job *pool_take(pool_t *pool, const int id)
+{
+  pool_job *job;
+  int i;
+
+  if ((job = queue_pop_head(&pool->queue[id]))) return job;
+  for (i = 1; i < pool->nthreads; i++)
+    if ((job = queue_pop_tail(&pool->queue[(id+i) % pool->nthreads]))) return job;
+
+  return NULL;
+}
+
+static void *pool_run(void *arg)
+{
+  struct pool_worker *w = arg;
+  pool_t *pool = w->pool;
+  pool_job *job;
+
+  while (1) {
+    if ((job = pool_take(pool, w->id))) {
+      pthread_mutex_lock(&pool->lock);
+      pool->queued--;
+      pthread_mutex_unlock(&pool->lock);
+
+      action(&job->C, job->sk, &job->A);
+
+      pthread_mutex_lock(&pool->lock);
+      if (--pool->pending == 0) pthread_cond_broadcast(&pool->done);
+      pthread_mutex_unlock(&pool->lock);
+      continue;
+    }
+
+    // no job in any queue: sleep until a job is submitted
+    pthread_mutex_lock(&pool->lock);
+    while ((pool->queued == 0) && !pool->stop) pthread_cond_wait(&pool->work, &pool->lock);
+    if ((pool->queued == 0) && pool->stop) {
+      pthread_mutex_unlock(&pool->lock);
+      break;
+    }
+    pthread_mutex_unlock(&pool->lock);
+  }
+
+  return NULL;
+}
+
+// start nthreads workers, worker i pinned to core cpus[i] (not pinned if cpus
+// is NULL or cpus[i] < 0); return NULL on failure
+pool_t *pool_create(const int nthreads, const int *cpus)
+{
+  pool_t *pool;
+  pthread_attr_t attr;
+  cpu_set_t set;
+  int i, err;
+
+  if ((nthreads < 1) || (nthreads > POOL_MAXTHREADS)) return NULL;
+  if (!(pool = calloc(1, sizeof(pool_t)))) return NULL;
+
+  pool->nthreads = nthreads;
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->work, NULL);
+  pthread_cond_init(&pool->done, NULL);
+  for (i = 0; i < nthreads; i++) pthread_mutex_init(&pool->queue[i].lock, NULL);
+
+  for (i = 0; i < nthreads; i++) {
+    pool->worker[i].pool = pool;
+    pool->worker[i].id = i;
+    pool->worker[i].cpu = cpus ? cpus[i] : -1;
+
+    // the action keeps large arrays on the stack
+    pthread_attr_init(&attr);
+    err = pthread_attr_setstacksize(&attr, POOL_STACK);
+    if (!err && (pool->worker[i].cpu >= 0)) {
+      CPU_ZERO(&set);
+      // a core that does not exist fails here instead of leaving the worker unpinned
+      if (pool->worker[i].cpu < CPU_SETSIZE) {
+        CPU_SET(pool->worker[i].cpu, &set);
+        err = pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &set);
+      }
+      else err = EINVAL;
+    }
+    if (err || pthread_create(&pool->worker[i].thread, &attr, pool_run, &pool->worker[i])) {
+      pthread_attr_destroy(&attr);
+      pool->nthreads = i;
+      pool_destroy(pool);
+      return NULL;
+    }
+    pthread_attr_destroy(&attr);
+  }
+
+  return pool;
+}
+
+// queue the job (round-robin over the workers) from the thread that owns the 
+// pool; the job must not be touched until pool_wait() returns
+// return 0 on success, -1 if all queues are full
+int pool_submit(pool_t *pool, pool_job *job)
+{
+  int i, id;
+
+  // count the job first, so that a worker never sees it before it is counted 
+  pthread_mutex_lock(&pool->lock);
+  pool->queued++;
+  pool->pending++;
+  pthread_mutex_unlock(&pool->lock);
+
+  for (i = 0; i < pool->nthreads; i++) {
+    id = pool->next;
+    pool->next = (pool->next + 1) % pool->nthreads;
+    if (queue_push(&pool->queue[id], job) == 0) {
+      pthread_mutex_lock(&pool->lock);
+      pthread_cond_signal(&pool->work);
+      pthread_mutex_unlock(&pool->lock);
+      return 0;
+    }
+  }
+
+  pthread_mutex_lock(&pool->lock);
+  pool->queued--;
+  pool->pending--;
+  pthread_mutex_unlock(&pool->lock);
+
+  return -1;
+}
+
+// wait until all the submitted jobs are done
+void pool_wait(pool_t *pool)
+{
+  pthread_mutex_lock(&pool->lock);
+  while (pool->pending > 0) pthread_cond_wait(&pool->done, &pool->lock);
+  pthread_mutex_unlock(&pool->lock);
+}
+
+// finish the queued jobs and stop the workers 
+void pool_destroy(pool_t *pool)
+{
+  int i;
+
+  pthread_mutex_lock(&pool->lock);
+  pool->stop = 1;
+  pthread_cond_broadcast(&pool->work);
+  pthread_mutex_unlock(&pool->lock);
+
+  for (i = 0; i < pool->nthreads; i++) pthread_join(pool->worker[i].thread, NULL);
+  for (i = 0; i < pool->nthreads; i++) pthread_mutex_destroy(&pool->queue[i].lock);
+  pthread_cond_destroy(&pool->done);
+  pthread_cond_destroy(&pool->work);
+  pthread_mutex_destroy(&pool->lock);
+  free(pool);
+}
@@ -96,56 +96,87 @@ __m512i point_isinf_8x1w(const htpoint_t P)
   return r;      
 }
 
+// check whether the curve A is the public curve (y:z) in all eight lanes, i.e.
+// whether yA*z == zA*y; the curves are public, so a plain flag is returned. 
+int curve_iseql_8x1w(const htpoint_t A, const uint64_t *y, const uint64_t *z)
+{
+  htfe_t t0, t1;
+  __m512i r;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    t0[i] = VSET1(z[i]);
+    t1[i] = VSET1(y[i]);
+  }
+
+  gfp_mul_8x1w(t0, A->y, t0);      // t0 = yA*z
+  gfp_mul_8x1w(t1, A->z, t1);      // t1 = zA*y
+  gfp_sub_8x1w(t0, t0, t1);        // t0 = yA*z - zA*y
+  gfp_rdcp_8x1w(t0, t0);           // reduce t0 to [0, p)
+  r = gfp_iszero_8x1w(t0);
+
+  return VTEST(r, r) == 0xFF;
+}
+
 // (8x1)-way y-coordinate doubling R = [2]P on twisted Edwards curve,
 // which is very similar to x-coordinate doubling on Montgomery curve. 
 // NOTE: A->y = A24plus = a, A->z = C24 = a-d
-void yDBL_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A)
+// The body is always inlined so that yMUL can keep the temporaries of the whole
+// ladder step in one frame; yDBL_8x1w below is the out-of-line entry point. 
+static inline __attribute__((always_inline)) 
+void ydbl_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A)
 {
-  htfe_t t0, t1;
+  htfe_t t0, t1, t2;
 
   // Here we use Montgomery curve projective X and Z coordinates in the comments 
   // for easy understanding.
 
-  gfp_sqr_8x1w(t0, P->y);         // t0 = (X-Z)^2
-  gfp_sqr_8x1w(t1, P->z);         // t1 = (X+Z)^2
-  gfp_mul_8x1w(R->z, A->z, t0);   // zR = C24*(X-Z)^2
-  gfp_mul_8x1w(R->y, R->z, t1);   // yR = C24*(X-Z)^2*(X+Z)^2
-  gfp_sub_8x1w(t1, t1, t0);       // t1 = (X+Z)^2-(X-Z)^2 = 4XZ
-  gfp_mul_8x1w(t0, A->y, t1);     // t0 = A24plus*4XZ
-  gfp_add_8x1w(R->z, R->z, t0);   // zR = C24*(X-Z)^2+A24plus*4XZ
-  gfp_mul_8x1w(t0, R->z, t1);     // t0 = [C24*(X-Z)^2+A24plus*4XZ]*4XZ 
+  gfp_sqr2_8x1w(t0, P->y, t1, P->z); // t0 = (X-Z)^2, t1 = (X+Z)^2
+  gfp_subnr_8x1w(t2, t1, t0);     // t2 = (X+Z)^2-(X-Z)^2 = 4XZ in [0, 4p)
+  gfp_carryp_8x1w(t2);
+  gfp_mul2_8x1w(R->z, A->z, t0, t0, A->y, t2); // zR = C24*(X-Z)^2, t0 = A24plus*4XZ
+  gfp_addnr_8x1w(t0, R->z, t0);   // t0 = C24*(X-Z)^2+A24plus*4XZ in [0, 4p)
+  gfp_carryp_8x1w(t0);
 
-  // Now yR is actually X2 of xDBL; t0 is actually Z2 of xDBL
-  // We convert them to twsited Edwards curve projective y and z coordinates. 
-  gfp_add_8x1w(R->z, R->y, t0);   // zR = X2 + Z2
-  gfp_sub_8x1w(R->y, R->y, t0);   // yR = X2 - Z2
+  // X2 = C24*(X-Z)^2*(X+Z)^2 and Z2 = [C24*(X-Z)^2+A24plus*4XZ]*4XZ of xDBL 
+  // are converted to twsited Edwards curve projective y and z coordinates. 
+  gfp_muladdsub_8x1w(R->z, R->y, R->z, t1, t0, t2); // zR = X2 + Z2, yR = X2 - Z2
 }
 
 // (8x1)-way y-coordinate addition R = P + Q on twisted Edwards curve,
 // which is very similar to x-coordinate addition on Montgomery curve. 
 // NOTE: A->y = A24plus = a, A->z = C24 = a-d.
-void yADD_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t Q, const htpoint_t PQ)
+// R may alias PQ (but not P or Q), which yMUL uses to update the ladder in place.
+static inline __attribute__((always_inline)) 
+void yadd_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t Q, const htpoint_t PQ)
 {
-  htfe_t t0, t1, t2, t3;
+  htfe_t t2, t3;
 
   // Here we use Montgomery curve projective X and Z coordinates in the comments 
   // for easy understanding.
 
-  gfp_add_8x1w(t2, PQ->z, PQ->y); // t2 = 2X1 
-  gfp_sub_8x1w(t3, PQ->z, PQ->y); // t3 = 2Z1
-  gfp_mul_8x1w(t0, P->z, Q->y);   // t0 = (X2+Z2)*(X3-Z3)
-  gfp_mul_8x1w(t1, P->y, Q->z);   // t1 = (X2-Z2)*(X3+Z3)
-  gfp_sub_8x1w(R->z, t0, t1);     // zR = (X2+Z2)*(X3-Z3)-(X2-Z2)*(X3+Z3)
-  gfp_add_8x1w(R->y, t0, t1);     // yR = (X2+Z2)*(X3-Z3)+(X2-Z2)*(X3+Z3)
-  gfp_sqr_8x1w(R->z, R->z);       // zR = [(X2+Z2)*(X3-Z3)-(X2-Z2)*(X3+Z3)]^2
-  gfp_sqr_8x1w(R->y, R->y);       // yR = [(X2+Z2)*(X3-Z3)+(X2-Z2)*(X3+Z3)]^2
-  gfp_mul_8x1w(t0, R->y, t3);     // t0 = 2Z1*[(X2+Z2)*(X3-Z3)+(X2-Z2)*(X3+Z3)]^2
-  gfp_mul_8x1w(t1, R->z, t2);     // t1 = 2X1*[(X2+Z2)*(X3-Z3)-(X2-Z2)*(X3+Z3)]^2
+  gfp_addnr_8x1w(t2, PQ->z, PQ->y); // t2 = 2X1 in [0, 4p)
+  gfp_subnr_8x1w(t3, PQ->z, PQ->y); // t3 = 2Z1 in [0, 4p)
+  gfp_carryp_8x1w(t2);
+  gfp_carryp_8x1w(t3);
+  // yR = (X2+Z2)*(X3-Z3)+(X2-Z2)*(X3+Z3), zR = (X2+Z2)*(X3-Z3)-(X2-Z2)*(X3+Z3)
+  gfp_muladdsub_8x1w(R->y, R->z, P->z, Q->y, P->y, Q->z);
+  // zR = [(X2+Z2)*(X3-Z3)-(X2-Z2)*(X3+Z3)]^2, yR = [(X2+Z2)*(X3-Z3)+(X2-Z2)*(X3+Z3)]^2
+  gfp_sqr2_8x1w(R->z, R->z, R->y, R->y);
+
+  // X5 = 2Z1*yR and Z5 = 2X1*zR of xADD are converted to twsited Edwards 
+  // curve projective y and z coordinates. 
+  gfp_muladdsub_8x1w(R->z, R->y, R->y, t3, R->z, t2); // zR = X5 + Z5, yR = X5 - Z5
+}
 
-  // Now t0 is actually X5 of xADD; t1 is actually Z5 of xADD
-  // We convert them to twsited Edwards curve projective y and z coordinates. 
-  gfp_sub_8x1w(R->y, t0, t1);     // yR = X5 - Z5
-  gfp_add_8x1w(R->z, t0, t1);     // zR = X5 + Z5
+void yDBL_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A)
+{
+  ydbl_8x1w(R, P, A);
+}
+
+void yADD_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t Q, const htpoint_t PQ)
+{
+  yadd_8x1w(R, P, Q, PQ);
 }
 
 // (8x1)-way y-coordinate scalar multiplication R = [k]P on twsited Edwards curve.
@@ -154,18 +185,24 @@ void yADD_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t Q, const htpoint_
 // Please see details about yMUL in [CCC+19, Sect 4.2].
 void yMUL_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A, const uint8_t k)
 {
-  htpoint T[3], Q, TQ;
+  htpoint T[3], TQ;
+  htpoint *T0 = &T[0], *T1 = &T[1], *T2 = &T[2], *Tm, *Tn;
   uint32_t m = addc[k];
   __m512i inf;
   int i, f_inf;
 
-  point_copy_8x1w(&T[0], P);            // T0 = P   
-  yDBL_8x1w(&T[1], P, A);               // T1 = [2]P
-  yADD_8x1w(&T[2], &T[1], &T[0], P);    // T2 = [3]P
+  point_copy_8x1w(T0, P);               // T0 = P   
+  ydbl_8x1w(T1, P, A);                  // T1 = [2]P
+  yadd_8x1w(T2, T1, T0, P);             // T2 = [3]P
 
+  // Instead of copying the three ladder points at the end of every step, we 
+  // rotate the pointers T0, T1, T2 (m and thus the rotation are public) and let
+  // yADD overwrite the point T_{m&1} that is no longer needed.
   for (i = 0; i < addc_len[k]; i++) {
+    Tm = (m&1) ? T1 : T0;               // T_{m&1}
+    Tn = (m&1) ? T0 : T1;               // T_{(m&1)^1}
 
-    inf = point_isinf_8x1w(&T[m&1]);    // constant-time check if T_{m&1} is the point at infinity 
+    inf = point_isinf_8x1w(Tm);         // constant-time check if T_{m&1} is the point at infinity 
     f_inf = VORRDC(inf);                // f_inf == 1 if any one of 8 instances has the point at infinity
     
     // The following if-else branch only depends on the randomness. 
@@ -174,22 +211,22 @@ void yMUL_8x1w(htpoint_t R, const htpoint_t P, const htpoint_t A, const uint8_t
 
     // f_inf == 0 means there is no infinity point in 8 instances,  
     // then we just perform yADD for all instances.
-    if (!f_inf) yADD_8x1w(&Q, &T[2], &T[(m&1)^1], &T[m&1]);
+    if (!f_inf) yadd_8x1w(Tm, T2, Tn, Tm);
     // f_inf != 0 means at least one of eight instances has the point at infinity,
     // then we perform both yDBL and yADD, and later use CMOVE to get the correct values.
     else {
-      yDBL_8x1w(&TQ, &T[2], A);         
-      yADD_8x1w(&Q, &T[2], &T[(m&1)^1], &T[m&1]); 
-      // for the instances having the point at infinity, we move the TQ to Q
-      point_cmove_8x1w(&Q, &TQ, inf);  
+      ydbl_8x1w(&TQ, T2, A);         
+      yadd_8x1w(Tm, T2, Tn, Tm); 
+      // for the instances having the point at infinity, we move the TQ to Q (in T_{m&1})
+      point_cmove_8x1w(Tm, &TQ, inf);  
     }
     
-    point_copy_8x1w(&T[0], &T[(m&1)^1]);
-    point_copy_8x1w(&T[1], &T[2]);
-    point_copy_8x1w(&T[2], &Q);
+    T0 = Tn;                            // T0 = T_{(m&1)^1}
+    T1 = T2;                            // T1 = T2
+    T2 = Tm;                            // T2 = Q 
     m >>= 1;
   } 
-  point_copy_8x1w(R, &T[2]);
+  point_copy_8x1w(R, T2);
 } 
 
 // compare two mpi64 integers 
@@ -203,49 +240,78 @@ static int mpi64_compare(uint64_t *x, const uint64_t *y)
   return 0;
 }
 
-// (8x1)-way elligator.
-// NOTE: A->y = A24plus = a, A->z = C24 = a-d.
-// Please see details about this elligator in [CCC+19, Sect 3].
-void elligator_8x1w(htpoint_t Tplus, htpoint_t Tminus, const htpoint_t A)
+// eight random Elligator inputs u in [0, (p-1)/2] with u^2 and u^2+-1, all in 
+// Montgomery domain
+static void elligator_randu_8x1w(htfe_t vu, htfe_t u2, htfe_t c0, htfe_t tc)
 {
-  htfe_t tc, t0, t1, c0, c1, alpha, vu, vR;;
-  uint64_t u64[8][8], u[8][HT_NWORDS];
-  __m512i m;
+  uint64_t u64[8][8];
+  htfe_t vR;
   int i;
- 
-  gfp_zero_8x1w(Tplus->y);                        // yT+ = 0
-  gfp_zero_8x1w(Tminus->y);                       // yT- = 0
-  gfp_zero_8x1w(alpha);                           // alpha = 0
 
   for (i = 0; i < 8; i++) {
     // generate eight random values u0...u7 
     do {
       mpi64_random(u64[i]);
     } while (mpi64_compare(u64[i], u64_pdiv2) > 0);// repeat if u > (p-1)/2 
-    mpi_conv_64to52(u[i], u64[i], HT_NWORDS, 8);  // convert to radix-52      
   }
+  mpi_load_8x1w(vu, u64);                         // convert to radix-52
 
   for (i = 0; i < HT_NWORDS; i++) { 
-    vu[i] = set_vector(u[7][i], u[6][i], u[5][i], u[4][i], u[3][i], u[2][i], u[1][i], u[0][i]);
     vR[i] = VSET1(ht_montR[i]);
   }
 
+  gfp_num2mont_8x1w(vu, vu);                      // convert u to Montgomery domain 
+  gfp_sqr_8x1w(u2, vu);                           // u2 = u^2
+  gfp_add_8x1w(c0, u2, vR);                       // c0 = u^2+1
+  gfp_sub_8x1w(tc, u2, vR);                       // tc = u^2-1
+}
+
+// (8x1)-way elligator.
+// NOTE: A->y = A24plus = a, A->z = C24 = a-d.
+// Please see details about this elligator in [CCC+19, Sect 3].
+void elligator_8x1w(htpoint_t Tplus, htpoint_t Tminus, const htpoint_t A)
+{
+  htfe_t tc, t0, t1, c0, c1, alpha, vu;
+  __m512i m;
+  int i;
+#ifdef ELLIGATOR_FIXED
+  static __thread int next = 0;       // the next u of the table, ELL_NU: random u
+#endif
+ 
+  gfp_zero_8x1w(Tplus->y);                        // yT+ = 0
+  gfp_zero_8x1w(Tminus->y);                       // yT- = 0
+  gfp_zero_8x1w(alpha);                           // alpha = 0
+
+#ifdef ELLIGATOR_FIXED
+  // take the next public u of the table in all lanes, with u^2 and u^2+-1; 
+  // every (ELL_NU+1)-th call takes a random u in all lanes instead, so that a 
+  // retry loop on a curve for which the eight points of the table all miss the
+  // order it waits for still ends. The choice only depends on the number of 
+  // calls, which is public. 
+  if (next < ELL_NU) {
+    for (i = 0; i < HT_NWORDS; i++) {
+      vu[i] = VSET1(ht_ellu[next][0][i]);
+      Tplus->z[i] = VSET1(ht_ellu[next][1][i]);   // zT+ = u^2
+      c0[i] = VSET1(ht_ellu[next][2][i]);         // c0 = u^2+1
+      tc[i] = VSET1(ht_ellu[next][3][i]);         // tc = u^2-1
+    }
+  }
+  else elligator_randu_8x1w(vu, Tplus->z, c0, tc);
+  next = (next+1) % (ELL_NU+1);
+#else
+  elligator_randu_8x1w(vu, Tplus->z, c0, tc);     // zT+ = u^2, c0 = u^2+1, tc = u^2-1
+#endif
+
   // Here we use Montgomery curve ceoffcients A and C in the comments 
   // for easy understanding.
 
-  gfp_num2mont_8x1w(vu, vu);                      // convert u to Montgomery domain 
-  gfp_sqr_8x1w(Tplus->z, vu);                     // zT+ = u^2
-  gfp_add_8x1w(c0, Tplus->z, vR);                 // c0 = u^2+1
-  gfp_sub_8x1w(tc, Tplus->z, vR);                 // tc = u^2-1
   gfp_mul_8x1w(c1, A->z, tc);                     //!c1 = 4*C*(u^2-1) = C*(u^2-1)
   gfp_sub_8x1w(Tminus->z, A->y, A->z);            // zT- = d = A-2C 
   gfp_add_8x1w(Tminus->z, Tminus->z, A->y);       // zT- = a+d = 2A
   gfp_add_8x1w(Tminus->z, Tminus->z, Tminus->z);  //!zT- = 2*(a+d) = 4A = A
   gfp_mul_8x1w(t0, Tminus->z, c1);                // t0 = A*C*(u^2-1)
   gfp_sqr_8x1w(t1, Tminus->z);                    // t1 = A^2
-  gfp_mul_8x1w(t1, t1, Tplus->z);                 // t1 = (Au)^2
-  gfp_sqr_8x1w(tc, c1);                           // tc = (C*(u^2-1))^2
-  gfp_add_8x1w(t1, t1, tc);                       // t1 = (Au)^2+(C*(u^2-1))^2
+  gfp_muladd_8x1w(t1, t1, Tplus->z, c1, c1);      // t1 = (Au)^2+(C*(u^2-1))^2
   gfp_mul_8x1w(tc, t0, t1);                       // tc = A*C*(u^2-1)*[(Au)^2+(C*(u^2-1))^2]  
   gfp_rdcp_8x1w(tc, tc);                          // reduce tc to [0, p)
   gfp_cmove_8x1w(alpha, vu, gfp_iszero_8x1w(tc)); // alpha = u if A == 0; alpha = 0 otherwise
@@ -268,16 +334,17 @@ void elligator_8x1w(htpoint_t Tplus, htpoint_t Tminus, const htpoint_t A)
   gfp_sub_8x1w(Tminus->y, Tminus->y, c1);         // yT- = -A*u^2-alpha*C*(u^2-1) - C*(u^2-1) 
 }
 
-// (8x1)-way y-coordinate isogeny computation on twisted Edwards curve.
+// (8x1)-way y-coordinate isogeny computation on twisted Edwards curve (Velu).
 // NOTE: A->y = A24plus = a, A->z = C24 = a-d.
-void yISOG_8x1w(htpoint R[], htpoint_t C, const htpoint_t P, const htpoint_t A, const uint8_t k)
+void yISOGvelu_8x1w(htpoint R[], htpoint_t C, const htpoint_t P, const htpoint_t A, const uint8_t k)
 {
   uint8_t mask;
   int lbits = bits_li[k], i, l = primeli[k], s = l>>1; 
   htfe_t t0, t1, td, By0, By1, Bz0, Bz1;
 
   gfp_copy_8x1w(t0, A->y);              // t0 = a
-  gfp_sub_8x1w(td, A->y, A->z);         // td = a - (a-d) = d
+  gfp_subnr_8x1w(td, A->y, A->z);       // td = a - (a-d) = d in [0, 4p)
+  gfp_carryp_8x1w(td);
   gfp_copy_8x1w(t1, td);                // t1 = d
 
   gfp_copy_8x1w(By0, P->y);             // By0 = yP
@@ -287,13 +354,13 @@ void yISOG_8x1w(htpoint R[], htpoint_t C, const htpoint_t P, const htpoint_t A,
   yDBL_8x1w(&R[1], P, A);               // [2]P
 
   for (i = 2; i < s; i++) {
-    gfp_mul_8x1w(By0, By0, R[i-1].y);   // By0 = By0 * yR_{i-1}
-    gfp_mul_8x1w(Bz0, Bz0, R[i-1].z);   // Bz0 = Bz0 * zR_{i-1}
+    // By0 = By0 * yR_{i-1}, Bz0 = Bz0 * zR_{i-1}
+    gfp_mul2_8x1w(By0, By0, R[i-1].y, Bz0, Bz0, R[i-1].z);
     yADD_8x1w(&R[i], &R[i-1], P, &R[i-2]);
   }
 
-  gfp_mul_8x1w(By1, By0, R[s-1].y);     // By1 = By0 * yR_{s-1}
-  gfp_mul_8x1w(Bz1, Bz0, R[s-1].z);     // Bz1 = Bz0 * zR_{s-1}
+  // By1 = By0 * yR_{s-1}, Bz1 = Bz0 * zR_{s-1}
+  gfp_mul2_8x1w(By1, By0, R[s-1].y, Bz1, Bz0, R[s-1].z);
   mask = u32_iseql(l, 3)^1;
   gfp_cswap_8x1w(By0, By1, VSET1(mask));           
   gfp_cswap_8x1w(Bz0, Bz1, VSET1(mask));
@@ -301,54 +368,1074 @@ void yISOG_8x1w(htpoint R[], htpoint_t C, const htpoint_t P, const htpoint_t A,
   // left-to-right computing a^l and d^l
   lbits -= 1;
   for (i = 1; i <= lbits; i++) {
-    gfp_sqr_8x1w(t0, t0);                   
-    gfp_sqr_8x1w(t1, t1);
-    if ((l>>(lbits-i)) & 1) {
-      gfp_mul_8x1w(t0, t0, A->y);
-      gfp_mul_8x1w(t1, t1, td);
-    }
+    gfp_sqr2_8x1w(t0, t0, t1, t1);
+    if ((l>>(lbits-i)) & 1) gfp_mul2_8x1w(t0, t0, A->y, t1, t1, td);
   }
 
-  gfp_sqr_8x1w(By0, By0); gfp_sqr_8x1w(By0, By0); gfp_sqr_8x1w(By0, By0);
-  gfp_sqr_8x1w(Bz0, Bz0); gfp_sqr_8x1w(Bz0, Bz0); gfp_sqr_8x1w(Bz0, Bz0);
+  gfp_sqr2_8x1w(By0, By0, Bz0, Bz0);
+  gfp_sqr2_8x1w(By0, By0, Bz0, Bz0);
+  gfp_sqr2_8x1w(By0, By0, Bz0, Bz0);
   
-  gfp_mul_8x1w(C->y, t0, Bz0);
-  gfp_mul_8x1w(C->z, t1, By0);
+  gfp_mul2_8x1w(C->y, t0, Bz0, C->z, t1, By0);
   gfp_sub_8x1w(C->z, C->y, C->z);       // z coordinate stores a-d
 }
 
-// (8x1)-way y-coordinate isogeny evaluation on twisted Edwards curve.
-void yEVAL_8x1w(htpoint_t R, const htpoint_t Q, const htpoint P[], const uint8_t k)
+// (8x1)-way y-coordinate isogeny evaluation on twisted Edwards curve (Velu).
+void yEVALvelu_8x1w(htpoint_t R, const htpoint_t Q, const htpoint P[], const uint8_t k)
 {
-  htfe_t t0, t1, s0, s1;
+  htfe_t t0, t1;
   htpoint T;
   int i, s;
 
   point_copy_8x1w(&T, Q);      
 
-  gfp_mul_8x1w(s0, T.y, P[0].z);
-  gfp_mul_8x1w(s1, T.z, P[0].y);
-  gfp_add_8x1w(R->y, s0, s1);
-  gfp_sub_8x1w(R->z, s0, s1);
+  gfp_muladdsub_8x1w(R->y, R->z, T.y, P[0].z, T.z, P[0].y);
 
   s = primeli[k]>>1;
   for (i = 1; i < s; i++) {
-    gfp_mul_8x1w(s0, T.y, P[i].z);
-    gfp_mul_8x1w(s1, T.z, P[i].y);
-    gfp_add_8x1w(t0, s0, s1);
-    gfp_sub_8x1w(t1, s0, s1);
-    gfp_mul_8x1w(R->y, R->y, t0);
-    gfp_mul_8x1w(R->z, R->z, t1);
+    gfp_muladdsub_8x1w(t0, t1, T.y, P[i].z, T.z, P[i].y);
+    gfp_mul2_8x1w(R->y, R->y, t0, R->z, R->z, t1);
+  }
+
+  gfp_sqr2_8x1w(R->y, R->y, R->z, R->z);
+  gfp_addnr_8x1w(t0, T.z, T.y);   // t0 in [0, 4p)
+  gfp_subnr_8x1w(t1, T.z, T.y);   // t1 in [0, 4p)
+  gfp_carryp_8x1w(t0);
+  gfp_carryp_8x1w(t1);
+  gfp_muladdsub_8x1w(R->z, R->y, R->y, t0, R->z, t1);
+}
+
+// -----------------------------------------------------------------------------
+// (8x1)-way sqrt-Velu isogeny computation and evaluation [BDLS20]
+//
+// With x_m = x([m]P) on the Montgomery curve, Velu's formulae need the products
+// over the (l-1)/2 kernel multiples of (X_Q*Z_m - Z_Q*X_m) and (X_Q*X_m - Z_Q*Z_m)
+// (see yEVALvelu_8x1w; the codomain takes them at X_Q/Z_Q = 1 and -1). Their
+// odd multiples m = i+j and i-j, i in I = {2b, 6b, ..., 2b(2b'-1)} and j in J =
+// {1, 3, ..., 2b-1}, cover all odd m < 4bb', and for each pair (i, j)
+//   (alpha - x_{i+j}) * (alpha - x_{i-j}) = F(x_i, x_j, alpha) / (x_i - x_j)^2
+// with the biquadratic F of [BDLS20, Lemma 4.3]. So the products over I+-J are
+// prod_{i in I} E_alpha(x_i), E_alpha(w) = prod_{j in J} F(w, x_j, alpha) being a
+// polynomial of degree 2b, up to a factor shared by all alpha. E_{1/alpha} is E_alpha
+// reversed, so X_Q*X_m - Z_Q*Z_m takes the same polynomial at the reversed powers
+// of x_i. The few multiples K = {4bb'+1, ..., l-2} left are those of Velu, and their
+// x-coordinates are the ones of [2]P, [4]P, ..., [l-1-4bb']P. So the cost is about
+// 2b + b' + |K| points instead of (l-1)/2, plus 2b'(2b+1) products per alpha.
+//
+// yISOGsqrt_8x1w leaves in R[] (as an array of field elements W = (htfe_t *)R):
+//   W[4j .. 4j+3]           the coefficients a_j, b_j, -2c_j, -2d_j of F for j in J
+//   W[4b+(2b)i .. +2b-1]    the powers x_i, x_i^2, ..., x_i^{2b} of i in I (affine)
+//   R[(4b+2bb'+1)/2 .. ]    the points [2]P, [4]P, ..., [l-1-4bb']P (for K)
+//   R[s-2], R[s-1]          the points [s-1]P and [s]P, s = (l-1)/2, as yISOGvelu
+// which is the input P[] of yEVALsqrt_8x1w; l >= 17 makes them fit into R[s].
+
+// the sizes b, b' = floor((l-1)/4b) and |K| of the degree l; b = floor(sqrt(l-1)/4)
+// is half of the b of [BDLS20], since with the schoolbook products of E_alpha
+// and the lazy dot products of gfp_dotp_8x1w the smaller b is faster (see
+// timing_sqrtvelu() in main_ht.c)
+static void sqrtvelu_size(int *b, int *bp, int *nk, const int l)
+{
+  for (*b = 1; 16*(*b+1)*(*b+1) <= l-1; *b += 1);
+  *bp = (l-1) / (4 * *b);
+  *nk = (l-1-4 * *b * *bp) >> 1;
+}
+
+// polynomial product e = e * q in place, where e has 2n+1 coefficients (the 
+// lowest first) and q is the quadratic q[0] + q[1]w + q[2]w^2, so that e gets 
+// 2n+3 coefficients; for n = 0, e = q
+static void poly_mulq_8x1w(htfe_t *e, const htfe_t *q, const int n)
+{
+  int i, lo, hi;
+
+  if (n == 0) {
+    for (i = 0; i < 3; i++) gfp_copy_8x1w(e[i], q[i]);
+    return;
+  }
+
+  // e_i = q_lo * e_{i-lo} + ... + q_hi * e_{i-hi} from the top, so that the
+  // e_{i-1} and e_{i-2} it reads are not overwritten yet
+  for (i = 2*n+2; i >= 0; i--) {
+    lo = (i > 2*n) ? i-2*n : 0;
+    hi = (i < 2) ? i : 2;
+    gfp_dotpr_8x1w(e[i], &q[lo], &e[i-hi], hi-lo+1);
+  }
+}
+
+// r = prod_{i in I} e(x_i) of the polynomial e of degree d, or of e reversed 
+// (e_d + e_{d-1}x + ... + e_0x^d) if rev, where xp holds the powers x_i, x_i^2,
+// ..., x_i^d of the bp points x_i
+static void poly_evalprod_8x1w(htfe_t r, const htfe_t *e, const htfe_t *xp, const int d, const int bp, const int rev)
+{
+  htfe_t t;
+  int i;
+
+  for (i = 0; i < bp; i++) {
+    if (rev) {
+      gfp_dotpr_8x1w(t, e, &xp[d*i], d);
+      gfp_add_8x1w(t, t, e[d]);
+    }
+    else {
+      gfp_dotp_8x1w(t, &e[1], &xp[d*i], d);
+      gfp_add_8x1w(t, t, e[0]);
+    }
+    if (i) gfp_mul_8x1w(r, r, t);
+    else gfp_copy_8x1w(r, t);
+  }
+}
+
+// (8x1)-way y-coordinate isogeny computation on twisted Edwards curve (sqrt-Velu).
+// NOTE: A->y = A24plus = a, A->z = C24 = a-d.
+void yISOGsqrt_8x1w(htpoint R[], htpoint_t C, const htpoint_t P, const htpoint_t A, const uint8_t k)
+{
+  htfe_t *W = (htfe_t *)R, *cf, *xp;
+  htpoint M[3], *Pm = &M[0], *Pc = &M[1], *Pn = &M[2], *Pt, *Kp, P2, B4, Jh[2], T0, T1, U;
+  htfe_t q[3], e[SV_DMAX+1];
+  htfe_t t0, t1, td, Ap, By, Bz, X, Z, XX, ZZ, XZ, u, zero;
+  int lbits = bits_li[k], l = primeli[k], s = l>>1, b, bp, nk, d, i, j, h;
+
+  sqrtvelu_size(&b, &bp, &nk, l);
+  d = 2*b;
+  cf = W;
+  xp = &W[4*b];
+  Kp = &R[(4*b+d*bp+1)>>1];
+
+  // the Montgomery coefficient (Ap : C), Ap = 4a-2(a-d) = 2(a+d), C = a-d
+  gfp_add_8x1w(Ap, A->y, A->y);
+  gfp_sub_8x1w(Ap, Ap, A->z);
+  gfp_add_8x1w(Ap, Ap, Ap);
+  gfp_zero_8x1w(zero);
+
+  // J: P, [3]P, ..., [2b-1]P one after the other, and F of each j in J: 
+  // a_j = C*X_j^2, b_j = C*Z_j^2, c_j = C*X_j*Z_j, d_j = a_j+b_j+2Ap*X_j*Z_j,
+  // then F(w, x_j, X_Q/Z_Q) = (a_j*X_Q^2 + b_j*Z_Q^2 - 2c_j*X_Q*Z_Q)
+  //                         - 2(c_j*(X_Q^2 + Z_Q^2) + d_j*X_Q*Z_Q) w
+  //                         + (b_j*X_Q^2 + a_j*Z_Q^2 - 2c_j*X_Q*Z_Q) w^2
+  // up to the factor C*Z_j^2*Z_Q^2; Jh = [b-1]P, [b+1]P for I below
+  yDBL_8x1w(&P2, P, A);                 // [2]P
+  point_copy_8x1w(Pc, P);
+  for (j = 0; j < b; j++) {
+    if (j == 1) {
+      point_copy_8x1w(Pm, P);
+      yADD_8x1w(Pc, &P2, P, P);
+    }
+    else if (j > 1) {
+      yADD_8x1w(Pn, Pc, &P2, Pm);
+      Pt = Pm; Pm = Pc; Pc = Pn; Pn = Pt;
+    }
+    if (j == (b>>1)-1) point_copy_8x1w(&Jh[0], Pc);
+    if (j == (b>>1)) point_copy_8x1w(&Jh[1], Pc);
+
+    gfp_add_8x1w(X, Pc->z, Pc->y);
+    gfp_sub_8x1w(Z, Pc->z, Pc->y);
+    gfp_sqr2_8x1w(XX, X, ZZ, Z);
+    gfp_mul_8x1w(XZ, X, Z);
+    gfp_mul2_8x1w(cf[4*j], A->z, XX, cf[4*j+1], A->z, ZZ);
+    gfp_mul2_8x1w(t0, A->z, XZ, t1, Ap, XZ);
+    gfp_add_8x1w(t0, t0, t0);
+    gfp_sub_8x1w(cf[4*j+2], zero, t0);  // -2c_j
+    gfp_add_8x1w(t1, t1, t1);
+    gfp_add_8x1w(t1, t1, cf[4*j]);
+    gfp_add_8x1w(t1, t1, cf[4*j+1]);
+    gfp_add_8x1w(t1, t1, t1);
+    gfp_sub_8x1w(cf[4*j+3], zero, t1);  // -2d_j
+  }
+
+  // K: [2]P, [4]P, ..., [l-1-4bb']P
+  if (nk > 0) point_copy_8x1w(&Kp[0], &P2);
+  if (nk > 1) yDBL_8x1w(&Kp[1], &P2, A);
+  for (i = 2; i < nk; i++) yADD_8x1w(&Kp[i], &Kp[i-1], &P2, &Kp[i-2]);
+
+  // Montgomery ladder T0 = [s]P, T1 = [s+1]P, then [s-1]P = T0 - P
+  point_copy_8x1w(&T0, P);
+  point_copy_8x1w(&T1, &P2);
+  for (i = bits_li[k]-3; i >= 0; i--) {
+    yADD_8x1w(&U, &T1, &T0, P);
+    if ((s>>i) & 1) {
+      yDBL_8x1w(&T1, &T1, A);
+      point_copy_8x1w(&T0, &U);
+    }
+    else {
+      yDBL_8x1w(&T0, &T0, A);
+      point_copy_8x1w(&T1, &U);
+    }
+  }
+  point_copy_8x1w(&R[s-1], &T0);
+  yADD_8x1w(&R[s-2], &T0, P, &T1);
+
+  // I: [2b]P, [6b]P, ..., [2b(2b'-1)]P one after the other; X_i*Z_0*...*Z_{i-1}
+  // and Z_i, with X_i = z_i+y_i and Z_i = z_i-y_i, wait in the row of x_i in xp
+  if (b & 1) yDBL_8x1w(Pc, &Jh[1], A);                // [2b]P = 2*[b]P
+  else yADD_8x1w(Pc, &Jh[1], &Jh[0], &P2);            // [2b]P = [b+1]P + [b-1]P
+  yDBL_8x1w(&B4, Pc, A);                // [4b]P
+  for (i = 0; i < bp; i++) {
+    if (i == 1) {
+      point_copy_8x1w(Pm, Pc);
+      yADD_8x1w(Pc, &B4, Pm, Pm);       // [6b]P
+    }
+    else if (i > 1) {
+      yADD_8x1w(Pn, Pc, &B4, Pm);
+      Pt = Pm; Pm = Pc; Pc = Pn; Pn = Pt;
+    }
+    gfp_add_8x1w(X, Pc->z, Pc->y);
+    gfp_sub_8x1w(xp[d*i+1], Pc->z, Pc->y);
+    if (i) gfp_mul2_8x1w(xp[d*i], X, t1, t1, t1, xp[d*i+1]);
+    else {
+      gfp_copy_8x1w(xp[0], X);
+      gfp_copy_8x1w(t1, xp[1]);         // t1 = Z_0*...*Z_i
+    }
+  }
+
+  // the affine x_i = X_i/Z_i with one inversion, and their powers
+  gfp_sginv_8x1w(u, t1);                // u = 1/(Z_0*...*Z_{b'-1})
+  for (i = bp-1; i >= 0; i--) {
+    if (i) gfp_mul2_8x1w(xp[d*i], xp[d*i], u, u, u, xp[d*i+1]); // x_i, u = 1/(Z_0*...*Z_{i-1})
+    else gfp_mul_8x1w(xp[0], xp[0], u);
+    for (j = 1; j < d; j++) gfp_mul_8x1w(xp[d*i+j], xp[d*i+j-1], xp[d*i]);
+  }
+
+  // By ~ prod of (X_m - Z_m) = y_m and Bz ~ prod of (X_m + Z_m) = z_m over the
+  // kernel multiples as in yISOGvelu_8x1w, from E_alpha of X_Q/Z_Q = 1 and -1
+  for (h = 0; h < 2; h++) {
+    for (j = 0; j < b; j++) {
+      gfp_add_8x1w(t0, cf[4*j], cf[4*j+1]);
+      gfp_add_8x1w(t1, cf[4*j+2], cf[4*j+2]);
+      if (h) {
+        gfp_sub_8x1w(q[0], t0, cf[4*j+2]);
+        gfp_sub_8x1w(q[1], t1, cf[4*j+3]);
+      }
+      else {
+        gfp_add_8x1w(q[0], t0, cf[4*j+2]);
+        gfp_add_8x1w(q[1], t1, cf[4*j+3]);
+      }
+      gfp_copy_8x1w(q[2], q[0]);
+      poly_mulq_8x1w(e, q, j);
+    }
+    poly_evalprod_8x1w(h ? Bz : By, e, xp, d, bp, 0);
+  }
+  for (i = 0; i < nk; i++) gfp_mul2_8x1w(By, By, Kp[i].y, Bz, Bz, Kp[i].z);
+
+  // left-to-right computing a^l and d^l
+  gfp_copy_8x1w(t0, A->y);              // t0 = a
+  gfp_subnr_8x1w(td, A->y, A->z);       // td = a - (a-d) = d in [0, 4p)
+  gfp_carryp_8x1w(td);
+  gfp_copy_8x1w(t1, td);                // t1 = d
+  lbits -= 1;
+  for (i = 1; i <= lbits; i++) {
+    gfp_sqr2_8x1w(t0, t0, t1, t1);
+    if ((l>>(lbits-i)) & 1) gfp_mul2_8x1w(t0, t0, A->y, t1, t1, td);
+  }
+
+  gfp_sqr2_8x1w(By, By, Bz, Bz);
+  gfp_sqr2_8x1w(By, By, Bz, Bz);
+  gfp_sqr2_8x1w(By, By, Bz, Bz);
+
+  gfp_mul2_8x1w(C->y, t0, Bz, C->z, t1, By);
+  gfp_sub_8x1w(C->z, C->y, C->z);       // z coordinate stores a-d
+}
+
+// (8x1)-way y-coordinate isogeny evaluation on twisted Edwards curve (sqrt-Velu),
+// P[] is the output R[] of yISOGsqrt_8x1w.
+void yEVALsqrt_8x1w(htpoint_t R, const htpoint_t Q, const htpoint P[], const uint8_t k)
+{
+  const htfe_t *W = (const htfe_t *)P, *cf, *xp;
+  const htpoint *Kp;
+  htfe_t q[3], e[SV_DMAX+1];
+  htfe_t t0, t1, X, Z, XX, ZZ, XZ, SS, u;
+  htpoint T;
+  int b, bp, nk, d, i, j;
+
+  sqrtvelu_size(&b, &bp, &nk, primeli[k]);
+  d = 2*b;
+  cf = W;
+  xp = &W[4*b];
+  Kp = &P[(4*b+d*bp+1)>>1];
+
+  point_copy_8x1w(&T, Q);
+
+  gfp_add_8x1w(X, T.z, T.y);            // X_Q = z_Q+y_Q
+  gfp_sub_8x1w(Z, T.z, T.y);            // Z_Q = z_Q-y_Q
+  gfp_sqr2_8x1w(XX, X, ZZ, Z);
+  gfp_mul_8x1w(XZ, X, Z);
+  gfp_add_8x1w(SS, XX, ZZ);
+
+  // E, the product of F(w, x_j, X_Q/Z_Q) of j in J, see yISOGsqrt_8x1w
+  for (j = 0; j < b; j++) {
+    gfp_mul_8x1w(u, cf[4*j+2], XZ);
+    gfp_muladd_8x1w(q[0], cf[4*j], XX, cf[4*j+1], ZZ);
+    gfp_add_8x1w(q[0], q[0], u);
+    gfp_muladd_8x1w(q[1], cf[4*j+2], SS, cf[4*j+3], XZ);
+    gfp_muladd_8x1w(q[2], cf[4*j+1], XX, cf[4*j], ZZ);
+    gfp_add_8x1w(q[2], q[2], u);
+    poly_mulq_8x1w(e, q, j);
+  }
+
+  // R->z ~ prod of (X_Q*Z_m - Z_Q*X_m) from E, R->y ~ prod of (X_Q*X_m - Z_Q*Z_m)
+  // from E reversed, over I+-J
+  poly_evalprod_8x1w(R->z, e, xp, d, bp, 0);
+  poly_evalprod_8x1w(R->y, e, xp, d, bp, 1);
+
+  // and over K as yEVALvelu_8x1w
+  for (i = 0; i < nk; i++) {
+    gfp_muladdsub_8x1w(t0, t1, T.y, Kp[i].z, T.z, Kp[i].y);
+    gfp_mul2_8x1w(R->y, R->y, t0, R->z, R->z, t1);
+  }
+
+  gfp_sqr2_8x1w(R->y, R->y, R->z, R->z);
+  gfp_addnr_8x1w(t0, T.z, T.y);   // t0 in [0, 4p)
+  gfp_subnr_8x1w(t1, T.z, T.y);   // t1 in [0, 4p)
+  gfp_carryp_8x1w(t0);
+  gfp_carryp_8x1w(t1);
+  gfp_muladdsub_8x1w(R->z, R->y, R->y, t0, R->z, t1);
+}
+
+// (8x1)-way y-coordinate isogeny computation on twisted Edwards curve,
+// sqrt-Velu for l >= SV_LMIN and Velu otherwise.
+void yISOG_8x1w(htpoint R[], htpoint_t C, const htpoint_t P, const htpoint_t A, const uint8_t k)
+{
+  if (primeli[k] >= SV_LMIN) yISOGsqrt_8x1w(R, C, P, A, k);
+  else yISOGvelu_8x1w(R, C, P, A, k);
+}
+
+// (8x1)-way y-coordinate isogeny evaluation on twisted Edwards curve, P[] is
+// the output R[] of yISOG_8x1w.
+void yEVAL_8x1w(htpoint_t R, const htpoint_t Q, const htpoint P[], const uint8_t k)
+{
+  if (primeli[k] >= SV_LMIN) yEVALsqrt_8x1w(R, Q, P, k);
+  else yEVALvelu_8x1w(R, Q, P, k);
+}
+
+// -----------------------------------------------------------------------------
+// (8x1)-way multi-point isogeny evaluation
+//
+// yEVALmulti_8x1w pushes n <= EVAL_NQMAX points through the isogeny of P[] (the
+// output R[] of yISOG_8x1w) in one pass over P[], instead of one pass per point 
+// as yEVAL_8x1w: each kernel multiple is loaded once for all points, and the 
+// products of the points are independent chains. *R[i] is the image of *Q[i], 
+// R[] may overlap Q[].
+
+// (8x1)-way multi-point y-coordinate isogeny evaluation on twisted Edwards curve
+// (Velu).
+void yEVALmultivelu_8x1w(htpoint *R[], htpoint *const Q[], const htpoint P[], const int n, const uint8_t k)
+{
+  htfe_t t0, t1, Ry[EVAL_NQMAX], Rz[EVAL_NQMAX];
+  htpoint T[EVAL_NQMAX];
+  int i, h, s = primeli[k]>>1;
+
+  for (h = 0; h < n; h++) {
+    point_copy_8x1w(&T[h], Q[h]);
+    gfp_muladdsub_8x1w(Ry[h], Rz[h], T[h].y, P[0].z, T[h].z, P[0].y);
+  }
+
+  for (i = 1; i < s; i++) {
+    for (h = 0; h < n; h++) {
+      gfp_muladdsub_8x1w(t0, t1, T[h].y, P[i].z, T[h].z, P[i].y);
+      gfp_mul2_8x1w(Ry[h], Ry[h], t0, Rz[h], Rz[h], t1);
+    }
+  }
+
+  for (h = 0; h < n; h++) {
+    gfp_sqr2_8x1w(Ry[h], Ry[h], Rz[h], Rz[h]);
+    gfp_addnr_8x1w(t0, T[h].z, T[h].y); // t0 in [0, 4p)
+    gfp_subnr_8x1w(t1, T[h].z, T[h].y); // t1 in [0, 4p)
+    gfp_carryp_8x1w(t0);
+    gfp_carryp_8x1w(t1);
+    gfp_muladdsub_8x1w(R[h]->z, R[h]->y, Ry[h], t0, Rz[h], t1);
+  }
+}
+
+// (8x1)-way multi-point y-coordinate isogeny evaluation on twisted Edwards curve 
+// (sqrt-Velu), P[] is the output R[] of yISOGsqrt_8x1w: the polynomials E of the
+// points are built one after the other, then they share the powers of each x_i 
+// of I and the multiples of K. 
+void yEVALmultisqrt_8x1w(htpoint *R[], htpoint *const Q[], const htpoint P[], const int n, const uint8_t k)
+{
+  const htfe_t *W = (const htfe_t *)P, *cf, *xp;
+  const htpoint *Kp;
+  htfe_t q[3], e[EVAL_NQMAX][SV_DMAX+1];
+  htfe_t t0, t1, X, Z, XX, ZZ, XZ, SS, u, Ry[EVAL_NQMAX], Rz[EVAL_NQMAX];
+  htpoint T[EVAL_NQMAX];
+  int b, bp, nk, d, i, j, h;
+
+  sqrtvelu_size(&b, &bp, &nk, primeli[k]);
+  d = 2*b;
+  cf = W;
+  xp = &W[4*b];
+  Kp = &P[(4*b+d*bp+1)>>1];
+
+  for (h = 0; h < n; h++) {
+    point_copy_8x1w(&T[h], Q[h]);
+
+    gfp_add_8x1w(X, T[h].z, T[h].y);    // X_Q = z_Q+y_Q
+    gfp_sub_8x1w(Z, T[h].z, T[h].y);    // Z_Q = z_Q-y_Q
+    gfp_sqr2_8x1w(XX, X, ZZ, Z);
+    gfp_mul_8x1w(XZ, X, Z);
+    gfp_add_8x1w(SS, XX, ZZ);
+
+    // E, the product of F(w, x_j, X_Q/Z_Q) of j in J, see yISOGsqrt_8x1w
+    for (j = 0; j < b; j++) {
+      gfp_mul_8x1w(u, cf[4*j+2], XZ);
+      gfp_muladd_8x1w(q[0], cf[4*j], XX, cf[4*j+1], ZZ);
+      gfp_add_8x1w(q[0], q[0], u);
+      gfp_muladd_8x1w(q[1], cf[4*j+2], SS, cf[4*j+3], XZ);
+      gfp_muladd_8x1w(q[2], cf[4*j+1], XX, cf[4*j], ZZ);
+      gfp_add_8x1w(q[2], q[2], u);
+      poly_mulq_8x1w(e[h], q, j);
+    }
+  }
+
+  // Rz ~ prod of (X_Q*Z_m - Z_Q*X_m) from E, Ry ~ prod of (X_Q*X_m - Z_Q*Z_m) 
+  // from E reversed, over I+-J as poly_evalprod_8x1w
+  for (i = 0; i < bp; i++) {
+    for (h = 0; h < n; h++) {
+      gfp_dotp_8x1w(t0, &e[h][1], &xp[d*i], d);
+      gfp_dotpr_8x1w(t1, e[h], &xp[d*i], d);
+      gfp_add_8x1w(t0, t0, e[h][0]);
+      gfp_add_8x1w(t1, t1, e[h][d]);
+      if (i) gfp_mul2_8x1w(Rz[h], Rz[h], t0, Ry[h], Ry[h], t1);
+      else {
+        gfp_copy_8x1w(Rz[h], t0);
+        gfp_copy_8x1w(Ry[h], t1);
+      }
+    }
+  }
+
+  // and over K as yEVALmultivelu_8x1w
+  for (i = 0; i < nk; i++) {
+    for (h = 0; h < n; h++) {
+      gfp_muladdsub_8x1w(t0, t1, T[h].y, Kp[i].z, T[h].z, Kp[i].y);
+      gfp_mul2_8x1w(Ry[h], Ry[h], t0, Rz[h], Rz[h], t1);
+    }
+  }
+
+  for (h = 0; h < n; h++) {
+    gfp_sqr2_8x1w(Ry[h], Ry[h], Rz[h], Rz[h]);
+    gfp_addnr_8x1w(t0, T[h].z, T[h].y); // t0 in [0, 4p)
+    gfp_subnr_8x1w(t1, T[h].z, T[h].y); // t1 in [0, 4p)
+    gfp_carryp_8x1w(t0);
+    gfp_carryp_8x1w(t1);
+    gfp_muladdsub_8x1w(R[h]->z, R[h]->y, Ry[h], t0, Rz[h], t1);
+  }
+}
+
+// (8x1)-way multi-point y-coordinate isogeny evaluation on twisted Edwards curve,
+// P[] is the output R[] of yISOG_8x1w.
+void yEVALmulti_8x1w(htpoint *R[], htpoint *const Q[], const htpoint P[], const int n, const uint8_t k)
+{
+  if (primeli[k] >= SV_LMIN) yEVALmultisqrt_8x1w(R, Q, P, n, k);
+  else yEVALmultivelu_8x1w(R, Q, P, n, k);
+}
+
+// -----------------------------------------------------------------------------
+// (8x1)-way fused isogeny computation and evaluation
+//
+// yISOGEVAL_8x1w computes C = A/<P> and pushes n <= ISOG_NQMAX points through the
+// isogeny in one pass, in which each kernel multiple is generated, multiplied 
+// into the products of the codomain and of all points, and dropped at once; so 
+// only a few points are live, instead of the array R[] of yISOG_8x1w that 
+// yEVAL_8x1w streams through once for every point. *R[i] is the image of *Q[i], 
+// and L = [l]P unless L is NULL, which the extra-dummy method needs for a dummy 
+// isogeny. R[i] may be Q[i], L may be one of Q[], and C may be A.
+
+// (8x1)-way fused y-coordinate isogeny computation and evaluation on twisted 
+// Edwards curve (Velu).
+// NOTE: A->y = A24plus = a, A->z = C24 = a-d.
+void yISOGEVALvelu_8x1w(htpoint_t C, htpoint *R[], htpoint_t L, const htpoint_t P, const htpoint_t A, htpoint *const Q[], const int n, const uint8_t k)
+{
+  int lbits = bits_li[k], i, j, l = primeli[k], s = l>>1;
+  htfe_t t0, t1, td, By, Bz, Ry[ISOG_NQMAX], Rz[ISOG_NQMAX];
+  htpoint T[ISOG_NQMAX], M[3], *Pm = &M[0], *Pc = &M[1], *Pn = &M[2], *Pt;
+
+  for (j = 0; j < n; j++) point_copy_8x1w(&T[j], Q[j]);
+
+  // the kernel multiple P
+  gfp_copy_8x1w(By, P->y);              // By = yP
+  gfp_copy_8x1w(Bz, P->z);              // Bz = zP
+  for (j = 0; j < n; j++) 
+    gfp_muladdsub_8x1w(Ry[j], Rz[j], T[j].y, P->z, T[j].z, P->y);
+
+  point_copy_8x1w(Pm, P);               // P
+  yDBL_8x1w(Pc, P, A);                  // [2]P
+
+  // the kernel multiples Pc = [i]P, with Pm = [i-1]P
+  for (i = 2; i <= s; i++) {
+    gfp_mul2_8x1w(By, By, Pc->y, Bz, Bz, Pc->z);
+    for (j = 0; j < n; j++) {
+      gfp_muladdsub_8x1w(t0, t1, T[j].y, Pc->z, T[j].z, Pc->y);
+      gfp_mul2_8x1w(Ry[j], Ry[j], t0, Rz[j], Rz[j], t1);
+    }
+
+    if (i == s && L == NULL) break;
+    yADD_8x1w(Pn, Pc, P, Pm);           // [i+1]P
+    Pt = Pm; Pm = Pc; Pc = Pn; Pn = Pt;
+  }
+
+  // [l]P = [s+1]P + [s]P
+  if (L != NULL) yADD_8x1w(L, Pc, Pm, P);
+
+  for (j = 0; j < n; j++) {
+    gfp_sqr2_8x1w(Ry[j], Ry[j], Rz[j], Rz[j]);
+    gfp_addnr_8x1w(t0, T[j].z, T[j].y); // t0 in [0, 4p)
+    gfp_subnr_8x1w(t1, T[j].z, T[j].y); // t1 in [0, 4p)
+    gfp_carryp_8x1w(t0);
+    gfp_carryp_8x1w(t1);
+    gfp_muladdsub_8x1w(R[j]->z, R[j]->y, Ry[j], t0, Rz[j], t1);
+  }
+
+  // left-to-right computing a^l and d^l
+  gfp_copy_8x1w(t0, A->y);              // t0 = a
+  gfp_subnr_8x1w(td, A->y, A->z);       // td = a - (a-d) = d in [0, 4p)
+  gfp_carryp_8x1w(td);
+  gfp_copy_8x1w(t1, td);                // t1 = d
+  lbits -= 1;
+  for (i = 1; i <= lbits; i++) {
+    gfp_sqr2_8x1w(t0, t0, t1, t1);
+    if ((l>>(lbits-i)) & 1) gfp_mul2_8x1w(t0, t0, A->y, t1, t1, td);
   }
 
-  gfp_sqr_8x1w(R->y, R->y);
-  gfp_sqr_8x1w(R->z, R->z);
-  gfp_add_8x1w(t0, T.z, T.y);
-  gfp_sub_8x1w(t1, T.z, T.y);
-  gfp_mul_8x1w(t0, R->y, t0);
-  gfp_mul_8x1w(t1, R->z, t1);
-  gfp_sub_8x1w(R->y, t0 ,t1);
-  gfp_add_8x1w(R->z, t0, t1);
+  gfp_sqr2_8x1w(By, By, Bz, Bz);
+  gfp_sqr2_8x1w(By, By, Bz, Bz);
+  gfp_sqr2_8x1w(By, By, Bz, Bz);
+
+  gfp_mul2_8x1w(C->y, t0, Bz, C->z, t1, By);
+  gfp_sub_8x1w(C->z, C->y, C->z);       // z coordinate stores a-d
+}
+
+// (8x1)-way fused y-coordinate isogeny computation and evaluation on twisted
+// Edwards curve (sqrt-Velu), see yISOGsqrt_8x1w. J, I and K are generated on the
+// fly and each j in J is multiplied into the polynomials at once, so only they
+// are kept. The polynomials are evaluated at x_i = X_i/Z_i of I in homogeneous 
+// form, sum e_j X_i^j Z_i^{d-j}: its factor Z_i^d is the same in the numerator 
+// and the denominator of the codomain and of each image, so no inversion. 
+// NOTE: A->y = A24plus = a, A->z = C24 = a-d.
+void yISOGEVALsqrt_8x1w(htpoint_t C, htpoint *R[], htpoint_t L, const htpoint_t P, const htpoint_t A, htpoint *const Q[], const int n, const uint8_t k)
+{
+  htpoint T[ISOG_NQMAX], M[3], *Pm = &M[0], *Pc = &M[1], *Pn = &M[2], *Pt;
+  htpoint P2, B4, Jh[2], U, V;
+  htfe_t e[ISOG_NQMAX+2][SV_DMAX+1], mo[SV_DMAX+1], acc[ISOG_NQMAX+2][2];
+  htfe_t cf[4], q[3], XX[ISOG_NQMAX], ZZ[ISOG_NQMAX], XZ[ISOG_NQMAX], SS[ISOG_NQMAX];
+  htfe_t t0, t1, td, Ap, X, Z, u, zero;
+  int lbits = bits_li[k], l = primeli[k], s = l>>1, b, bp, nk, d, i, j, h;
+
+  sqrtvelu_size(&b, &bp, &nk, l);
+  d = 2*b;
+
+  for (h = 0; h < n; h++) {
+    point_copy_8x1w(&T[h], Q[h]);
+    gfp_add_8x1w(X, T[h].z, T[h].y);    // X_Q = z_Q+y_Q
+    gfp_sub_8x1w(Z, T[h].z, T[h].y);    // Z_Q = z_Q-y_Q
+    gfp_sqr2_8x1w(XX[h], X, ZZ[h], Z);
+    gfp_mul_8x1w(XZ[h], X, Z);
+    gfp_add_8x1w(SS[h], XX[h], ZZ[h]);
+  }
+
+  // the Montgomery coefficient (Ap : C), Ap = 4a-2(a-d) = 2(a+d), C = a-d
+  gfp_add_8x1w(Ap, A->y, A->y);
+  gfp_sub_8x1w(Ap, Ap, A->z);
+  gfp_add_8x1w(Ap, Ap, Ap);
+  gfp_zero_8x1w(zero);
+
+  // J: P, [3]P, ..., [2b-1]P and the coefficients of F of each, as yISOGsqrt_8x1w,
+  // then E_alpha of the codomain (X_Q/Z_Q = 1 and -1) in e[0], e[1] and of the
+  // points in e[2+h]; Jh = [b-1]P, [b+1]P for I below
+  yDBL_8x1w(&P2, P, A);                 // [2]P
+  point_copy_8x1w(Pc, P);
+  for (j = 0; j < b; j++) {
+    if (j == 1) {
+      point_copy_8x1w(Pm, P);
+      yADD_8x1w(Pc, &P2, P, P);
+    }
+    else if (j > 1) {
+      yADD_8x1w(Pn, Pc, &P2, Pm);
+      Pt = Pm; Pm = Pc; Pc = Pn; Pn = Pt;
+    }
+    if (j == (b>>1)-1) point_copy_8x1w(&Jh[0], Pc);
+    if (j == (b>>1)) point_copy_8x1w(&Jh[1], Pc);
+
+    gfp_add_8x1w(X, Pc->z, Pc->y);
+    gfp_sub_8x1w(Z, Pc->z, Pc->y);
+    gfp_sqr2_8x1w(t0, X, t1, Z);
+    gfp_mul_8x1w(u, X, Z);
+    gfp_mul2_8x1w(cf[0], A->z, t0, cf[1], A->z, t1);
+    gfp_mul2_8x1w(t0, A->z, u, t1, Ap, u);
+    gfp_add_8x1w(t0, t0, t0);
+    gfp_sub_8x1w(cf[2], zero, t0);      // -2c_j
+    gfp_add_8x1w(t1, t1, t1);
+    gfp_add_8x1w(t1, t1, cf[0]);
+    gfp_add_8x1w(t1, t1, cf[1]);
+    gfp_add_8x1w(t1, t1, t1);
+    gfp_sub_8x1w(cf[3], zero, t1);      // -2d_j
+
+    gfp_add_8x1w(t0, cf[0], cf[1]);
+    gfp_add_8x1w(t1, cf[2], cf[2]);
+    gfp_add_8x1w(q[0], t0, cf[2]);
+    gfp_add_8x1w(q[1], t1, cf[3]);
+    gfp_copy_8x1w(q[2], q[0]);
+    poly_mulq_8x1w(e[0], q, j);
+    gfp_sub_8x1w(q[0], t0, cf[2]);
+    gfp_sub_8x1w(q[1], t1, cf[3]);
+    gfp_copy_8x1w(q[2], q[0]);
+    poly_mulq_8x1w(e[1], q, j);
+
+    for (h = 0; h < n; h++) {
+      gfp_mul_8x1w(u, cf[2], XZ[h]);
+      gfp_muladd_8x1w(q[0], cf[0], XX[h], cf[1], ZZ[h]);
+      gfp_add_8x1w(q[0], q[0], u);
+      gfp_muladd_8x1w(q[1], cf[2], SS[h], cf[3], XZ[h]);
+      gfp_muladd_8x1w(q[2], cf[1], XX[h], cf[0], ZZ[h]);
+      gfp_add_8x1w(q[2], q[2], u);
+      poly_mulq_8x1w(e[2+h], q, j);
+    }
+  }
+
+  // I: [2b]P, [6b]P, ..., [2b(2b'-1)]P one after the other, and the products of
+  // the polynomials at x_i with mo[j] = X_i^j Z_i^{d-j}, from E reversed for 
+  // the second product of a point
+  if (b & 1) yDBL_8x1w(Pc, &Jh[1], A);                // [2b]P = 2*[b]P
+  else yADD_8x1w(Pc, &Jh[1], &Jh[0], &P2);            // [2b]P = [b+1]P + [b-1]P
+  yDBL_8x1w(&B4, Pc, A);                // [4b]P
+  for (i = 0; i < bp; i++) {
+    if (i == 1) {
+      point_copy_8x1w(Pm, Pc);
+      yADD_8x1w(Pc, &B4, Pm, Pm);       // [6b]P
+    }
+    else if (i > 1) {
+      yADD_8x1w(Pn, Pc, &B4, Pm);
+      Pt = Pm; Pm = Pc; Pc = Pn; Pn = Pt;
+    }
+
+    gfp_add_8x1w(mo[1], Pc->z, Pc->y);  // X_i
+    gfp_sub_8x1w(Z, Pc->z, Pc->y);      // Z_i
+    for (j = 2; j <= d; j++) gfp_mul_8x1w(mo[j], mo[j-1], mo[1]);
+    gfp_copy_8x1w(u, Z);
+    for (j = d-1; j > 0; j--) gfp_mul2_8x1w(mo[j], mo[j], u, u, u, Z); // u = Z_i^{d-j}
+    gfp_copy_8x1w(mo[0], u);
+
+    for (h = 0; h < n+2; h++) {
+      gfp_dotp_8x1w(t0, e[h], mo, d+1);
+      if (i) gfp_mul_8x1w(acc[h][0], acc[h][0], t0);
+      else gfp_copy_8x1w(acc[h][0], t0);
+      if (h < 2) continue;
+      gfp_dotpr_8x1w(t0, e[h], mo, d+1);
+      if (i) gfp_mul_8x1w(acc[h][1], acc[h][1], t0);
+      else gfp_copy_8x1w(acc[h][1], t0);
+    }
+  }
+
+  // K: [2]P, [4]P, ..., [l-1-4bb']P as Velu
+  for (i = 0; i < nk; i++) {
+    if (i == 0) point_copy_8x1w(Pc, &P2);
+    else if (i == 1) {
+      point_copy_8x1w(Pm, Pc);
+      yDBL_8x1w(Pc, &P2, A);
+    }
+    else {
+      yADD_8x1w(Pn, Pc, &P2, Pm);
+      Pt = Pm; Pm = Pc; Pc = Pn; Pn = Pt;
+    }
+
+    gfp_mul2_8x1w(acc[0][0], acc[0][0], Pc->y, acc[1][0], acc[1][0], Pc->z);
+    for (h = 0; h < n; h++) {
+      gfp_muladdsub_8x1w(t0, t1, T[h].y, Pc->z, T[h].z, Pc->y);
+      gfp_mul2_8x1w(acc[2+h][1], acc[2+h][1], t0, acc[2+h][0], acc[2+h][0], t1);
+    }
+  }
+
+  // Montgomery ladder U = [s]P, V = [s+1]P, then [l]P = V + U
+  if (L != NULL) {
+    point_copy_8x1w(&U, P);
+    point_copy_8x1w(&V, &P2);
+    for (i = lbits-3; i >= 0; i--) {
+      yADD_8x1w(Pc, &V, &U, P);
+      if ((s>>i) & 1) {
+        yDBL_8x1w(&V, &V, A);
+        point_copy_8x1w(&U, Pc);
+      }
+      else {
+        yDBL_8x1w(&U, &U, A);
+        point_copy_8x1w(&V, Pc);
+      }
+    }
+    yADD_8x1w(L, &V, &U, P);
+  }
+
+  // R->z ~ prod of (X_Q*Z_m - Z_Q*X_m) from E, R->y ~ prod of (X_Q*X_m - Z_Q*Z_m)
+  // from E reversed, as yEVALsqrt_8x1w
+  for (h = 0; h < n; h++) {
+    gfp_sqr2_8x1w(acc[2+h][1], acc[2+h][1], acc[2+h][0], acc[2+h][0]);
+    gfp_addnr_8x1w(t0, T[h].z, T[h].y); // t0 in [0, 4p)
+    gfp_subnr_8x1w(t1, T[h].z, T[h].y); // t1 in [0, 4p)
+    gfp_carryp_8x1w(t0);
+    gfp_carryp_8x1w(t1);
+    gfp_muladdsub_8x1w(R[h]->z, R[h]->y, acc[2+h][1], t0, acc[2+h][0], t1);
+  }
+
+  // left-to-right computing a^l and d^l
+  gfp_copy_8x1w(t0, A->y);              // t0 = a
+  gfp_subnr_8x1w(td, A->y, A->z);       // td = a - (a-d) = d in [0, 4p)
+  gfp_carryp_8x1w(td);
+  gfp_copy_8x1w(t1, td);                // t1 = d
+  lbits -= 1;
+  for (i = 1; i <= lbits; i++) {
+    gfp_sqr2_8x1w(t0, t0, t1, t1);
+    if ((l>>(lbits-i)) & 1) gfp_mul2_8x1w(t0, t0, A->y, t1, t1, td);
+  }
+
+  gfp_sqr2_8x1w(acc[0][0], acc[0][0], acc[1][0], acc[1][0]);
+  gfp_sqr2_8x1w(acc[0][0], acc[0][0], acc[1][0], acc[1][0]);
+  gfp_sqr2_8x1w(acc[0][0], acc[0][0], acc[1][0], acc[1][0]);
+
+  gfp_mul2_8x1w(C->y, t0, acc[1][0], C->z, t1, acc[0][0]);
+  gfp_sub_8x1w(C->z, C->y, C->z);       // z coordinate stores a-d
+}
+
+// (8x1)-way fused y-coordinate isogeny computation and evaluation on twisted
+// Edwards curve, sqrt-Velu for l >= SV_LMIN and Velu otherwise.
+void yISOGEVAL_8x1w(htpoint_t C, htpoint *R[], htpoint_t L, const htpoint_t P, const htpoint_t A, htpoint *const Q[], const int n, const uint8_t k)
+{
+  if (primeli[k] >= SV_LMIN) yISOGEVALsqrt_8x1w(C, R, L, P, A, Q, n, k);
+  else yISOGEVALvelu_8x1w(C, R, L, P, A, Q, n, k);
+}
+
+// -----------------------------------------------------------------------------
+// (8x1)-way radical isogenies of degree l = 3, 5, 7 [CDV20]
+//
+// With a point P of order l, the curve is brought into a model where P is (0, 0): 
+// y^2 + a1*xy + a3*y = x^3 for l = 3, and the Tate normal form E(b, c), i.e.,
+// y^2 + (1-c)*xy - b*y = x^3 - b*x^2, with b = c for l = 5 and b = r^3-r^2, 
+// c = r^2-r for l = 7. The model of the next l-isogenous curve of the chain (not
+// going back) is given by an l-th root alpha of a function of the current one:
+//   l = 3: alpha^3 = -a3,        a1' = a1-6*alpha, a3' = 3*a1*alpha^2-a1^2*alpha+9*a3
+//   l = 5: alpha^5 = b,          b' = alpha*(alpha^4+3*alpha^3+4*alpha^2+2*alpha+1)
+//                                   / (alpha^4-2*alpha^3+4*alpha^2-3*alpha+1)
+//   l = 7: alpha^7 = r*(r-1)^2,  r' = N(alpha, r) / D(alpha, r) given by rad7_coef
+// where the root is a^(1/l mod (p-1)) as l does not divide p-1. The models are
+// projective (a1 : a3 of weights 1 : 3, b = bn/bd and r = rn/rd), so a step costs 
+// one exponentiation and no inversion. At the end, the Montgomery coefficient is
+// recovered from the Weierstrass model with Cardano's formula for its 2-torsion 
+// point (the only rational one of a CSIDH curve) and a square root, i.e., three
+// more exponentiations. Unlike Velu's formulae, the steps need no other point of
+// order l than P, so one point is enough for the whole chain.
+
+// r = c * a for a small public integer c
+// a in [0, 2p) -> r in [0, 2p)
+static void gfp_mulsi_8x1w(htfe_t r, const htfe_t a, const int c)
+{
+  htfe_t t;
+  int i, n = (c < 0) ? -c : c;
+
+  gfp_zero_8x1w(t);
+  for (i = 31-__builtin_clz(n|1); i >= 0; i--) {
+    gfp_add_8x1w(t, t, t);
+    if ((n>>i) & 1) gfp_add_8x1w(t, t, a);
+  }
+  if (c < 0) {
+    gfp_zero_8x1w(r);
+    gfp_sub_8x1w(r, r, t);
+  }
+  else gfp_copy_8x1w(r, t);
+}
+
+// the curve C = (A24plus : C24) of the Weierstrass model y^2 + a1*xy + a3*y = 
+// x^3 + a2*x^2, i.e., of 16y^2 = f(x) = x^3 + b2*x^2 + 8*b4*x + 16*b6 (x scaled 
+// by 4): with the root x0 = n/dd of f and the square root w of f'(x0) which is a
+// square itself, the Montgomery coefficient is A = (3*x0+b2)/w.
+static void radical_mont_8x1w(htpoint_t C, const htfe_t a1, const htfe_t a2, const htfe_t a3)
+{
+  htfe_t b2, b4, b6, pp, qp, u, n, dd, t0, t1;
+
+  gfp_sqr_8x1w(t0, a1);
+  gfp_mulsi_8x1w(t1, a2, 4);
+  gfp_add_8x1w(b2, t0, t1);             // b2 = a1^2+4*a2
+  gfp_mul_8x1w(b4, a1, a3);             // b4 = a1*a3
+  gfp_sqr_8x1w(b6, a3);                 // b6 = a3^2
+
+  // f(t-b2/3) = t^3 + pp/3*t + qp/27
+  gfp_sqr_8x1w(t0, b2);
+  gfp_mulsi_8x1w(t1, b4, 24);
+  gfp_sub_8x1w(pp, t1, t0);             // pp = 24*b4-b2^2
+  gfp_add_8x1w(t0, t0, t0);
+  gfp_mulsi_8x1w(t1, b4, 72);
+  gfp_sub_8x1w(t0, t0, t1);
+  gfp_mul_8x1w(t0, t0, b2);
+  gfp_mulsi_8x1w(t1, b6, 432);
+  gfp_add_8x1w(qp, t0, t1);             // qp = 2*b2^3-72*b2*b4+432*b6
+
+  // Cardano's formula: u = (4*(sqrt(qp^2+4*pp^3)-qp))^(1/3), x0 = (u^2-4*pp-2*b2*u)/6u
+  gfp_sqr_8x1w(t0, pp);
+  gfp_mul_8x1w(t0, t0, pp);
+  gfp_mulsi_8x1w(t0, t0, 4);
+  gfp_sqr_8x1w(t1, qp);
+  gfp_add_8x1w(t0, t0, t1);
+  gfp_powchn_8x1w(t0, t0, sqrt_chain, EXP_SQRTLEN);
+  gfp_sub_8x1w(t0, t0, qp);
+  gfp_mulsi_8x1w(t0, t0, 4);
+  gfp_powchn_8x1w(u, t0, cbrt_chain, EXP_CBRTLEN);
+  gfp_add_8x1w(t0, b2, b2);
+  gfp_sub_8x1w(t0, u, t0);
+  gfp_mul_8x1w(t0, t0, u);
+  gfp_mulsi_8x1w(t1, pp, 4);
+  gfp_sub_8x1w(n, t0, t1);              // n  = u^2-4*pp-2*b2*u
+  gfp_mulsi_8x1w(dd, u, 6);             // dd = 6u
+
+  // w = sqrt(f'(x0)*dd^4) = sqrt((3n^2+2*b2*n*dd+8*b4*dd^2)*dd^2)
+  gfp_mul_8x1w(t0, b2, dd);
+  gfp_mulsi_8x1w(t1, n, 3);
+  gfp_add_8x1w(t1, t1, t0);             // t1 = 3n+b2*dd
+  gfp_add_8x1w(t0, t1, t0);
+  gfp_mul_8x1w(t0, t0, n);              // t0 = 3n^2+2*b2*n*dd
+  gfp_sqr_8x1w(u, dd);
+  gfp_mul_8x1w(b6, b4, u);
+  gfp_mulsi_8x1w(b6, b6, 8);
+  gfp_add_8x1w(t0, t0, b6);
+  gfp_mul_8x1w(t0, t0, u);
+  gfp_powchn_8x1w(t0, t0, sqrt_chain, EXP_SQRTLEN);
+
+  // A : C = (3n+b2*dd)*dd : w, A24plus = A+2C and C24 = 4C
+  gfp_mul_8x1w(t1, t1, dd);
+  gfp_add_8x1w(t0, t0, t0);
+  gfp_add_8x1w(C->y, t1, t0);
+  gfp_add_8x1w(C->z, t0, t0);
+}
+
+// (8x1)-way chain of b radical isogenies of degree l = primeli[k] in {3, 5, 7}
+// from the curve A with the point P of order l: the exponent e = (|e|<<1)^s of 
+// each lane (as the secret key, s = 1 if e >= 0) gives |e| steps, the b-|e| other
+// ones are dummy. For s = 0, P is on the twist and the chain runs on the twist.
+// C = A in the lanes of e = 0. NOTE: A->y = A24plus = a, A->z = C24 = a-d
+void radical_8x1w(htpoint_t C, const htpoint_t A, const htpoint_t P, const __m512i e, const uint8_t k, const int b)
+{
+  htfe_t a, c, y, z, ah, X, Z, x2, z2, xz, y2, tn, u, v, nu, nv, al, t0, t1, t2, t3;
+  htfe_t q[2][5], vp[5];  // vp[0] unused
+  htpoint R;
+  const __m512i vone = VSET1(1), ae = VSHR(e, 1), s = VXOR(VAND(e, vone), vone);
+  __m512i m;
+  int i, j, h, l = primeli[k];
+
+  // -A and -x on the twist: (a, a-d) -> (a-(a-d), -(a-d)) and (y : z) -> (z : y)
+  gfp_zero_8x1w(t0);
+  gfp_sub_8x1w(t1, A->y, A->z);
+  gfp_sub_8x1w(t0, t0, A->z);
+  gfp_copy_8x1w(a, A->y);
+  gfp_copy_8x1w(c, A->z);
+  gfp_cmove_8x1w(a, t1, s);
+  gfp_cmove_8x1w(c, t0, s);
+  gfp_copy_8x1w(y, P->y);
+  gfp_copy_8x1w(z, P->z);
+  gfp_cswap_8x1w(y, z, s);
+
+  // the Montgomery curve A = ah/c and point (X : Z), y2 = c*Z^3*(x^3+A*x^2+x) and
+  // tn = c*Z^2*(3x^2+2A*x+1) for x = X/Z
+  gfp_add_8x1w(ah, a, a);
+  gfp_sub_8x1w(ah, ah, c);
+  gfp_add_8x1w(ah, ah, ah);             // ah = 2*(a+d)
+  gfp_add_8x1w(X, z, y);
+  gfp_sub_8x1w(Z, z, y);
+  gfp_sqr2_8x1w(x2, X, z2, Z);
+  gfp_mul_8x1w(xz, X, Z);
+  gfp_add_8x1w(t0, x2, z2);
+  gfp_muladd_8x1w(t1, c, t0, ah, xz);
+  gfp_mul_8x1w(y2, t1, X);              // y2 = X*(c*(X^2+Z^2)+ah*XZ)
+  gfp_mulsi_8x1w(t0, x2, 3);
+  gfp_add_8x1w(t0, t0, z2);
+  gfp_add_8x1w(t1, ah, ah);
+  gfp_muladd_8x1w(tn, c, t0, t1, xz);   // tn = c*(3X^2+Z^2)+2*ah*XZ
+
+  if (l == 3) {
+    // (a1, a3) = (u, v) = (tn, 2c*y2^2)
+    gfp_copy_8x1w(u, tn);
+    gfp_sqr_8x1w(t0, y2);
+    gfp_mul_8x1w(t0, t0, c);
+    gfp_add_8x1w(v, t0, t0);
+
+    for (i = 0; i < b; i++) {
+      gfp_zero_8x1w(t0);
+      gfp_sub_8x1w(t0, t0, v);
+      gfp_powchn_8x1w(al, t0, cbrt_chain, EXP_CBRTLEN);
+      gfp_mulsi_8x1w(t0, al, 6);
+      gfp_sub_8x1w(nu, u, t0);          // nu = a1-6*alpha
+      gfp_mul2_8x1w(t0, u, al, t1, u, u);
+      gfp_mulsi_8x1w(t0, t0, 3);
+      gfp_sub_8x1w(t0, t0, t1);
+      gfp_mul_8x1w(t0, t0, al);
+      gfp_mulsi_8x1w(t1, v, 9);
+      gfp_add_8x1w(nv, t0, t1);         // nv = (3*a1*alpha-a1^2)*alpha+9*a3
+
+      m = VSHR(VSUB(VSET1(i), ae), 63);  // 1 if i < |e| 
+      gfp_cmove_8x1w(u, nu, m);
+      gfp_cmove_8x1w(v, nv, m);
+    }
+
+    gfp_zero_8x1w(t0);
+    radical_mont_8x1w(&R, u, t0, v);
+  }
+  else {
+    // the Tate normal form with b = -n2^3/(256*c^2*y2^4) for l = 5 and 
+    // r = -n2^3/(32*c*y2^2*(8*c*y2^2-tn*n2)) for l = 7, n2 = 4*y2*(3c*X+ah*Z)-tn^2
+    gfp_mulsi_8x1w(t0, c, 3);
+    gfp_muladd_8x1w(t0, t0, X, ah, Z);
+    gfp_mul_8x1w(t0, t0, y2);
+    gfp_mulsi_8x1w(t0, t0, 4);
+    gfp_sqr_8x1w(t1, tn);
+    gfp_sub_8x1w(t2, t0, t1);           // t2 = n2
+    gfp_sqr_8x1w(t0, t2);
+    gfp_mul_8x1w(t0, t0, t2);
+    gfp_zero_8x1w(u);
+    gfp_sub_8x1w(u, u, t0);             // u = bn or rn = -n2^3
+    gfp_sqr_8x1w(t1, y2);
+    gfp_mul_8x1w(t1, t1, c);            // t1 = c*y2^2
+
+    if (l == 5) {
+      gfp_sqr_8x1w(t0, t1);
+      gfp_mulsi_8x1w(v, t0, 256);       // v = bd
+
+      for (i = 0; i < b; i++) {
+        // al = alpha*bd = (bn*bd^4)^(1/5)
+        gfp_sqr_8x1w(t0, v);
+        gfp_sqr_8x1w(t0, t0);
+        gfp_mul_8x1w(t0, t0, u);
+        gfp_powchn_8x1w(al, t0, rt5_chain, EXP_RT5LEN);
+
+        gfp_sqr2_8x1w(t0, al, t1, v);
+        gfp_mul_8x1w(nu, t0, t1);
+        gfp_mulsi_8x1w(nu, nu, 4);      // nu = 4*al^2*bd^2
+        gfp_mul_8x1w(t2, al, v);
+        gfp_mul2_8x1w(t3, t2, t0, t2, t2, t1);  // t3 = al^3*bd, t2 = al*bd^3
+        gfp_sqr2_8x1w(t0, t0, t1, t1);
+        gfp_add_8x1w(t0, t0, t1);
+        gfp_add_8x1w(t0, t0, nu);       // t0 = al^4+4*al^2*bd^2+bd^4
+
+        gfp_mulsi_8x1w(t1, t3, 3);
+        gfp_add_8x1w(nu, t0, t1);
+        gfp_mulsi_8x1w(t1, t2, 2);
+        gfp_add_8x1w(nu, nu, t1);
+        gfp_mulsi_8x1w(t1, t3, 2);
+        gfp_sub_8x1w(nv, t0, t1);
+        gfp_mulsi_8x1w(t1, t2, 3);
+        gfp_sub_8x1w(nv, nv, t1);
+        gfp_mul2_8x1w(nu, nu, al, nv, nv, v);
+
+        m = VSHR(VSUB(VSET1(i), ae), 63);
+        gfp_cmove_8x1w(u, nu, m);
+        gfp_cmove_8x1w(v, nv, m);
+      }
+
+      // E(b, b) scaled by bd: (a1, a2, a3) = (bd-bn, -bn*bd, -bn*bd^2)
+      gfp_sub_8x1w(t0, v, u);
+      gfp_mul_8x1w(t2, u, v);
+      gfp_zero_8x1w(t1);
+      gfp_sub_8x1w(t1, t1, t2);
+      gfp_mul_8x1w(t2, t1, v);
+    }
+    else {
+      gfp_mulsi_8x1w(t0, t1, 8);
+      gfp_mul_8x1w(t3, tn, t2);
+      gfp_sub_8x1w(t0, t0, t3);
+      gfp_mul_8x1w(t0, t0, t1);
+      gfp_mulsi_8x1w(v, t0, 32);        // v = rd
+
+      for (i = 0; i < b; i++) {
+        // al = alpha*rd = (rn*(rn-rd)^2*rd^4)^(1/7)
+        gfp_copy_8x1w(vp[1], v);
+        gfp_sqr_8x1w(vp[2], v);
+        gfp_mul_8x1w(vp[3], vp[2], v);
+        gfp_sqr_8x1w(vp[4], vp[2]);
+        gfp_sub_8x1w(t0, u, v);
+        gfp_sqr_8x1w(t0, t0);
+        gfp_mul_8x1w(t0, t0, vp[4]);
+        gfp_mul_8x1w(t0, t0, u);
+        gfp_powchn_8x1w(al, t0, rt7_chain, EXP_RT7LEN);
+
+        // q[j][h] = rd^2 * (the coefficient of alpha^h in N (j = 0) or D (j = 1))
+        gfp_sqr_8x1w(t0, u);
+        gfp_mul_8x1w(t1, u, v);
+        for (j = 0; j < 2; j++) {
+          for (h = 0; h < 5; h++) {
+            gfp_mulsi_8x1w(q[j][h], t0, rad7_coef[j][h][0]);
+            gfp_mulsi_8x1w(t2, t1, rad7_coef[j][h][1]);
+            gfp_add_8x1w(q[j][h], q[j][h], t2);
+            gfp_mulsi_8x1w(t2, vp[2], rad7_coef[j][h][2]);
+            gfp_add_8x1w(q[j][h], q[j][h], t2);
+          }
+        }
+
+        // rd^6 * (N : D) = sum of q[j][h]*al^h*rd^(4-h) (Horner)
+        gfp_copy_8x1w(nu, q[0][4]);
+        gfp_copy_8x1w(nv, q[1][4]);
+        for (h = 3; h >= 0; h--) {
+          gfp_muladd_8x1w(nu, nu, al, q[0][h], vp[4-h]);
+          gfp_muladd_8x1w(nv, nv, al, q[1][h], vp[4-h]);
+        }
+
+        m = VSHR(VSUB(VSET1(i), ae), 63);
+        gfp_cmove_8x1w(u, nu, m);
+        gfp_cmove_8x1w(v, nv, m);
+      }
+
+      // E(r^3-r^2, r^2-r) scaled by rd^2: (a1, a2, a3) = (rd^2+rn*rd-rn^2, g*rd, 
+      // g*rd^3) with g = rn^2*(rd-rn)
+      gfp_sqr2_8x1w(t1, u, t3, v);
+      gfp_mul_8x1w(t0, u, v);
+      gfp_add_8x1w(t0, t0, t3);
+      gfp_sub_8x1w(t0, t0, t1);
+      gfp_sub_8x1w(t2, v, u);
+      gfp_mul_8x1w(t2, t2, t1);
+      gfp_mul_8x1w(t1, t2, v);
+      gfp_mul_8x1w(t2, t1, t3);
+    }
+
+    radical_mont_8x1w(&R, t0, t1, t2);
+  }
+
+  // back from the twist, and C = A in the lanes of e = 0
+  gfp_zero_8x1w(t0);
+  gfp_sub_8x1w(t1, R.y, R.z);
+  gfp_sub_8x1w(t0, t0, R.z);
+  gfp_cmove_8x1w(R.y, t1, s);
+  gfp_cmove_8x1w(R.z, t0, s);
+  m = VSHR(VSUB(VZERO, ae), 63);
+  point_cmove_8x1w(&R, (htpoint *)A, VXOR(m, vone));
+  point_copy_8x1w(C, &R);
+}
+
+// split the (8x1)-way point P (e.g., a curve in Montgomery domain R' = 2^520) 
+// into eight (2x4)-way points R[i] <y | z> in Montgomery domain R = 2^516
+void point_ht2ll_8x1w(llpoint_t R[8], const htpoint_t P)
+{
+  __m512i y[LL_NWORDS], z[LL_NWORDS], t[8], u[8];
+  int i, j;
+
+  gfp_ht2ll_8x1w(y, P->y);
+  gfp_ht2ll_8x1w(z, P->z);
+
+  // lane i of R[k][j] is limb j+3i of z (i < 4) or limb j+3(i-4) of y (i >= 4)
+  for (j = 0; j < LL_VLIMBS; j++) {
+    for (i = 0; i < 4; i++) {
+      t[i] = z[j+LL_VLIMBS*i];
+      t[i+4] = y[j+LL_VLIMBS*i];
+    }
+    vec_transpose_8x8(u, t);
+    for (i = 0; i < 8; i++) R[i][j] = u[i];
+  }
+}
+
+// merge eight (2x4)-way points P[i] into the (8x1)-way point R, the inverse of 
+// point_ht2ll_8x1w
+void point_ll2ht_8x1w(htpoint_t R, const llpoint_t P[8])
+{
+  __m512i y[LL_NWORDS], z[LL_NWORDS], t[8], u[8];
+  int i, j;
+
+  for (j = 0; j < LL_VLIMBS; j++) {
+    for (i = 0; i < 8; i++) t[i] = P[i][j];
+    vec_transpose_8x8(u, t);
+    for (i = 0; i < 4; i++) {
+      z[j+LL_VLIMBS*i] = u[i];
+      y[j+LL_VLIMBS*i] = u[i+4];
+    }
+  }
+
+  gfp_ll2ht_8x1w(R->y, y);
+  gfp_ll2ht_8x1w(R->z, z);
 }
 
 // -----------------------------------------------------------------------------
@@ -509,9 +1596,12 @@ void yMUL_2x4w(llpoint_t R, const llpoint_t P, const llpoint_t A, const uint8_t
 void elligator_2x4w(llpoint_t Tplus, llpoint_t Tminus, const llpoint_t A)
 {
   llfe_t t0, t1, t2, t3, t4, t5, t6, vu, vone, vR2, alpha;
-  uint64_t u64[8], u[LL_NWORDS];
+  uint64_t u64[8], ur[LL_NWORDS];
+  const uint64_t *u = ur;
   uint8_t m;
-  int i;
+#ifdef ELLIGATOR_FIXED
+  static __thread int next = 0;       // the next u of the table, ELL_NU: random u
+#endif
 
   gfp_zero_2x4w(alpha);                 // alpha = 0 | 0
 
@@ -523,10 +1613,19 @@ void elligator_2x4w(llpoint_t Tplus, llpoint_t Tminus, const llpoint_t A)
 
   vec_permll_2x4w(t6, t6);
 
-  do {
-    mpi64_random(u64);
-  } while (mpi64_compare(u64, u64_pdiv2) > 0);// repeat if u > (p-1)/2 
-  mpi_conv_64to43(u, u64, LL_NWORDS, 8);  // convert to radix-43      
+#ifdef ELLIGATOR_FIXED
+  // every (ELL_NU+1)-th call takes a random u, see elligator_8x1w
+  if (next < ELL_NU) u = ll_ellu[next];
+  next = (next+1) % (ELL_NU+1);
+  if (u == ur)
+#endif
+  {
+    do {
+      mpi64_random(u64);
+    } while (mpi64_compare(u64, u64_pdiv2) > 0);// repeat if u > (p-1)/2 
+    mpi_conv_64to43(ur, u64, LL_NWORDS, 8); // convert to radix-43      
+    u = ur;
+  }
 
   // vu = u' | u'
   vu[0] = set_vector(u[9] , u[6], u[3], u[0], u[9] , u[6], u[3], u[0]);
@@ -540,6 +1639,10 @@ void elligator_2x4w(llpoint_t Tplus, llpoint_t Tminus, const llpoint_t A)
   vR2[0] = VSET(ll_montR2[9] , ll_montR2[6], ll_montR2[3], ll_montR2[0], ll_montR2[9] , ll_montR2[6], ll_montR2[3], ll_montR2[0]);
   vR2[1] = VSET(ll_montR2[10], ll_montR2[7], ll_montR2[4], ll_montR2[1], ll_montR2[10], ll_montR2[7], ll_montR2[4], ll_montR2[1]);
   vR2[2] = VSET(ll_montR2[11], ll_montR2[8], ll_montR2[5], ll_montR2[2], ll_montR2[11], ll_montR2[8], ll_montR2[5], ll_montR2[2]);
+#ifdef ELLIGATOR_FIXED
+  // u' of the table is in Montgomery domain already: multiply it by 1 
+  if (u != ur) gfp_copy_2x4w(vR2, vone);
+#endif
 
   vec_blend_2x4w(t1, vu, t6, 0x0F);     //  t1 = u'  | A
   vec_blend_2x4w(t2, vR2, A, 0x0F);     //  t2 = R2  | C
@@ -678,3 +1781,354 @@ void yEVAL_2x4w(llpoint_t R, const llpoint_t Q, const llpoint_t P[], const uint8
   gfp_subaddc_2x4w(R, V, t0);
 }
 
+// (2x4)-way multi-point y-coordinate isogeny evaluation on twisted Edwards curve,
+// see yEVALmulti_8x1w; the permutation of each kernel multiple is shared too.
+void yEVALmulti_2x4w(llpoint_t *R[], llpoint_t *const Q[], const llpoint_t P[], const int n, const uint8_t k)
+{
+  llpoint_t T[EVAL_NQMAX], S[EVAL_NQMAX], U, V, t0, t1;
+  int i, h, s = primeli[k]>>1;
+
+  for (h = 0; h < n; h++) point_copy_2x4w(T[h], *Q[h]);
+
+  vec_permlh_2x4w(t1, P[0]);            // t1 = zP0 | yP0
+  for (h = 0; h < n; h++) {
+    gfp_mul_2x4w(U, T[h], t1);          // U  = yQ*zP0 | zQ*yP0
+    vec_permlh_2x4w(t0, U);             // t0 = zQ*yP0 | yQ*zP0
+    gfp_addsubi_2x4w(S[h], t0, U);      // S  = yQ*zP0+zQ*yP0 | yQ*zP0-zQ*yP0
+  }
+
+  for (i = 1; i < s; i++) {
+    vec_permlh_2x4w(t1, P[i]);          // t1 = zPi | yPi
+    for (h = 0; h < n; h++) {
+      gfp_mul_2x4w(U, T[h], t1);        // U  = yQ*zPi | zQ*yPi
+      vec_permlh_2x4w(t0, U);           // t0 = zQ*yPi | yQ*zPi
+      gfp_addsubi_2x4w(V, t0, U);       // V  = yQ*zPi+zQ*yPi | yQ*zPi-zQ*yPi
+      gfp_mul_2x4w(S[h], S[h], V);
+    }
+  }
+
+  for (h = 0; h < n; h++) {
+    gfp_sqr_2x4w(S[h], S[h]);
+    vec_permlh_2x4w(t0, T[h]);          // t0 = zQ | yQ
+    gfp_addsubc_2x4w(V, T[h], t0);      // V  = yQ+zQ | zQ-yQ
+    gfp_mul_2x4w(V, S[h], V);
+    vec_permlh_2x4w(t0, V);             // t0 = zV | yV
+    gfp_subaddc_2x4w(*R[h], V, t0);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// (2x4)-way radical isogenies of degree l = 3, 5, 7 [CDV20], see radical_8x1w
+
+// the low halves r = a + b and r = a - b mod 2p
+static void gfp_addl_2x4w(llfe_t r, const llfe_t a, const llfe_t b)
+{
+  gfp_subaddc_2x4w(r, a, b);
+}
+
+static void gfp_subl_2x4w(llfe_t r, const llfe_t a, const llfe_t b)
+{
+  gfp_addsubc_2x4w(r, a, b);
+}
+
+// the low halves r = a * b and s = c * d with one (2x4)-way multiplication
+static void gfp_mul2l_2x4w(llfe_t r, const llfe_t a, const llfe_t b, llfe_t s, const llfe_t c, const llfe_t d)
+{
+  llfe_t t0, t1;
+
+  vec_permlh_2x4w(t0, a);
+  vec_blend_2x4w(t0, t0, c, 0x0F);      // t0 = a   | c
+  vec_permlh_2x4w(t1, b);
+  vec_blend_2x4w(t1, t1, d, 0x0F);      // t1 = b   | d
+  gfp_mul_2x4w(t1, t0, t1);             // t1 = a*b | c*d
+  vec_permzh_2x4w(r, t1);
+  gfp_copy_2x4w(s, t1);
+}
+
+// the low half r = a * b + c * d
+static void gfp_muladdl_2x4w(llfe_t r, const llfe_t a, const llfe_t b, const llfe_t c, const llfe_t d)
+{
+  llfe_t t0, t1;
+
+  gfp_mul2l_2x4w(t0, a, b, t1, c, d);
+  gfp_addl_2x4w(r, t0, t1);
+}
+
+// the low half r = c * a for a small public integer c
+static void gfp_mulsi_2x4w(llfe_t r, const llfe_t a, const int c)
+{
+  llfe_t t;
+  int i, n = (c < 0) ? -c : c;
+
+  gfp_zero_2x4w(t);
+  for (i = 31-__builtin_clz(n|1); i >= 0; i--) {
+    gfp_addl_2x4w(t, t, t);
+    if ((n>>i) & 1) gfp_addl_2x4w(t, t, a);
+  }
+  if (c < 0) {
+    gfp_zero_2x4w(r);
+    gfp_subl_2x4w(r, r, t);
+  }
+  else gfp_copy_2x4w(r, t);
+}
+
+// the curve (a : c) = (A24plus : C24) of the Weierstrass model (a1, a2, a3), see 
+// radical_mont_8x1w
+static void radical_mont_2x4w(llfe_t a, llfe_t c, const llfe_t a1, const llfe_t a2, const llfe_t a3)
+{
+  llfe_t b2, b4, b6, pp, qp, u, n, dd, t0, t1;
+
+  gfp_sqr_2x4w(t0, a1);
+  gfp_mulsi_2x4w(t1, a2, 4);
+  gfp_addl_2x4w(b2, t0, t1);            // b2 = a1^2+4*a2
+  gfp_mul_2x4w(b4, a1, a3);             // b4 = a1*a3
+  gfp_sqr_2x4w(b6, a3);                 // b6 = a3^2
+
+  // f(t-b2/3) = t^3 + pp/3*t + qp/27
+  gfp_sqr_2x4w(t0, b2);
+  gfp_mulsi_2x4w(t1, b4, 24);
+  gfp_subl_2x4w(pp, t1, t0);            // pp = 24*b4-b2^2
+  gfp_addl_2x4w(t0, t0, t0);
+  gfp_mulsi_2x4w(t1, b4, 72);
+  gfp_subl_2x4w(t0, t0, t1);
+  gfp_mul_2x4w(t0, t0, b2);
+  gfp_mulsi_2x4w(t1, b6, 432);
+  gfp_addl_2x4w(qp, t0, t1);            // qp = 2*b2^3-72*b2*b4+432*b6
+
+  // Cardano's formula: u = (4*(sqrt(qp^2+4*pp^3)-qp))^(1/3), x0 = (u^2-4*pp-2*b2*u)/6u
+  gfp_sqr_2x4w(t0, pp);
+  gfp_mul_2x4w(t0, t0, pp);
+  gfp_mulsi_2x4w(t0, t0, 4);
+  gfp_sqr_2x4w(t1, qp);
+  gfp_addl_2x4w(t0, t0, t1);
+  gfp_powchn_2x4w(t0, t0, sqrt_chain, EXP_SQRTLEN);
+  gfp_subl_2x4w(t0, t0, qp);
+  gfp_mulsi_2x4w(t0, t0, 4);
+  gfp_powchn_2x4w(u, t0, cbrt_chain, EXP_CBRTLEN);
+  gfp_addl_2x4w(t0, b2, b2);
+  gfp_subl_2x4w(t0, u, t0);
+  gfp_mul_2x4w(t0, t0, u);
+  gfp_mulsi_2x4w(t1, pp, 4);
+  gfp_subl_2x4w(n, t0, t1);             // n  = u^2-4*pp-2*b2*u
+  gfp_mulsi_2x4w(dd, u, 6);             // dd = 6u
+
+  // w = sqrt(f'(x0)*dd^4) = sqrt((3n^2+2*b2*n*dd+8*b4*dd^2)*dd^2)
+  gfp_mul_2x4w(t0, b2, dd);
+  gfp_mulsi_2x4w(t1, n, 3);
+  gfp_addl_2x4w(t1, t1, t0);            // t1 = 3n+b2*dd
+  gfp_addl_2x4w(t0, t1, t0);
+  gfp_mul_2x4w(t0, t0, n);              // t0 = 3n^2+2*b2*n*dd
+  gfp_sqr_2x4w(u, dd);
+  gfp_mul_2x4w(b6, b4, u);
+  gfp_mulsi_2x4w(b6, b6, 8);
+  gfp_addl_2x4w(t0, t0, b6);
+  gfp_mul_2x4w(t0, t0, u);
+  gfp_powchn_2x4w(t0, t0, sqrt_chain, EXP_SQRTLEN);
+
+  // A : C = (3n+b2*dd)*dd : w, A24plus = A+2C and C24 = 4C
+  gfp_mul_2x4w(t1, t1, dd);
+  gfp_addl_2x4w(t0, t0, t0);
+  gfp_addl_2x4w(a, t1, t0);
+  gfp_addl_2x4w(c, t0, t0);
+}
+
+// (2x4)-way chain of b radical isogenies of degree l = primeli[k] in {3, 5, 7} 
+// from the curve A with the point P of order l, see radical_8x1w; e is the 
+// exponent of the instance. NOTE: A = <A24plus | C24> = <a | a-d>
+void radical_2x4w(llpoint_t C, const llpoint_t A, const llpoint_t P, const uint8_t e, const uint8_t k, const int b)
+{
+  llfe_t a, c, y, z, ah, X, Z, x2, z2, xz, y2, tn, u, v, nu, nv, al, t0, t1, t2, t3;
+  llfe_t q[2][5], vp[5];  // vp[0] unused
+  const uint8_t ae = e>>1, s = (e&1)^1;
+  uint8_t m;
+  int i, j, h, l = primeli[k];
+
+  // only the low halves are meaningful below, as in gfp_powchn_2x4w
+  vec_permzh_2x4w(a, A);
+  gfp_copy_2x4w(c, A);
+  vec_permzh_2x4w(y, P);
+  gfp_copy_2x4w(z, P);
+
+  // -A and -x on the twist: (a, a-d) -> (a-(a-d), -(a-d)) and (y : z) -> (z : y)
+  gfp_zero_2x4w(t0);
+  gfp_subl_2x4w(t1, a, c);
+  gfp_subl_2x4w(t0, t0, c);
+  gfp_cmove_2x4w(a, t1, s);
+  gfp_cmove_2x4w(c, t0, s);
+  gfp_cswap_2x4w(y, z, s);
+
+  // the Montgomery curve A = ah/c and point (X : Z), y2 = c*Z^3*(x^3+A*x^2+x) and
+  // tn = c*Z^2*(3x^2+2A*x+1) for x = X/Z
+  gfp_addl_2x4w(ah, a, a);
+  gfp_subl_2x4w(ah, ah, c);
+  gfp_addl_2x4w(ah, ah, ah);            // ah = 2*(a+d)
+  gfp_addl_2x4w(X, z, y);
+  gfp_subl_2x4w(Z, z, y);
+  gfp_mul2l_2x4w(x2, X, X, z2, Z, Z);
+  gfp_mul_2x4w(xz, X, Z);
+  gfp_addl_2x4w(t0, x2, z2);
+  gfp_muladdl_2x4w(t1, c, t0, ah, xz);
+  gfp_mul_2x4w(y2, t1, X);              // y2 = X*(c*(X^2+Z^2)+ah*XZ)
+  gfp_mulsi_2x4w(t0, x2, 3);
+  gfp_addl_2x4w(t0, t0, z2);
+  gfp_addl_2x4w(t1, ah, ah);
+  gfp_muladdl_2x4w(tn, c, t0, t1, xz);  // tn = c*(3X^2+Z^2)+2*ah*XZ
+
+  if (l == 3) {
+    // (a1, a3) = (u, v) = (tn, 2c*y2^2)
+    gfp_copy_2x4w(u, tn);
+    gfp_sqr_2x4w(t0, y2);
+    gfp_mul_2x4w(t0, t0, c);
+    gfp_addl_2x4w(v, t0, t0);
+
+    for (i = 0; i < b; i++) {
+      gfp_zero_2x4w(t0);
+      gfp_subl_2x4w(t0, t0, v);
+      gfp_powchn_2x4w(al, t0, cbrt_chain, EXP_CBRTLEN);
+      gfp_mulsi_2x4w(t0, al, 6);
+      gfp_subl_2x4w(nu, u, t0);         // nu = a1-6*alpha
+      gfp_mul2l_2x4w(t0, u, al, t1, u, u);
+      gfp_mulsi_2x4w(t0, t0, 3);
+      gfp_subl_2x4w(t0, t0, t1);
+      gfp_mul_2x4w(t0, t0, al);
+      gfp_mulsi_2x4w(t1, v, 9);
+      gfp_addl_2x4w(nv, t0, t1);        // nv = (3*a1*alpha-a1^2)*alpha+9*a3
+
+      m = (uint32_t)(i-ae) >> 31;        // 1 if i < |e|
+      gfp_cmove_2x4w(u, nu, m);
+      gfp_cmove_2x4w(v, nv, m);
+    }
+
+    gfp_zero_2x4w(t0);
+    radical_mont_2x4w(a, c, u, t0, v);
+  }
+  else {
+    // the Tate normal form with b = -n2^3/(256*c^2*y2^4) for l = 5 and 
+    // r = -n2^3/(32*c*y2^2*(8*c*y2^2-tn*n2)) for l = 7, n2 = 4*y2*(3c*X+ah*Z)-tn^2
+    gfp_mulsi_2x4w(t0, c, 3);
+    gfp_muladdl_2x4w(t0, t0, X, ah, Z);
+    gfp_mul_2x4w(t0, t0, y2);
+    gfp_mulsi_2x4w(t0, t0, 4);
+    gfp_sqr_2x4w(t1, tn);
+    gfp_subl_2x4w(t2, t0, t1);          // t2 = n2
+    gfp_sqr_2x4w(t0, t2);
+    gfp_mul_2x4w(t0, t0, t2);
+    gfp_zero_2x4w(u);
+    gfp_subl_2x4w(u, u, t0);            // u = bn or rn = -n2^3
+    gfp_sqr_2x4w(t1, y2);
+    gfp_mul_2x4w(t1, t1, c);            // t1 = c*y2^2
+
+    if (l == 5) {
+      gfp_sqr_2x4w(t0, t1);
+      gfp_mulsi_2x4w(v, t0, 256);       // v = bd
+
+      for (i = 0; i < b; i++) {
+        // al = alpha*bd = (bn*bd^4)^(1/5)
+        gfp_sqr_2x4w(t0, v);
+        gfp_sqr_2x4w(t0, t0);
+        gfp_mul_2x4w(t0, t0, u);
+        gfp_powchn_2x4w(al, t0, rt5_chain, EXP_RT5LEN);
+
+        gfp_mul2l_2x4w(t0, al, al, t1, v, v);
+        gfp_mul_2x4w(nu, t0, t1);
+        gfp_mulsi_2x4w(nu, nu, 4);      // nu = 4*al^2*bd^2
+        gfp_mul_2x4w(t2, al, v);
+        gfp_mul2l_2x4w(t3, t2, t0, t2, t2, t1);  // t3 = al^3*bd, t2 = al*bd^3
+        gfp_mul2l_2x4w(t0, t0, t0, t1, t1, t1);
+        gfp_addl_2x4w(t0, t0, t1);
+        gfp_addl_2x4w(t0, t0, nu);      // t0 = al^4+4*al^2*bd^2+bd^4
+
+        gfp_mulsi_2x4w(t1, t3, 3);
+        gfp_addl_2x4w(nu, t0, t1);
+        gfp_mulsi_2x4w(t1, t2, 2);
+        gfp_addl_2x4w(nu, nu, t1);
+        gfp_mulsi_2x4w(t1, t3, 2);
+        gfp_subl_2x4w(nv, t0, t1);
+        gfp_mulsi_2x4w(t1, t2, 3);
+        gfp_subl_2x4w(nv, nv, t1);
+        gfp_mul2l_2x4w(nu, nu, al, nv, nv, v);
+
+        m = (uint32_t)(i-ae) >> 31;
+        gfp_cmove_2x4w(u, nu, m);
+        gfp_cmove_2x4w(v, nv, m);
+      }
+
+      // E(b, b) scaled by bd: (a1, a2, a3) = (bd-bn, -bn*bd, -bn*bd^2)
+      gfp_subl_2x4w(t0, v, u);
+      gfp_mul_2x4w(t2, u, v);
+      gfp_zero_2x4w(t1);
+      gfp_subl_2x4w(t1, t1, t2);
+      gfp_mul_2x4w(t2, t1, v);
+    }
+    else {
+      gfp_mulsi_2x4w(t0, t1, 8);
+      gfp_mul_2x4w(t3, tn, t2);
+      gfp_subl_2x4w(t0, t0, t3);
+      gfp_mul_2x4w(t0, t0, t1);
+      gfp_mulsi_2x4w(v, t0, 32);        // v = rd
+
+      for (i = 0; i < b; i++) {
+        // al = alpha*rd = (rn*(rn-rd)^2*rd^4)^(1/7)
+        gfp_copy_2x4w(vp[1], v);
+        gfp_sqr_2x4w(vp[2], v);
+        gfp_mul_2x4w(vp[3], vp[2], v);
+        gfp_sqr_2x4w(vp[4], vp[2]);
+        gfp_subl_2x4w(t0, u, v);
+        gfp_sqr_2x4w(t0, t0);
+        gfp_mul_2x4w(t0, t0, vp[4]);
+        gfp_mul_2x4w(t0, t0, u);
+        gfp_powchn_2x4w(al, t0, rt7_chain, EXP_RT7LEN);
+
+        // q[j][h] = rd^2 * (the coefficient of alpha^h in N (j = 0) or D (j = 1))
+        gfp_sqr_2x4w(t0, u);
+        gfp_mul_2x4w(t1, u, v);
+        for (j = 0; j < 2; j++) {
+          for (h = 0; h < 5; h++) {
+            gfp_mulsi_2x4w(q[j][h], t0, rad7_coef[j][h][0]);
+            gfp_mulsi_2x4w(t2, t1, rad7_coef[j][h][1]);
+            gfp_addl_2x4w(q[j][h], q[j][h], t2);
+            gfp_mulsi_2x4w(t2, vp[2], rad7_coef[j][h][2]);
+            gfp_addl_2x4w(q[j][h], q[j][h], t2);
+          }
+        }
+
+        // rd^6 * (N : D) = sum of q[j][h]*al^h*rd^(4-h) (Horner)
+        gfp_copy_2x4w(nu, q[0][4]);
+        gfp_copy_2x4w(nv, q[1][4]);
+        for (h = 3; h >= 0; h--) {
+          gfp_muladdl_2x4w(nu, nu, al, q[0][h], vp[4-h]);
+          gfp_muladdl_2x4w(nv, nv, al, q[1][h], vp[4-h]);
+        }
+
+        m = (uint32_t)(i-ae) >> 31;
+        gfp_cmove_2x4w(u, nu, m);
+        gfp_cmove_2x4w(v, nv, m);
+      }
+
+      // E(r^3-r^2, r^2-r) scaled by rd^2: (a1, a2, a3) = (rd^2+rn*rd-rn^2, g*rd, 
+      // g*rd^3) with g = rn^2*(rd-rn)
+      gfp_mul2l_2x4w(t1, u, u, t3, v, v);
+      gfp_mul_2x4w(t0, u, v);
+      gfp_addl_2x4w(t0, t0, t3);
+      gfp_subl_2x4w(t0, t0, t1);
+      gfp_subl_2x4w(t2, v, u);
+      gfp_mul_2x4w(t2, t2, t1);
+      gfp_mul_2x4w(t1, t2, v);
+      gfp_mul_2x4w(t2, t1, t3);
+    }
+
+    radical_mont_2x4w(a, c, t0, t1, t2);
+  }
+
+  // back from the twist, and C = A if e = 0
+  gfp_zero_2x4w(t0);
+  gfp_subl_2x4w(t1, a, c);
+  gfp_subl_2x4w(t0, t0, c);
+  gfp_cmove_2x4w(a, t1, s);
+  gfp_cmove_2x4w(c, t0, s);
+  vec_permlh_2x4w(a, a);
+  vec_blend_2x4w(t0, a, c, 0x0F);       // t0 = a' | a'-d'
+  m = (uint32_t)(0-ae) >> 31;
+  gfp_copy_2x4w(C, A);
+  gfp_cmove_2x4w(C, t0, m);
+}
@@ -100,13 +100,13 @@ void mpi_conv_43to52(uint64_t *r, const uint64_t *a, int rlen, int alen)
     bits_to_shift = (52 - bits_in_word);
     bits_in_word += 43;
     if (bits_in_word >= 52) {
-      r[i++] = word;
+      r[i++] = (word & HT_BMASK);       // the bits above 52 are those of the next limb
       word = ((bits_to_shift > 0) ? (a[j] >> bits_to_shift) : 0);
       bits_in_word = ((bits_to_shift > 0) ? (43 - bits_to_shift) : 0);
     }
     j++;
   }
-  if (i < rlen) r[i++] = word;
+  if (i < rlen) r[i++] = (word & HT_BMASK);
   for (; i < rlen; i++) r[i] = 0;
 }
 
@@ -188,3 +188,63 @@ void get_channel_2x4w(uint64_t *r, const llfe_t a, const int ch)
     r[i+3*LL_VLIMBS] = ((uint64_t *)&a[i])[ch+3];
   }
 }
+
+// transpose the 8x8 matrix of 64-bit elements: lane j of r[i] = lane i of a[j]
+void vec_transpose_8x8(__m512i *r, const __m512i *a)
+{
+  __m512i s0, s1, s2, s3, s4, s5, s6, s7, u0, u1, u2, u3, u4, u5, u6, u7;
+
+  s0 = VUNPACKLO(a[0], a[1]); s1 = VUNPACKHI(a[0], a[1]);
+  s2 = VUNPACKLO(a[2], a[3]); s3 = VUNPACKHI(a[2], a[3]);
+  s4 = VUNPACKLO(a[4], a[5]); s5 = VUNPACKHI(a[4], a[5]);
+  s6 = VUNPACKLO(a[6], a[7]); s7 = VUNPACKHI(a[6], a[7]);
+
+  u0 = VSHUF128(s0, s2, 0x88); u1 = VSHUF128(s0, s2, 0xDD);
+  u2 = VSHUF128(s1, s3, 0x88); u3 = VSHUF128(s1, s3, 0xDD);
+  u4 = VSHUF128(s4, s6, 0x88); u5 = VSHUF128(s4, s6, 0xDD);
+  u6 = VSHUF128(s5, s7, 0x88); u7 = VSHUF128(s5, s7, 0xDD);
+
+  r[0] = VSHUF128(u0, u4, 0x88); r[4] = VSHUF128(u0, u4, 0xDD);
+  r[2] = VSHUF128(u1, u5, 0x88); r[6] = VSHUF128(u1, u5, 0xDD);
+  r[1] = VSHUF128(u2, u6, 0x88); r[5] = VSHUF128(u2, u6, 0xDD);
+  r[3] = VSHUF128(u3, u7, 0x88); r[7] = VSHUF128(u3, u7, 0xDD);
+}
+
+// load eight 512-bit integers a[i] (radix-64, little-endian) into lane i of the 
+// radix-52 (8x1)-way element r
+void mpi_load_8x1w(htfe_t r, const uint64_t (*a)[8])
+{
+  __m512i t[8], w[8];
+  int i, j, s;
+
+  for (i = 0; i < 8; i++) t[i] = VLOAD(a[i]);
+  vec_transpose_8x8(w, t);              // lane i of w[j] = a[i][j]
+
+  // limb i holds bits [52i, 52i+52), i.e., the bits from s of word j and the 
+  // low bits of word j+1
+  for (i = 0; i < HT_NWORDS; i++) {
+    j = (52*i) >> 6; s = (52*i) & 63;
+    r[i] = VSHR(w[j], s);
+    if ((s > 12) && (j < 7)) r[i] = VOR(r[i], VSHL(w[j+1], 64-s));
+    r[i] = VAND(r[i], VSET1(HT_BMASK));
+  }
+}
+
+// store the radix-52 (8x1)-way element a (every limb in [0, 2^52), every lane 
+// < 2^512) into eight 512-bit integers r[i] (radix-64, little-endian)
+void mpi_store_8x1w(uint64_t (*r)[8], const htfe_t a)
+{
+  __m512i t[8], w[8];
+  int i, j, s;
+
+  // word j holds bits [64j, 64j+64), i.e., the bits from s of limb i and the 
+  // limbs i+1 and (at most 12 bits of) i+2 
+  for (j = 0; j < 8; j++) {
+    i = (64*j) / 52; s = (64*j) % 52;
+    w[j] = VOR(VSHR(a[i], s), VSHL(a[i+1], 52-s));
+    if ((s > 40) && (i+2 < HT_NWORDS)) w[j] = VOR(w[j], VSHL(a[i+2], 104-s));
+  }
+
+  vec_transpose_8x8(t, w);
+  for (i = 0; i < 8; i++) VSTORE(r[i], t[i]);
+}
@@ -0,0 +1,95 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#ifndef _ACTION_H_
+#define _ACTION_H_
+
+#include "gfparith.h"
+#include "tedcurve.h"
+#include "rng.h"
+
+// exponent bound 
+static int8_t B[N] =	{
+  2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 
+  5, 5, 5, 5, 5, 5, 5, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 9, 
+  9, 9, 10, 10, 10, 10, 9, 8, 8, 8, 7, 7, 7, 7, 7, 6, 5, 1, 2, 2, 2, 2 };
+
+// base Montgomery curve A = 0, therefore twsited Edwards curve a = A+2C = 2, d = 4C = 4
+static uint32_t E[2][HT_NWORDS] = {
+  { 0x17efc3aa, 0x12882a1c, 0x1b60b30d, 0x126565bb, 0x089cb42a, 0x093b7f28,
+    0x0aac81ee, 0x1525e144, 0x1663ca2d, 0x0dece90c, 0x0eb23a88, 0x00d06028, 
+    0x1604d98c, 0x02040046, 0x10a35277, 0x1698b3f8, 0x1be15f2c, 0x0003170e, },
+  { 0x1c18bed9, 0x09028c0f, 0x0b9758d4, 0x0092e2c8, 0x1c470c2e, 0x1a10eeca, 
+    0x013bbe3f, 0x119ec41e, 0x1f1fe994, 0x0740bbca, 0x06a575df, 0x060fa7cc, 
+    0x09392f69, 0x04e1db33, 0x16835f75, 0x1bf9685f, 0x09334a49, 0x00030079, },
+};
+
+// -----------------------------------------------------------------------------
+// SIMBA-3-8 parameters 
+
+#define NUMBA 3
+#define ROUND 8
+#define MAXSIZEBA 25
+
+static uint8_t SIZEBA[NUMBA] = { 25, 25, 24 };
+static uint8_t BATCHES[NUMBA][MAXSIZEBA] = { 
+  {  0,  3,  6,  9, 12, 15, 18, 21, 24, 27, 30, 33, 
+    36, 39, 42, 45, 48, 51, 54, 57, 60, 63, 66, 69, 72 },
+  {  1,  4,  7, 10, 13, 16, 19, 22, 25, 28, 31, 34, 
+    37, 40, 43, 46, 49, 52, 55, 58, 61, 64, 67, 70, 73 },
+  {  2,  5,  8, 11, 14, 17, 20, 23, 26, 29, 32, 35, 
+    38, 41, 44, 47, 50, 53, 56, 59, 62, 65, 68, 71 }, };
+
+static uint8_t LASTISO[NUMBA] = { 72, 73, 71 };
+static uint16_t NUMISO = 404;
+
+// complement of batch
+static uint8_t SICOBA[NUMBA] = { 49, 49, 50 };
+static uint8_t COMPBA[NUMBA][N] = {
+  {  1,  2,  4,  5,  7,  8, 10, 11, 13, 14, 16, 17, 19, 20, 22, 23, 25, 26, 28, 
+    29, 31, 32, 34, 35, 37, 38, 40, 41, 43, 44, 46, 47, 49, 50, 52, 53, 55, 56, 
+    58, 59, 61, 62, 64, 65, 67, 68, 70, 71, 73, 74, 74, 74, 74, 74, 74, 74, 74, 
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74 },
+  {  0,  2,  3,  5,  6,  8,  9, 11, 12, 14, 15, 17, 18, 20, 21, 23, 24, 26, 27, 
+    29, 30, 32, 33, 35, 36, 38, 39, 41, 42, 44, 45, 47, 48, 50, 51, 53, 54, 56,
+    57, 59, 60, 62, 63, 65, 66, 68, 69, 71, 72, 74, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74 },
+  {  0,  1,  3,  4,  6,  7,  9, 10, 12, 13, 15, 16, 18, 19, 21, 22, 24, 25, 27,
+    28, 30, 31, 33, 34, 36, 37, 39, 40, 42, 43, 45, 46, 48, 49, 51, 52, 54, 55,
+    57, 58, 60, 61, 63, 64, 66, 67, 69, 70, 72, 73, 74, 74, 74, 74, 74, 74, 74,
+    74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74, 74 } };
+
+// the points T- (on the twist) and T+ (on E) the first round starts from when 
+// the curve is the base curve E: the Montgomery points x = 2 and x = 4 multiplied by 4
+// and all primes of COMPBA[1], so that their order is the product of the primes 
+// of BATCHES[1]; twisted Edwards y in radix-29 Montgomery domain, z = 1
+static uint32_t ET[2][HT_NWORDS] = {
+  { 0x134b5fba, 0x08980da1, 0x10498556, 0x13316d20, 0x1dfdf3d0, 0x185a257b,
+    0x0c91a035, 0x165044ed, 0x149225e2, 0x1db3cc38, 0x1639eb19, 0x07156dc4,
+    0x113ba102, 0x178d4652, 0x108785f8, 0x179566f0, 0x1b53c414, 0x000017c0, },
+  { 0x1b5fc06d, 0x0848ceaa, 0x051334aa, 0x196cc195, 0x03ab67d4, 0x1cd5a4bc,
+    0x070c5cef, 0x0b1a2cc7, 0x01ae5faa, 0x19784f79, 0x0045e3c8, 0x0784f948,
+    0x02d4cb4f, 0x198d22e3, 0x010effd2, 0x0daba306, 0x1dfe30b2, 0x00001749, },
+};
+
+// parameters for hybrid-extra-infinity 
+// HT_NUMISO + LL_NUMISO = NUMISO
+static int HT_NUMISO = 358;
+static int LL_NUMISO = 46;
+
+#define LL_NUMIDX 7 
+static uint8_t ll_idx[LL_NUMIDX] = { 62, 63, 64, 65, 66, 67, 68 };
+
+
+// -----------------------------------------------------------------------------
+
+void action(htpoint_t C, const __m256i *sk, const htpoint_t A);
+void random_sk(uint8_t *sk);
+
+#endif
@@ -0,0 +1,22 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#ifndef _API_H
+#define _API_H
+
+#include "action.h"
+
+// number of instances computed by one call of the batched (ht) group action
+#define HT_NLANES 4
+
+// the batched group action on radix-64 Montgomery coefficients, with no 
+// vector type in the interface (used by the runtime dispatcher in dispatch/)
+void action_u64(uint64_t (*r)[8], const uint8_t (*sk)[N], const uint64_t (*a)[8]);
+
+#endif
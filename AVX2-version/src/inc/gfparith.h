@@ -0,0 +1,177 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#ifndef _GFPARIT_H
+#define _GFPARIT_H
+
+#include <stdint.h>
+#include "intrin.h"
+
+// -----------------------------------------------------------------------------
+// radix-29 parameters and constants for High-Throughput (HT) implementations
+
+#define HT_BRADIX 29                    // limb size
+#define HT_NWORDS 18                    // limb number 
+#define HT_BMASK  0x1FFFFFFFUL          // 2^29 - 1
+#define HT_MONTW 0x32E294D              // the constant for Montgomery Multiplication
+
+typedef __m256i htfe_t[HT_NWORDS];      // HT field element
+
+// the prime p of the field
+static const uint64_t ht_p[HT_NWORDS] = {
+  0x13C6C87B, 0x1C0DC829, 0x0B2A0D46, 0x0437E8AF, 0x14F25C27, 0x18660F85,
+  0x141D459C, 0x18ACFE6A, 0x0DA7AAC6, 0x1499164E, 0x16BEFF31, 0x1B911884,
+  0x02D083AE, 0x1F26255A, 0x0AC34578, 0x1137FF91, 0x0E8F740F, 0x00032DA4, };
+
+// p * 2
+static const uint32_t ht_pmul2[HT_NWORDS] = {
+  0x078D90F6, 0x181B9053, 0x16541A8D, 0x086FD15E, 0x09E4B84E, 0x10CC1F0B,
+  0x083A8B39, 0x1159FCD5, 0x1B4F558D, 0x09322C9C, 0x0D7DFE63, 0x17223109, 
+  0x05A1075D, 0x1E4C4AB4, 0x15868AF1, 0x026FFF22, 0x1D1EE81F, 0x00065B48, };
+
+// R mod p = 2^522 mod p
+static const uint32_t ht_montR[HT_NWORDS] = {
+  0x0BF7E1D5, 0x1944150E, 0x1DB05986, 0x0932B2DD, 0x044E5A15, 0x049DBF94, 
+  0x055640F7, 0x1A92F0A2, 0x0B31E516, 0x06F67486, 0x07591D44, 0x00683014, 
+  0x0B026CC6, 0x11020023, 0x0851A93B, 0x0B4C59FC, 0x0DF0AF96, 0x00018B87, };
+
+// R^2 mod p = (2^522)^2 mod p 
+static const uint32_t ht_montR2[HT_NWORDS] = {
+  0x1C8CEBF0, 0x1B864D0A, 0x124DBAAB, 0x136BE0BA, 0x04ADD463, 0x1375FBF5,
+  0x1BF7A9C1, 0x033D3CE8, 0x03AA0C3B, 0x118D310F, 0x1CE83173, 0x1BE13007,
+  0x1AD114C5, 0x188D441E, 0x10FCDC0B, 0x1D9ABEBD, 0x0BE69F94, 0x0001A7D4, };
+
+// -----------------------------------------------------------------------------
+// signed radix-29 parameters for the safegcd inversion [BY19] of HT field elements
+
+#define SG_BRADIX 29                    // limb size, also the number of divsteps per iteration
+#define SG_NWORDS 18                    // limb number
+#define SG_BMASK  0x1FFFFFFFULL         // 2^29 - 1
+#define SG_NITERS 51                    // 51*29 = 1479 >= 1477 divsteps needed for 511-bit p
+#define SG_PINV   0x1CD1D6B3            // p^(-1) mod 2^29
+#define JC_NITERS 36                    // 36*29 = 1044 >= 2*511-1 binary GCD steps needed for the
+                                        // Jacobi symbol with 511-bit p [Por20]
+
+// -----------------------------------------------------------------------------
+// radix-64 constants 
+
+// prime p in radix-64
+static const uint64_t u64_p[8] = {
+  0x1b81b90533c6c87B, 0xc2721bf457aca835, 0x516730cc1f0b4f25, 0xa7aac6c567f35507,
+  0x5afbfcc69322c9cd, 0xb42d083aedc88c42, 0xfc8ab0d15e3e4c4a, 0x65b48e8f740f89bf, };
+
+// (p-2) in radix-64
+static const uint64_t u64_psub2[8] = {
+  0x1b81b90533c6c879, 0xc2721bf457aca835, 0x516730cc1f0b4f25, 0xa7aac6c567f35507,
+  0x5afbfcc69322c9cd, 0xb42d083aedc88c42, 0xfc8ab0d15e3e4c4a, 0x65b48e8f740f89bf, };
+
+// (p-1)/2 in radix-64
+static const uint64_t u64_pdiv2[8] = {
+  0x8dc0dc8299e3643d, 0xe1390dfa2bd6541a, 0xa8b398660f85a792, 0xd3d56362b3f9aa83,
+  0x2d7dfe63499164e6, 0x5a16841d76e44621, 0xfe455868af1f2625, 0x32da4747ba07c4df, };
+
+// -----------------------------------------------------------------------------
+// fixed sliding-window (w = 5) chains of the exponents (p-2) and (p-1)/2
+// each step {s, k} means r = r^(2^s) * a^(2k+1), the first step means r = a^(2k+1)
+
+#define EXP_WINTBL 16                   // number of precomputed odd powers a^1, a^3, ..., a^31
+#define EXP_CHNLEN 85                   // number of steps in the chain
+
+static const uint8_t psub2_chain[EXP_CHNLEN][2] = {
+  { 0, 12}, { 6, 13}, { 5,  4}, { 8, 14}, { 7,  7}, { 6, 14}, {11, 15}, { 8,  9},
+  { 6, 15}, { 5, 15}, { 5, 12}, { 8, 10}, { 3,  1}, { 8,  6}, { 8, 10}, { 3,  3},
+  { 8, 15}, { 7,  9}, { 7,  4}, { 6, 10}, { 3,  2}, { 8,  5}, { 2,  0}, { 5,  0},
+  {10, 14}, { 6, 14}, { 5, 11}, { 7,  8}, { 5,  1}, { 4,  0}, { 8,  4}, { 5,  6},
+  { 6, 15}, { 6, 15}, { 3,  3}, { 4,  1}, { 7,  6}, { 7,  9}, { 7,  8}, { 6, 12},
+  { 5,  3}, { 7, 13}, { 6,  9}, { 4,  6}, { 6, 10}, { 5,  8}, { 4,  5}, { 8, 10},
+  { 5,  9}, { 5, 15}, { 6,  6}, { 6, 10}, {10, 14}, { 6,  8}, { 6, 12}, { 5, 12},
+  { 1,  0}, { 9, 12}, { 1,  0}, {10, 15}, { 8,  5}, { 6,  9}, { 5, 12}, { 7, 11},
+  { 9,  9}, { 4,  4}, { 9, 13}, { 4,  7}, { 6,  8}, { 6, 11}, { 5, 10}, { 4,  4},
+  { 4,  2}, { 9,  6}, { 6,  8}, { 5, 11}, {11, 13}, { 4,  4}, { 8,  2}, { 7, 12},
+  { 3,  3}, { 8, 13}, { 3,  0}, { 8,  7}, { 3,  0},
+};
+
+static const uint8_t pdiv2_chain[EXP_CHNLEN][2] = {
+  { 0, 12}, { 6, 13}, { 5,  4}, { 8, 14}, { 7,  7}, { 6, 14}, {11, 15}, { 8,  9},
+  { 6, 15}, { 5, 15}, { 5, 12}, { 8, 10}, { 3,  1}, { 8,  6}, { 8, 10}, { 3,  3},
+  { 8, 15}, { 7,  9}, { 7,  4}, { 6, 10}, { 3,  2}, { 8,  5}, { 2,  0}, { 5,  0},
+  {10, 14}, { 6, 14}, { 5, 11}, { 7,  8}, { 5,  1}, { 4,  0}, { 8,  4}, { 5,  6},
+  { 6, 15}, { 6, 15}, { 3,  3}, { 4,  1}, { 7,  6}, { 7,  9}, { 7,  8}, { 6, 12},
+  { 5,  3}, { 7, 13}, { 6,  9}, { 4,  6}, { 6, 10}, { 5,  8}, { 4,  5}, { 8, 10},
+  { 5,  9}, { 5, 15}, { 6,  6}, { 6, 10}, {10, 14}, { 6,  8}, { 6, 12}, { 5, 12},
+  { 1,  0}, { 9, 12}, { 1,  0}, {10, 15}, { 8,  5}, { 6,  9}, { 5, 12}, { 7, 11},
+  { 9,  9}, { 4,  4}, { 9, 13}, { 4,  7}, { 6,  8}, { 6, 11}, { 5, 10}, { 4,  4},
+  { 4,  2}, { 9,  6}, { 6,  8}, { 5, 11}, {11, 13}, { 4,  4}, { 8,  2}, { 7, 12},
+  { 3,  3}, { 8, 13}, { 3,  0}, { 8,  7}, { 2,  0},
+};
+
+// -----------------------------------------------------------------------------
+// (4x1)-way prime-field operations
+
+void gfp_add_4x1w(htfe_t r, const htfe_t a, const htfe_t b);
+void gfp_sub_4x1w(htfe_t r, const htfe_t a, const htfe_t b);
+void gfp_mul_4x1w(htfe_t r, const htfe_t a, const htfe_t b);
+void gfp_sqr_4x1w(htfe_t r, const htfe_t a);
+void gfp_pow_4x1w(htfe_t r, const htfe_t a, const uint64_t *e);
+void gfp_powchn_4x1w(htfe_t r, const htfe_t a, const uint8_t (*c)[2]);
+void gfp_inv_4x1w(htfe_t r, const htfe_t a);
+void gfp_sginv_4x1w(htfe_t r, const htfe_t a);
+void gfp_rdcp_4x1w(htfe_t r, const htfe_t a);
+void gfp_zero_4x1w(htfe_t r);
+void gfp_num2mont_4x1w(htfe_t r, const htfe_t a);
+void gfp_mont2num_4x1w(htfe_t r, const htfe_t a);
+void gfp_copy_4x1w(htfe_t r, const htfe_t a);
+void gfp_cmove_4x1w(htfe_t r, htfe_t a, const __m256i b);
+void gfp_cswap_4x1w(htfe_t r, htfe_t a, const __m256i b);
+__m256i gfp_euler_4x1w(const htfe_t a);
+__m256i gfp_jacobi_4x1w(const htfe_t a);
+__m256i gfp_issqr_4x1w(const htfe_t a);
+__m256i gfp_iszero_4x1w(const htfe_t a);
+
+uint8_t u32_iseql(const uint32_t a, const uint32_t b);
+
+// -----------------------------------------------------------------------------
+// 1-way prime-field operations from [CCC+19] 
+
+#define NWORDS 8
+
+typedef uint64_t fp[NWORDS] __attribute__((aligned(64)));
+
+extern const fp p;
+extern const fp R_mod_p;
+extern const fp R_squared_mod_p;	
+extern const fp p_minus_1_halves;	
+
+void fp_cswap(fp x, fp y, uint8_t c);
+void fp_add(fp c, const fp a, const fp b);
+void fp_sub(fp c, const fp a, const fp b);
+void fp_mul(fp c, const fp a, const fp b);
+void fp_sqr(fp b, const fp a);
+void fp_inv(fp x);
+uint8_t fp_issquare(fp const x);
+void fp_random(fp x);
+
+#define set_zero(x, NUM)	memset(x, 0, sizeof(uint64_t) * NUM);
+
+#define set_one(x, NUM) {\
+  int i;\
+  x[0] = 1;   \
+  for (i=1; i < NUM; i++)\
+      x[i] = 0;\
+}
+
+#define copy(x, y, NUM)\
+  memcpy(x, y, sizeof(uint64_t)*NUM);
+
+int compare(uint64_t *x, uint64_t *y, int NUM);
+int iszero(uint64_t *x, int NUM);
+uint32_t isequal(uint32_t a, uint32_t b);
+int32_t issmaller(int32_t x, int32_t y);
+
+#endif
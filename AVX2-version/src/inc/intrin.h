@@ -0,0 +1,68 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#ifndef _INTRIN_H
+#define _INTRIN_H
+
+// AVX2 header file
+#include <immintrin.h>
+
+// AVX2 has no mask registers, so a "mask" in this implementation is a vector
+// whose 64-bit lanes are either all-0 or all-1 (as returned by the compare
+// instructions), and the masked operations are emulated with a blend.
+typedef __m256i vmask_t;
+
+// AVX2 integer arithmetic
+#define VADD(X, Y)            _mm256_add_epi64(X, Y)
+#define VMADD(W, X, Y, Z)     VMBLEND(X, W, VADD(Y, Z))
+#define VSUB(X, Y)            _mm256_sub_epi64(X, Y)
+#define VMSUB(W, X, Y, Z)     VMBLEND(X, W, VSUB(Y, Z))
+#define VMUL(X, Y)            _mm256_mul_epu32(X, Y)
+#define VMULS(X, Y)           _mm256_mul_epi32(X, Y)
+
+// bitwise logical operations
+#define VAND(X, Y)            _mm256_and_si256(X, Y)
+#define VOR(X, Y)             _mm256_or_si256(X, Y)
+#define VXOR(X, Y)            _mm256_xor_si256(X, Y)
+#define VMXOR(W, X, Y, Z)     VMBLEND(X, W, VXOR(Y, Z))
+#define VSHL(X, Y)            _mm256_slli_epi64(X, Y)
+#define VSHR(X, Y)            _mm256_srli_epi64(X, Y)
+// AVX2 has no 64-bit arithmetic right shift, so we OR the sign bits (broadcast
+// from the high 32-bit half with a 32-bit arithmetic shift) into a logical shift
+#define VSRA(X, Y)            VOR(VSHR(X, Y), \
+                              VSHL(_mm256_srai_epi32(_mm256_shuffle_epi32(X, 0xF5), 31), 64-(Y)))
+
+// comparison operations (return a mask)
+#define VCMPGT(X, Y)          _mm256_cmpgt_epi64(X, Y)
+#define VTEST(X, Y)           VXOR(_mm256_cmpeq_epi64(VAND(X, Y), VZERO), VSET1(-1))
+#define VMSKNZ(X)             (!_mm256_testz_si256(X, X))
+
+// broadcast operations
+#define VZERO                 _mm256_setzero_si256()
+#define VSET1(X)              _mm256_set1_epi64x(X)
+#define VSET(X3, X2, X1, X0)  _mm256_set_epi64x(X3, X2, X1, X0)
+
+// permutation & blend operations
+#define VPERM(X, Y)           _mm256_permute4x64_epi64(X, Y)
+#define VMBLEND(X, Y, Z)      _mm256_blendv_epi8(Y, Z, X)
+#define VMMOV(X, Y, Z)        VMBLEND(Y, X, Z)
+
+// 32-bit operations (for ChaCha20); AVX2 has no rotation, so we use two shifts
+#define VADD32(X, Y)          _mm256_add_epi32(X, Y)
+#define VROL32(X, Y)          VOR(_mm256_slli_epi32(X, Y), _mm256_srli_epi32(X, 32-(Y)))
+#define VSET132(X)            _mm256_set1_epi32(X)
+#define VSTORE(X, Y)          _mm256_storeu_si256((__m256i *)(X), Y)
+
+#define VADDRDC(X) \
+((uint64_t *)&X)[0]+((uint64_t *)&X)[1]+((uint64_t *)&X)[2]+((uint64_t *)&X)[3]
+
+#define VORRDC(X) \
+((uint64_t *)&X)[0]|((uint64_t *)&X)[1]|((uint64_t *)&X)[2]|((uint64_t *)&X)[3]
+
+#endif
@@ -0,0 +1,502 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#include "action.h"
+#include "utils.h"
+#include <string.h>
+
+// the function to measure CPU cycles 
+extern uint64_t read_tsc();
+
+// MACROs for benchmarking 
+
+#define ITER_L 100000
+#define ITER_M 10000
+#define ITER_S 1000
+
+#ifdef RNG_FIXED
+static const uint8_t rng_fixed[32] = { 0 };
+#endif
+
+#define LOAD_CACHE(X, ITER) for (i = 0; i < (ITER); i++) (X)
+
+#define MEASURE_TIME(X, ITER)                         \
+  start_cycles = read_tsc();                          \
+  for (i = 0; i < (ITER); i++) (X);                   \
+  end_cycles = read_tsc();                            \
+  diff_cycles = (end_cycles-start_cycles)/(ITER)
+
+static void sk_print(char *c, uint8_t *sk)
+{
+  int i;
+
+  printf("%s", c);
+  printf("%d", (int)((2*(sk[0]&1)-1)*(sk[0]>>1)));
+
+  for(i = 1; i < N; i++)
+  {
+    printf(":%d", (int)((2*(sk[i]&0x1)-1)*(sk[i]>>1)));
+  };
+  printf("\n");
+};
+
+void test_action()
+{
+  // test vectors for OAYT-style implementation
+  // have been verified by [CCC+19] code
+  // - SKA = -2:-3:1:3:-2:0:-2:3:3:-1:3:0:-1:1:-4:1:4:1:2:0:0:-3:4:4:-2:0:0:-2:5:-1:5:-1:4:4:5:3:6:5:1:-5:-7:-3:6:-7:-1:-7:-2:1:-3:-2:2:1:-3:7:-10:2:-3:8:5:2:3:7:4:-5:-1:-3:-1:2:2:0:-1:0:1:1
+  // - SKB = 1:-1:-3:-1:0:3:3:-1:-2:3:2:0:-4:-3:-3:4:-3:-3:2:-3:3:0:2:-4:-2:-3:3:4:0:3:5:-2:2:-6:-6:-2:1:4:1:1:4:1:-5:-1:-7:-5:-5:-5:7:6:8:4:5:9:10:1:-5:10:-2:8:-4:0:-1:5:3:7:3:5:2:0:1:0:0:1
+  // - PKA : 08A0E2B7EC266A371ECC73F2661217AA507A2986EDC109E9F01C0E47D62BAC0069F5132AAC7C1CAB2F91DAF8A827729D70AFB5EA93373AB0D7F5B69014B6F7ED
+  // - PKB : 3184BCFFDB31F8B626CD0CFD99D30D3E1CD83F7F46BB50870A433F3F39478ACC830D64647930E1A093FBA8CD221576AD1C33DCF3279F8C84A7770D9E569423D9
+  // - SS  : 5647C828E4C8112F1698C130B689946408674D3E264797F5D3C18D95DC579BB8E69EAB7018C7B41EA58B38F055EF72B46636EF9850E7CA6053670C8A16C918C3
+
+  // uncomment the following two lines if you want to use test vectors for OAYT-style implementation 
+  // uint8_t sk_a[N] = {4, 6, 3, 7, 4, 1, 4, 7, 7, 2, 7, 1, 2, 3, 8, 3, 9, 3, 5, 1, 1, 6, 9, 9, 4, 1, 1, 4, 11, 2, 11, 2, 9, 9, 11, 7, 13, 11, 3, 10, 14, 6, 13, 14, 2, 14, 4, 3, 6, 4, 5, 3, 6, 15, 20, 5, 6, 17, 11, 5, 7, 15, 9, 10, 2, 6, 2, 5, 5, 1, 2, 1, 3, 3, };
+  // uint8_t sk_b[N] = {3, 2, 6, 2, 1, 7, 7, 2, 4, 7, 5, 1, 8, 6, 6, 9, 6, 6, 5, 6, 7, 1, 5, 8, 4, 6, 7, 9, 1, 7, 11, 4, 5, 12, 12, 4, 3, 9, 3, 3, 9, 3, 10, 2, 14, 10, 10, 10, 15, 13, 17, 9, 11, 19, 21, 3, 10, 21, 4, 17, 8, 1, 2, 11, 7, 15, 7, 11, 5, 1, 3, 1, 1, 3, };
+  
+  // test vectors for Dummy-Free-style implementation
+  // have been verified by [CCC+19] code
+  // - SKA = 7:-5:3:1:3:5:-5:1:-3:1:1:3:-3:5:1:-5:-8:0:-2:8:-8:4:8:11:-1:5:-5:-3:7:-3:-3:3:-7:-5:5:-7:-5:3:-5:-9:-1:-11:11:13:7:-11:13:-1:13:-9:-5:13:-1:11:11:-5:-7:9:7:5:1:1:-5:-11:5:-7:7:-7:-5:-1:7:7:-7:7
+  // - SKB = -5:3:-7:-5:-5:5:3:5:-1:-5:-1:5:7:7:3:7:-8:6:2:-8:-8:-6:8:-11:-9:-1:-9:-1:11:-5:3:-5:1:-1:5:3:3:-7:-9:-9:1:5:5:-5:7:-7:-13:13:-9:-5:3:11:-7:3:-7:-1:11:-5:3:7:-9:9:-11:-3:-7:11:5:-9:-1:5:5:-3:7:3
+  // - PKA = 184F578A202B1FBFC0257243DBE9810569D7858E5D8239A2D682258F6579F00DF33F98CB06D14A9F8752E1BCADD527D7A9B619E2E5B8AFCA38B5FE031731C10E
+  // - PKB = 61A8176234DACCFCE6C618E7BBECA46BD38DD5E6C67FD67D5B9E8EF0DD93478147AE17D0CF8C0C4DABB317B1C85147E2FF6869994BD9A15ADF947BB683672EC6  
+  // - SS  = 09E943B1955EBE3A8FEDE1137FC17BA3859E581F53522A364670EBBA02CAC4358CE2EEEC138C13814053CEC9C68AF312B7886460CD9195599D854092BDCB92FC
+
+  // uncomment the following two lines if you want to use test vectors for Dummy-Free-style implementation 
+  // uint8_t sk_a[N] = {15, 10, 7, 3, 7, 11, 10, 3, 6, 3, 3, 7, 6, 11, 3, 10, 16, 1, 4, 17, 16, 9, 17, 23, 2, 11, 10, 6, 15, 6, 6, 7, 14, 10, 11, 14, 10, 7, 10, 18, 2, 22, 23, 27, 15, 22, 27, 2, 27, 18, 10, 27, 2, 23, 23, 10, 14, 19, 15, 11, 3, 3, 10, 22, 11, 14, 15, 14, 10, 2, 15, 15, 14, 15};
+  // uint8_t sk_b[N] = {10, 7, 14, 10, 10, 11, 7, 11, 2, 10, 2, 11, 15, 15, 7, 15, 16, 13, 5, 16, 16, 12, 17, 22, 18, 2, 18, 2, 23, 10, 7, 10, 3, 2, 11, 7, 7, 14, 18, 18, 3, 11, 11, 10, 15, 14, 26, 27, 18, 10, 7, 23, 14, 7, 14, 2, 23, 10, 7, 15, 18, 19, 22, 6, 14, 23, 11, 18, 2, 11, 11, 6, 15, 7};
+
+
+  uint8_t sk_a[N], sk_b[N];
+  uint8_t sk_c[N], sk_d[N];
+  __m256i vsk[N];
+  htpoint vPK, vSS, vE;
+  htfe_t t0, t1;
+  uint32_t pk_a[HT_NWORDS], pk_b[HT_NWORDS], pk_c[HT_NWORDS], pk_d[HT_NWORDS];
+  uint32_t ss_a[HT_NWORDS] = { 0 }, ss_b[HT_NWORDS] = { 0 };
+  uint32_t ss_c[HT_NWORDS] = { 0 }, ss_d[HT_NWORDS] = { 0 };
+  uint32_t r29[HT_NWORDS], r32[HT_NWORDS];
+  int i;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST:");
+  puts("-------------------------------------------------------------------");
+  puts("FOUR instances in each execution of the program.");
+  puts("We can test our software by assuming two pairs of them are sharing the secret:");
+  puts("A  <---------------------------->  B");
+  puts("C  <---------------------------->  D");
+
+  // randomly generate four private keys (comment the following line if you are using test vectors)
+  random_sk(sk_a); random_sk(sk_b); 
+  random_sk(sk_c); random_sk(sk_d);
+
+  // form the vector of private key
+  for (i = 0; i < N; i++) 
+    vsk[i] = set_vector(sk_d[i], sk_c[i], sk_b[i], sk_a[i]);
+
+  // intialize the vector of base curve
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+  }
+
+  puts("\n* Privake Keys:");
+  sk_print("  - SKA = ", sk_a);
+  sk_print("  - SKB = ", sk_b);
+  sk_print("  - SKC = ", sk_c);
+  sk_print("  - SKD = ", sk_d);
+
+  puts("\n* Public Keys:");  
+  action(&vPK, vsk, &vE);
+
+  gfp_sginv_4x1w(t0, vPK.z);
+  gfp_mul_4x1w(t1, vPK.y, t0);
+  gfp_mont2num_4x1w(t0, t1);
+
+  get_channel_4x1w(pk_a, t0, 0);
+  get_channel_4x1w(pk_b, t0, 1);
+  get_channel_4x1w(pk_c, t0, 2);
+  get_channel_4x1w(pk_d, t0, 3);
+
+  mpi_conv_29to32(r32, pk_a, HT_NWORDS, HT_NWORDS);
+  mpi_print("  - A : ", r32, 16);
+  mpi_conv_29to32(r32, pk_b, HT_NWORDS, HT_NWORDS);
+  mpi_print("  - B : ", r32, 16);
+  mpi_conv_29to32(r32, pk_c, HT_NWORDS, HT_NWORDS);
+  mpi_print("  - C : ", r32, 16);
+  mpi_conv_29to32(r32, pk_d, HT_NWORDS, HT_NWORDS);
+  mpi_print("  - D : ", r32, 16);
+
+  // We simply swap the position of (pk_a and pk_b), (pk_c and pk_d)
+  // in the AVX2 vectors. 
+  // So now it is (pk_c, pk_d, pk_a, pk_b)
+  //              (sk_d, sk_c, sk_b, sk_a)
+  for (i = 0; i < HT_NWORDS; i++) { 
+    vPK.y[i] = VPERM(vPK.y[i], 0xB1);
+    vPK.z[i] = VPERM(vPK.z[i], 0xB1);
+  }
+
+  puts("\n* Shared Secrets:");  
+  action(&vSS, vsk, &vPK);
+
+  gfp_sginv_4x1w(t0, vSS.z);
+  gfp_mul_4x1w(t1, vSS.y, t0);
+  gfp_mont2num_4x1w(t0, t1);
+
+  get_channel_4x1w(ss_a, t0, 0);
+  get_channel_4x1w(ss_b, t0, 1);
+  get_channel_4x1w(ss_c, t0, 2);
+  get_channel_4x1w(ss_d, t0, 3);
+  mpi_conv_29to32(r32, ss_a, HT_NWORDS, HT_NWORDS);
+  mpi_print("  - A : ", r32, 16);
+  mpi_conv_29to32(r32, ss_b, HT_NWORDS, HT_NWORDS);
+  mpi_print("  - B : ", r32, 16);
+  mpi_conv_29to32(r32, ss_c, HT_NWORDS, HT_NWORDS);
+  mpi_print("  - C : ", r32, 16);
+  mpi_conv_29to32(r32, ss_d, HT_NWORDS, HT_NWORDS);
+  mpi_print("  - D : ", r32, 16);
+
+  puts("\n* Correctness:");
+  if (memcmp(ss_a, ss_b, HT_NWORDS*sizeof(uint32_t)))
+        printf("Shared secret between A and B : \x1b[31mNOT EQUAL!\x1b[0m\n");
+  else
+    printf("Shared secret between A and B : \x1b[32mEQUAL!\x1b[0m\n");
+
+  if (memcmp(ss_c, ss_d, HT_NWORDS*sizeof(uint32_t)))
+    printf("Shared secret between C and D : \x1b[31mNOT EQUAL!\x1b[0m\n");
+  else
+    printf("Shared secret between C and D : \x1b[32mEQUAL!\x1b[0m\n");
+
+  puts("*******************************************************************");
+}
+
+void test_multi_actions(int round)
+{
+  int i, j, wrong = 0;
+  uint8_t sk_a[N], sk_b[N], sk_c[N], sk_d[N];
+  __m256i vsk[N];
+  htpoint vPK, vSS, vE;
+  htfe_t t0, t1;
+  uint32_t pk_a[HT_NWORDS], pk_b[HT_NWORDS], pk_c[HT_NWORDS], pk_d[HT_NWORDS];
+  uint32_t ss_a[HT_NWORDS] = { 0 }, ss_b[HT_NWORDS] = { 0 };
+  uint32_t ss_c[HT_NWORDS] = { 0 }, ss_d[HT_NWORDS] = { 0 };
+  uint32_t r29[HT_NWORDS], r32[HT_NWORDS];
+
+  puts("\n* Multi Tests:");
+
+  for (j = 0; j < round; j++) {
+
+    // randomly generate four private keys 
+    random_sk(sk_a); random_sk(sk_b); random_sk(sk_c); random_sk(sk_d);
+
+    // form the vector of private key
+    for (i = 0; i < N; i++) 
+      vsk[i] = set_vector(sk_d[i], sk_c[i], sk_b[i], sk_a[i]);
+    
+    // intialize the vector of base curve
+    for (i = 0; i < HT_NWORDS; i++) {
+      vE.y[i] = VSET1(E[0][i]);
+      vE.z[i] = VSET1(E[1][i]);
+    }
+
+    // keypair generation
+    action(&vPK, vsk, &vE);
+
+    gfp_sginv_4x1w(t0, vPK.z);
+    gfp_mul_4x1w(t1, vPK.y, t0);
+    gfp_mont2num_4x1w(t0, t1);
+
+    // We simply swap the position of (pk_a and pk_b), (pk_c and pk_d)
+    // in the AVX2 vectors. 
+    // So now it is (pk_c, pk_d, pk_a, pk_b)
+    //              (sk_d, sk_c, sk_b, sk_a)
+    for (i = 0; i < HT_NWORDS; i++) { 
+      vPK.y[i] = VPERM(vPK.y[i], 0xB1);
+      vPK.z[i] = VPERM(vPK.z[i], 0xB1);
+    }
+
+    // shared secret computation
+    action(&vSS, vsk, &vPK);
+
+    gfp_sginv_4x1w(t0, vSS.z);
+    gfp_mul_4x1w(t1, vSS.y, t0);
+    gfp_mont2num_4x1w(t0, t1);
+
+    get_channel_4x1w(ss_a, t0, 0);
+    get_channel_4x1w(ss_b, t0, 1);
+    get_channel_4x1w(ss_c, t0, 2);
+    get_channel_4x1w(ss_d, t0, 3);
+
+    wrong = memcmp(ss_a, ss_b, HT_NWORDS*sizeof(uint32_t));
+    wrong |= memcmp(ss_c, ss_d, HT_NWORDS*sizeof(uint32_t));
+
+    if (wrong) {
+      printf("No.%d \x1b[31mNOT PASS!\x1b[0m\n", j);
+    }
+    else 
+      printf("No.%d \x1b[32mPASS!\x1b[0m\n", j);
+  }
+
+  puts("*******************************************************************");
+}
+
+void timing_action()
+{
+  uint8_t sk_a[N], sk_b[N], sk_c[N], sk_d[N];
+  htpoint vE, vPK;
+  __m256i vsk[N];
+  int i;
+
+  // randomly generate four private keys 
+  random_sk(sk_a); random_sk(sk_b); random_sk(sk_c); random_sk(sk_d);
+
+  // initialize AVX2 vector of private key
+  for (i = 0; i < N; i++) 
+    vsk[i] = set_vector(sk_d[i], sk_c[i], sk_b[i], sk_a[i]);
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(action(&vPK, vsk, &vE), 100);
+  MEASURE_TIME(action(&vPK, vsk, &vE), 1000);
+  printf("* GROUP ACTION : %ld cycles\n", diff_cycles);
+}
+
+void timing_exp()
+{
+  htfe_t a, r;
+  uint64_t old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) a[i] = VSET1(E[0][i]);
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(gfp_pow_4x1w(r, a, u64_psub2), 100);
+  MEASURE_TIME(gfp_pow_4x1w(r, a, u64_psub2), ITER_S);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_inv_4x1w(r, a), ITER_S);
+  printf("* INVERSION    : %ld -> %ld cycles (%ld saved)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+  MEASURE_TIME(gfp_sginv_4x1w(r, a), ITER_S);
+  printf("* SAFEGCD INV  : %ld -> %ld cycles (%ld saved)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+
+  MEASURE_TIME(gfp_pow_4x1w(r, a, u64_pdiv2), ITER_S);
+  old_cycles = diff_cycles;
+  MEASURE_TIME(gfp_euler_4x1w(a), ITER_S);
+  printf("* EULER        : %ld -> %ld cycles (%ld saved per elligator)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+  MEASURE_TIME(gfp_jacobi_4x1w(a), ITER_S);
+  printf("* JACOBI       : %ld -> %ld cycles (%ld saved per elligator)\n", old_cycles, diff_cycles, old_cycles-diff_cycles);
+}
+
+// read from the kernel, as randombytes() did before the DRBG
+static void urandom_read(void *r, size_t len)
+{
+  static int fd = -1;
+  ssize_t n;
+
+  if ((fd < 0) && (0 > (fd = open("/dev/urandom", O_RDONLY)))) exit(1);
+  for (size_t i = 0; i < len; i += n)
+    if (0 >= (n = read(fd, (char *)r + i, len-i))) exit(2);
+}
+
+// the ChaCha20 core gives the block of RFC 8439 (Sect. 2.3.2) and its successors
+// in the next lanes, and a fixed seed gives the same bytes however they are read
+void test_rng()
+{
+  const uint32_t out[16] = {
+    0xe4e7f110, 0x15593bd1, 0x1fdd0f50, 0xc47120a3, 0xc7f4d1c7, 0x0368c033, 0x9aaa2204, 0x4e6cd4c3, 
+    0x466482d2, 0x09aa9f07, 0x05d7c214, 0xa2028bd9, 0xd19c12b5, 0xb94e16de, 0xe883d0cb, 0x4e3c50a2, };
+  const uint32_t nonce[3] = { 0x09000000, 0x4a000000, 0x00000000 };
+  uint32_t key[8], w0[16][RNG_LANES], w1[16][RNG_LANES];
+  uint8_t seed[32] = { 0 }, a[3000], b[3000];
+  __m256i x[16];
+  int i, k, wrong = 0;
+
+  for (i = 0; i < 8; i++) key[i] = 0x03020100 + 0x04040404*i;   // key = 00:01:...:1f
+  chacha20_8x1w(x, key, nonce, 1);
+  memcpy(w0, x, sizeof(w0));
+  for (i = 0; i < 16; i++) wrong |= (w0[i][0] != out[i]);
+  chacha20_8x1w(x, key, nonce, RNG_LANES-1);
+  memcpy(w1, x, sizeof(w1));
+  for (i = 0; i < 16; i++) wrong |= (w0[i][RNG_LANES-2] != w1[i][0]);
+
+  rng_seed(seed);
+  randombytes(a, sizeof(a));
+  rng_seed(seed);
+  for (i = 0, k = 1; i < sizeof(b); i += k, k = 2*k+1) randombytes(&b[i], (i+k < sizeof(b)) ? k : sizeof(b)-i);
+  wrong |= memcmp(a, b, sizeof(a));
+  memset(b, 0, sizeof(b));
+  wrong |= !memcmp(a, b, sizeof(a));
+  rng_seed(NULL);
+
+  if (wrong) printf("ChaCha20 DRBG     : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("ChaCha20 DRBG     : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// the Jacobi symbol agrees with Euler's criterion on random elements (< 2^511)
+// and on 0, 1, p-1 and p
+void test_jacobi()
+{
+  uint64_t x[HT_NWORDS][4];
+  htfe_t a;
+  __m256i r, s;
+  int i, k, wrong = 0;
+
+  for (k = 0; k < 2000; k++) {
+    randombytes(x, sizeof(x));
+    for (i = 0; i < HT_NWORDS; i++) 
+      a[i] = VAND(VSET(x[i][3], x[i][2], x[i][1], x[i][0]), VSET1(HT_BMASK));
+    a[HT_NWORDS-1] = VAND(a[HT_NWORDS-1], VSET1((1ULL<<(511-HT_BRADIX*(HT_NWORDS-1)))-1));
+    if (k == 0) {
+      for (i = 0; i < HT_NWORDS; i++) a[i] = VSET(ht_p[i], ht_p[i]-(i == 0), (i == 0), 0);
+    }
+    r = gfp_jacobi_4x1w(a);
+    s = gfp_euler_4x1w(a);
+    wrong |= VMSKNZ(VXOR(r, s));
+  }
+
+  if (wrong) printf("Jacobi symbol     : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Jacobi symbol     : \x1b[32mPASS!\x1b[0m\n");
+}
+
+void timing_rng()
+{
+  uint64_t u[8], old_cycles;
+  int i;
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(urandom_read(u, sizeof(u)), 100);
+  MEASURE_TIME(urandom_read(u, sizeof(u)), ITER_M);
+  old_cycles = diff_cycles;
+  LOAD_CACHE(randombytes(u, sizeof(u)), 100);
+  MEASURE_TIME(randombytes(u, sizeof(u)), ITER_M);
+  printf("* RANDOMBYTES  : %ld -> %ld cycles (64 bytes)\n", old_cycles, diff_cycles);
+}
+
+// the first-round points on the base curve: T+ lies on E and T- on its twist, 
+// and both have the order of the product of the primes of BATCHES[1]
+void test_basepoints()
+{
+  htpoint vE, T[2], G;
+  htfe_t t0, t1, t2;
+  __m256i r;
+  const int m = 1 % NUMBA;
+  int i, j, k, wrong = 0;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+    for (k = 0; k < 2; k++) {
+      T[k].y[i] = VSET1(ET[k][i]);
+      T[k].z[i] = VSET1(ht_montR[i]);
+    }
+  }
+  wrong |= !curve_iseql_4x1w(&vE, E[0], E[1]);
+  wrong |= curve_iseql_4x1w(&vE, E[1], E[0]);
+
+  for (k = 0; k < 2; k++) {
+    // Montgomery X = z+y, Z = z-y, then X*Z*(X^2+Z^2) is a square iff x^3+x is
+    gfp_add_4x1w(t0, T[k].z, T[k].y);
+    gfp_sub_4x1w(t1, T[k].z, T[k].y);
+    gfp_mul_4x1w(t2, t0, t1);
+    gfp_sqr_4x1w(t0, t0);
+    gfp_sqr_4x1w(t1, t1);
+    gfp_add_4x1w(t0, t0, t1);
+    gfp_mul_4x1w(t2, t2, t0);
+    r = gfp_issqr_4x1w(t2);
+    wrong |= (VADDRDC(r) != 4*k);
+
+    for (i = 0; i < SIZEBA[m]; i++) {
+      point_copy_4x1w(&G, &T[k]);
+      for (j = 0; j < SIZEBA[m]; j++)
+        if (j != i) yMUL_4x1w(&G, &G, &vE, BATCHES[m][j]);
+      r = point_isinf_4x1w(&G);
+      wrong |= (VORRDC(r) != 0);
+      yMUL_4x1w(&G, &G, &vE, BATCHES[m][i]);
+      r = point_isinf_4x1w(&G);
+      wrong |= (VADDRDC(r) != 4);
+    }
+  }
+
+  if (wrong) printf("Base curve points : \x1b[31mNOT PASS!\x1b[0m\n");
+  else printf("Base curve points : \x1b[32mPASS!\x1b[0m\n");
+}
+
+// the first round on the base curve: Elligator and the cofactor clearing over 
+// COMPBA[1] against loading the precomputed points
+static void basepoints_elligator(htpoint_t T0, htpoint_t T1, const htpoint_t A)
+{
+  const int m = 1 % NUMBA;
+  int i;
+
+  elligator_4x1w(T1, T0, A);
+  yDBL_4x1w(T0, T0, A); 
+  yDBL_4x1w(T0, T0, A);
+  yDBL_4x1w(T1, T1, A);
+  yDBL_4x1w(T1, T1, A); 
+  for (i = 0; i < SICOBA[m]; i++) {
+    yMUL_4x1w(T0, T0, A, COMPBA[m][i]); 
+    yMUL_4x1w(T1, T1, A, COMPBA[m][i]);
+  }
+}
+
+static void basepoints_table(htpoint_t T0, htpoint_t T1)
+{
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    T0->y[i] = VSET1(ET[0][i]);
+    T1->y[i] = VSET1(ET[1][i]);
+    T0->z[i] = T1->z[i] = VSET1(ht_montR[i]);
+  }
+}
+
+void timing_basepoints()
+{
+  htpoint vE, T0, T1;
+  uint64_t old_cycles;
+  int i;
+
+  for (i = 0; i < HT_NWORDS; i++) {
+    vE.y[i] = VSET1(E[0][i]);
+    vE.z[i] = VSET1(E[1][i]);
+  }
+
+  uint64_t start_cycles, end_cycles, diff_cycles;
+
+  LOAD_CACHE(basepoints_elligator(&T0, &T1, &vE), 10);
+  MEASURE_TIME(basepoints_elligator(&T0, &T1, &vE), ITER_S);
+  old_cycles = diff_cycles;
+  LOAD_CACHE(basepoints_table(&T0, &T1), 100);
+  MEASURE_TIME(basepoints_table(&T0, &T1), ITER_L);
+  printf("* BASE POINTS  : %ld -> %ld cycles (first round on E)\n", old_cycles, diff_cycles);
+}
+
+int main() 
+{
+  test_rng();
+  test_jacobi();
+#ifdef RNG_FIXED
+  rng_seed(rng_fixed);                  // reproducible runs
+#endif
+  test_action();
+  test_basepoints();
+  // test_multi_actions(1000);
+  timing_rng();
+  timing_exp();
+  timing_basepoints();
+  timing_action();
+  
+  return 0;
+}
\ No newline at end of file
@@ -0,0 +1,220 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#include "csidh.h"
+#include <cpuid.h>
+#include <string.h>
+#include <stdatomic.h>
+
+// the (2x4)-way action of AVX-512IFMA takes a bit less than half of the time of 
+// the (8x1)-way one, so the unbatched action is used for up to 2 instances
+#define LL_MAX 2
+
+// the (prefixed) entry points of the backends, see the Makefile
+#define BACKEND_API(P)                                                                 \
+void P##action_u64(uint64_t (*r)[CSIDH_NWORDS], const uint8_t (*sk)[CSIDH_N],          \
+                   const uint64_t (*a)[CSIDH_NWORDS]);                                 \
+void P##random_sk(uint8_t *sk);
+
+BACKEND_API(avx2_)
+BACKEND_API(avx512f_)
+BACKEND_API(ifma_)
+void ifmall_action_ll_u64(uint64_t r[CSIDH_NWORDS], const uint8_t sk[CSIDH_N], const uint64_t a[CSIDH_NWORDS]);
+int ifma_cache_add(const uint64_t a[CSIDH_NWORDS]);
+void ifma_cache_clear();
+
+typedef struct {
+  const char *name;
+  int lanes;
+  void (*action)(uint64_t (*r)[CSIDH_NWORDS], const uint8_t (*sk)[CSIDH_N], const uint64_t (*a)[CSIDH_NWORDS]);
+  void (*random_sk)(uint8_t *sk);
+  // unbatched action (if any) and the largest number of instances for which
+  // running it once per instance is faster than one batched action 
+  void (*action_ll)(uint64_t r[CSIDH_NWORDS], const uint8_t sk[CSIDH_N], const uint64_t a[CSIDH_NWORDS]);
+  size_t ll_max;
+  // cache of the first-round points of static curves (if any)
+  int (*cache_add)(const uint64_t a[CSIDH_NWORDS]);
+  void (*cache_clear)();
+} backend_t;
+
+static const backend_t backends[] = {
+  [CSIDH_NONE]       = { "none",        0, 0,                  0,                 0,                    0,      0,              0 },
+  [CSIDH_AVX2]       = { "AVX2",        4, avx2_action_u64,    avx2_random_sk,    0,                    0,      0,              0 },
+  [CSIDH_AVX512F]    = { "AVX-512F",    8, avx512f_action_u64, avx512f_random_sk, 0,                    0,      0,              0 },
+  [CSIDH_AVX512IFMA] = { "AVX-512IFMA", 8, ifma_action_u64,    ifma_random_sk,    ifmall_action_ll_u64, LL_MAX, ifma_cache_add, ifma_cache_clear },
+};
+
+// -1 means that the backend has not been selected yet; atomic, since the first
+// calls (and csidh_set_backend) may come from several threads at once 
+static atomic_int current = -1;
+
+// extended control register XCR0, i.e., the register states enabled by the OS
+static uint64_t xgetbv0()
+{
+  uint32_t lo, hi;
+
+  __asm__ volatile ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+  return ((uint64_t)hi << 32) | lo;
+}
+
+// the fastest backend supported by the CPU (and the OS), detected with CPUID
+csidh_backend csidh_cpu_backend()
+{
+  uint32_t eax, ebx, ecx, edx, ymm, zmm;
+  uint64_t xcr0;
+
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return CSIDH_NONE;
+  if (!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX)) return CSIDH_NONE;
+  xcr0 = xgetbv0();
+  ymm = (xcr0 & 0x06) == 0x06;          // XMM and YMM states
+  zmm = (xcr0 & 0xE6) == 0xE6;          // and opmask, ZMM_Hi256, Hi16_ZMM states 
+
+  if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return CSIDH_NONE;
+  // the unbatched component (fp512.S) of all the backends needs BMI2 and ADX
+  if (!(ebx & bit_BMI2) || !(ebx & bit_ADX)) return CSIDH_NONE;
+  if (zmm && (ebx & bit_AVX512F) && (ebx & bit_AVX512IFMA)) return CSIDH_AVX512IFMA;
+  if (zmm && (ebx & bit_AVX512F)) return CSIDH_AVX512F;
+  if (ymm && (ebx & bit_AVX2)) return CSIDH_AVX2;
+
+  return CSIDH_NONE;
+}
+
+// the backend in use; the fastest one is selected at the first call
+csidh_backend csidh_get_backend()
+{
+  int b = atomic_load_explicit(&current, memory_order_acquire), cpu;
+
+  if (b < 0) {
+    // all threads detect the same backend, but a concurrent csidh_set_backend()
+    // must not be overwritten: only replace the -1 
+    cpu = csidh_cpu_backend();
+    if (atomic_compare_exchange_strong_explicit(&current, &b, cpu, memory_order_acq_rel, memory_order_acquire)) b = cpu;
+  }
+
+  return (csidh_backend) b;
+}
+
+// force the backend b (e.g., for testing), which must not be faster than the 
+// one returned by csidh_cpu_backend(); return 0 on success, -1 otherwise 
+int csidh_set_backend(const csidh_backend b)
+{
+  if ((b <= CSIDH_NONE) || (b > csidh_cpu_backend())) return -1;
+  atomic_store_explicit(&current, b, memory_order_release);
+  return 0;
+}
+
+const char *csidh_backend_name(const csidh_backend b)
+{
+  return backends[b].name;
+}
+
+// number of instances computed by one call of csidh_action()
+int csidh_lanes()
+{
+  return backends[csidh_get_backend()].lanes;
+}
+
+// CSIDH class group action r[i] = sk[i] * a[i] for i = 0, ..., csidh_lanes()-1,
+// a[i] and r[i] are the Montgomery curve coefficients A in [0, p) in radix-64 
+// return 0 on success, -1 if the CPU supports no backend
+int csidh_action(uint64_t (*r)[CSIDH_NWORDS], const uint8_t (*sk)[CSIDH_N], const uint64_t (*a)[CSIDH_NWORDS])
+{
+  const backend_t *bk = &backends[csidh_get_backend()];
+
+  if (!bk->action) return -1;
+  bk->action(r, sk, a);
+  return 0;
+}
+
+// generate a random secret key
+// return 0 on success, -1 if the CPU supports no backend
+int csidh_random_sk(uint8_t *sk)
+{
+  const backend_t *bk = &backends[csidh_get_backend()];
+
+  if (!bk->random_sk) return -1;
+  bk->random_sk(sk);
+  return 0;
+}
+
+// group action r[i] = sk[i] * a[i] for i = 0, ..., n-1 on serialised keys (the
+// base curve a[i] = 0 if a is NULL): the instances are packed in groups of 
+// csidh_lanes() and the last group is padded with zero keys on the base curve
+static int action_batch(uint8_t *r, const uint8_t *sk, const uint8_t *a, const size_t n)
+{
+  const backend_t *bk = &backends[csidh_get_backend()];
+  uint8_t vsk[CSIDH_MAXLANE][CSIDH_N];
+  uint64_t va[CSIDH_MAXLANE][CSIDH_NWORDS], vr[CSIDH_MAXLANE][CSIDH_NWORDS];
+  size_t i, k, m;
+
+  if (!bk->action) return -1;
+
+  // a few instances: the unbatched action for each of them 
+  if (n <= bk->ll_max) {
+    for (i = 0; i < n; i++) {
+      // x86 is little-endian, so the bytes of A are the words of A
+      if (a) memcpy(va[0], &a[i*CSIDH_PKBYTES], CSIDH_PKBYTES);
+      else memset(va[0], 0, CSIDH_PKBYTES);
+      bk->action_ll(vr[0], &sk[i*CSIDH_SKBYTES], va[0]);
+      memcpy(&r[i*CSIDH_PKBYTES], vr[0], CSIDH_PKBYTES);
+    }
+    return 0;
+  }
+
+  for (i = 0; i < n; i += m) {
+    m = ((n-i) < (size_t)bk->lanes) ? (n-i) : (size_t)bk->lanes;
+    memset(vsk, 0, sizeof(vsk));
+    memset(va, 0, sizeof(va));
+    memcpy(vsk, &sk[i*CSIDH_SKBYTES], m*CSIDH_SKBYTES);
+    if (a) memcpy(va, &a[i*CSIDH_PKBYTES], m*CSIDH_PKBYTES);
+    bk->action(vr, (const uint8_t (*)[CSIDH_N])vsk, (const uint64_t (*)[CSIDH_NWORDS])va);
+    for (k = 0; k < m; k++) memcpy(&r[(i+k)*CSIDH_PKBYTES], vr[k], CSIDH_PKBYTES);
+  }
+
+  return 0;
+}
+
+// public keys pk[i] = sk[i] * E0 for i = 0, ..., n-1 
+// sk: n*CSIDH_SKBYTES bytes, pk: n*CSIDH_PKBYTES bytes
+// return 0 on success, -1 if the CPU supports no backend
+int csidh_keygen_batch(uint8_t *pk, const uint8_t *sk, const size_t n)
+{
+  return action_batch(pk, sk, NULL, n);
+}
+
+// shared secrets ss[i] = sk[i] * pk[i] for i = 0, ..., n-1
+// sk: n*CSIDH_SKBYTES bytes, pk and ss: n*CSIDH_PKBYTES bytes 
+// return 0 on success, -1 if the CPU supports no backend
+int csidh_derive_batch(uint8_t *ss, const uint8_t *sk, const uint8_t *pk, const size_t n)
+{
+  return action_batch(ss, sk, pk, n);
+}
+
+// add the static public key pk (CSIDH_PKBYTES bytes) to the cache of the backend,
+// so that the batched actions on it skip Elligator and the cofactor clearing of 
+// the first round (the unbatched action for up to ll_max instances does not use it)
+// return 0 on success, -1 if the backend has no cache, the cache is full or no 
+// points of the required order have been found (e.g., pk is not a valid key) 
+int csidh_cache_add(const uint8_t *pk)
+{
+  const backend_t *bk = &backends[csidh_get_backend()];
+  uint64_t a[CSIDH_NWORDS];
+
+  if (!bk->cache_add) return -1;
+  memcpy(a, pk, CSIDH_PKBYTES);
+  return bk->cache_add(a);
+}
+
+// empty the cache of the backend; not to be called while actions are running
+void csidh_cache_clear()
+{
+  const backend_t *bk = &backends[csidh_get_backend()];
+
+  if (bk->cache_clear) bk->cache_clear();
+}
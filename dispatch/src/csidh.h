@@ -0,0 +1,45 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#ifndef _CSIDH_H
+#define _CSIDH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define CSIDH_N       74                // number of small primes l_i, one byte of secret key each
+#define CSIDH_NWORDS  8                 // number of 64-bit words of a curve coefficient 
+#define CSIDH_MAXLANE 8                 // largest number of lanes of all backends
+#define CSIDH_SKBYTES CSIDH_N           // bytes of a secret key
+#define CSIDH_PKBYTES 64                // bytes of a public key or a shared secret (A, little-endian)
+
+// the backends, from the slowest to the fastest one
+typedef enum {
+  CSIDH_NONE = 0,                       // no backend is supported by this CPU
+  CSIDH_AVX2,                           // (4x1)-way AVX2 (AVX2-version)
+  CSIDH_AVX512F,                        // (8x1)-way AVX-512F (AVX-512F-version)
+  CSIDH_AVX512IFMA,                     // (8x1)-way AVX-512IFMA (AVX-512IFMA-version)
+} csidh_backend;
+
+csidh_backend csidh_cpu_backend();
+csidh_backend csidh_get_backend();
+int csidh_set_backend(const csidh_backend b);
+const char *csidh_backend_name(const csidh_backend b);
+int csidh_lanes();
+int csidh_action(uint64_t (*r)[CSIDH_NWORDS], const uint8_t (*sk)[CSIDH_N], const uint64_t (*a)[CSIDH_NWORDS]);
+int csidh_random_sk(uint8_t *sk);
+int csidh_keygen_batch(uint8_t *pk, const uint8_t *sk, const size_t n);
+int csidh_derive_batch(uint8_t *ss, const uint8_t *sk, const uint8_t *pk, const size_t n);
+// the cache of static (peer) public keys: csidh_cache_add() may be called by 
+// several threads at once and while actions are running, csidh_cache_clear() 
+// only while no action is running
+int csidh_cache_add(const uint8_t *pk);
+void csidh_cache_clear();
+
+#endif
@@ -0,0 +1,176 @@
+/**
+ *******************************************************************************
+ * @version 0.1
+ * @date 2021-08-22
+ * @copyright Copyright © 2021 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng.
+ *******************************************************************************
+ */
+
+#include "csidh.h"
+#include <stdio.h>
+#include <string.h>
+#include <x86intrin.h>
+
+#define ITER_S 10
+#define BATCH_N 17
+
+// run the group action on CSIDH_MAXLANE instances with the backend in use
+static void action_all(uint64_t (*r)[CSIDH_NWORDS], const uint8_t (*sk)[CSIDH_N], const uint64_t (*a)[CSIDH_NWORDS])
+{
+  int i, lanes = csidh_lanes();
+
+  for (i = 0; i < CSIDH_MAXLANE; i += lanes) csidh_action(&r[i], &sk[i], &a[i]);
+}
+
+// test all the backends supported by the CPU on the same private keys:  
+// the shared secrets must be equal and the public keys of all backends, too 
+void test_backends()
+{
+  uint8_t sk[CSIDH_MAXLANE][CSIDH_N];
+  uint64_t E0[CSIDH_MAXLANE][CSIDH_NWORDS] = { 0 }, pk[CSIDH_MAXLANE][CSIDH_NWORDS];
+  uint64_t pkx[CSIDH_MAXLANE][CSIDH_NWORDS], ss[CSIDH_MAXLANE][CSIDH_NWORDS], pk0[CSIDH_MAXLANE][CSIDH_NWORDS];
+  csidh_backend b, top = csidh_cpu_backend();
+  int i, wrong;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST:");
+  puts("-------------------------------------------------------------------");
+  printf("Backend selected by CPUID: %s\n", csidh_backend_name(top));
+  if (top == CSIDH_NONE) return;
+
+  for (i = 0; i < CSIDH_MAXLANE; i++) csidh_random_sk(sk[i]);
+
+  for (b = CSIDH_AVX2; b <= top; b++) {
+    csidh_set_backend(b);
+    // keypair generation 
+    action_all(pk, (const uint8_t (*)[CSIDH_N])sk, (const uint64_t (*)[CSIDH_NWORDS])E0);
+    // instance 2i shares the secret with instance 2i+1
+    for (i = 0; i < CSIDH_MAXLANE; i++) memcpy(pkx[i], pk[i^1], sizeof(pk[i]));
+    action_all(ss, (const uint8_t (*)[CSIDH_N])sk, (const uint64_t (*)[CSIDH_NWORDS])pkx);
+
+    wrong = 0;
+    for (i = 0; i < CSIDH_MAXLANE; i += 2) wrong |= memcmp(ss[i], ss[i+1], sizeof(ss[i]));
+    if (b == CSIDH_AVX2) memcpy(pk0, pk, sizeof(pk));
+    else wrong |= memcmp(pk0, pk, sizeof(pk));
+
+    if (wrong) printf("%-12s: \x1b[31mNOT PASS!\x1b[0m\n", csidh_backend_name(b));
+    else printf("%-12s: \x1b[32mPASS!\x1b[0m\n", csidh_backend_name(b));
+  }
+  csidh_set_backend(top);
+}
+
+// test the batch API with the backend in use on n = 1, ..., BATCH_N instances:
+// instance i shares the secret with instance n-1-i, and the public keys must
+// not depend on n (i.e., on the partial packing or on the unbatched fallback) 
+void test_batch()
+{
+  uint8_t sk[BATCH_N*CSIDH_SKBYTES], pk[BATCH_N*CSIDH_PKBYTES];
+  uint8_t pk0[BATCH_N*CSIDH_PKBYTES], pkx[BATCH_N*CSIDH_PKBYTES], ss[BATCH_N*CSIDH_PKBYTES];
+  size_t i, n;
+  int wrong = 0;
+
+  if (csidh_get_backend() == CSIDH_NONE) return;
+
+  for (i = 0; i < BATCH_N; i++) csidh_random_sk(&sk[i*CSIDH_SKBYTES]);
+  csidh_keygen_batch(pk0, sk, BATCH_N);
+
+  for (n = 1; n <= BATCH_N; n++) {
+    csidh_keygen_batch(pk, sk, n);
+    wrong |= memcmp(pk, pk0, n*CSIDH_PKBYTES);
+    for (i = 0; i < n; i++) memcpy(&pkx[i*CSIDH_PKBYTES], &pk[(n-1-i)*CSIDH_PKBYTES], CSIDH_PKBYTES);
+    csidh_derive_batch(ss, sk, pkx, n);
+    for (i = 0; i < n; i++) 
+      wrong |= memcmp(&ss[i*CSIDH_PKBYTES], &ss[(n-1-i)*CSIDH_PKBYTES], CSIDH_PKBYTES);
+  }
+
+  if (wrong) printf("Batch API (n = 1..%d): \x1b[31mNOT PASS!\x1b[0m\n", BATCH_N);
+  else printf("Batch API (n = 1..%d): \x1b[32mPASS!\x1b[0m\n", BATCH_N);
+
+  puts("*******************************************************************");
+}
+
+// derive shared secrets against one static public key with and without the
+// cache of the backend in use (if it has one): the results must be the same, 
+// and a curve that is not supersingular must not be added to the cache 
+void test_cache()
+{
+  uint8_t sk[BATCH_N*CSIDH_SKBYTES], pk[BATCH_N*CSIDH_PKBYTES], bad[CSIDH_PKBYTES] = { 1 };
+  uint8_t ss0[BATCH_N*CSIDH_PKBYTES], ss1[BATCH_N*CSIDH_PKBYTES];
+  size_t i;
+  int wrong = 0, r;
+
+  if (csidh_get_backend() == CSIDH_NONE) return;
+
+  for (i = 0; i < BATCH_N; i++) csidh_random_sk(&sk[i*CSIDH_SKBYTES]);
+  csidh_keygen_batch(pk, sk, 1);
+  for (i = 1; i < BATCH_N; i++) memcpy(&pk[i*CSIDH_PKBYTES], pk, CSIDH_PKBYTES);
+
+  csidh_derive_batch(ss0, sk, pk, BATCH_N);
+  r = csidh_cache_add(pk);
+  csidh_derive_batch(ss1, sk, pk, BATCH_N);
+  wrong |= memcmp(ss0, ss1, sizeof(ss0));
+  wrong |= (r == 0) && (csidh_cache_add(bad) == 0);
+  csidh_cache_clear();
+
+  if (wrong) printf("Curve cache (%s): \x1b[31mNOT PASS!\x1b[0m\n", r ? "none" : "on");
+  else printf("Curve cache (%s): \x1b[32mPASS!\x1b[0m\n", r ? "none" : "on");
+
+  puts("*******************************************************************");
+}
+
+// cycles per instance of the batch API with the backend in use 
+void timing_batch()
+{
+  uint8_t sk[BATCH_N*CSIDH_SKBYTES], pk[BATCH_N*CSIDH_PKBYTES];
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  size_t i, n;
+
+  if (csidh_get_backend() == CSIDH_NONE) return;
+
+  for (i = 0; i < BATCH_N; i++) csidh_random_sk(&sk[i*CSIDH_SKBYTES]);
+
+  for (n = 1; n <= BATCH_N; n++) {
+    start_cycles = __rdtsc();
+    for (i = 0; i < ITER_S; i++) csidh_keygen_batch(pk, sk, n);
+    end_cycles = __rdtsc();
+    diff_cycles = (end_cycles-start_cycles)/ITER_S;
+    printf("* batch n = %2ld : %ld cycles (%ld per instance)\n", n, diff_cycles, diff_cycles/n);
+  }
+}
+
+void timing_backends()
+{
+  uint8_t sk[CSIDH_MAXLANE][CSIDH_N];
+  uint64_t E0[CSIDH_MAXLANE][CSIDH_NWORDS] = { 0 }, pk[CSIDH_MAXLANE][CSIDH_NWORDS];
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  csidh_backend b, top = csidh_cpu_backend();
+  int i;
+
+  if (top == CSIDH_NONE) return;
+
+  for (i = 0; i < CSIDH_MAXLANE; i++) csidh_random_sk(sk[i]);
+
+  for (b = CSIDH_AVX2; b <= top; b++) {
+    csidh_set_backend(b);
+    start_cycles = __rdtsc();
+    for (i = 0; i < ITER_S; i++) 
+      csidh_action(pk, (const uint8_t (*)[CSIDH_N])sk, (const uint64_t (*)[CSIDH_NWORDS])E0);
+    end_cycles = __rdtsc();
+    diff_cycles = (end_cycles-start_cycles)/ITER_S;
+    printf("* %-12s: %ld cycles per %d actions (%ld per action)\n", 
+           csidh_backend_name(b), diff_cycles, csidh_lanes(), diff_cycles/csidh_lanes());
+  }
+  csidh_set_backend(top);
+}
+
+int main() 
+{
+  test_backends();
+  test_batch();
+  test_cache();
+  timing_backends();
+  timing_batch();
+
+  return 0;
+}